@@ -6,72 +6,201 @@
 
 #include "PathSizeField.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <functional>
 
 #include <apf.h>
 #include <apfMesh.h>
-#include <apfGeometry.h>
 
 namespace Albany {
 
+/* like apf::getDistance(apf::LineSegment, ...), but also valid when a == b */
+static double getSegmentDistance(apf::Vector3 const& a, apf::Vector3 const& b,
+    apf::Vector3 const& p)
+{
+  apf::Vector3 const ab = b - a;
+  double const length2 = ab * ab;
+  double t = 0.0;
+  if (length2 > 0.0)
+    t = std::max(0.0, std::min(1.0, ((p - a) * ab) / length2));
+  return (a + ab * t - p).getLength();
+}
+
+PathVertexIndex::PathVertexIndex(apf::Mesh* m, double cell_size_):
+  mesh(m),
+  cell_size(cell_size_)
+{
+  assert(cell_size > 0);
+  rebuild();
+}
+
+void PathVertexIndex::rebuild()
+{
+  buckets.clear();
+  num_vertices = 0;
+  for (int d = 0; d < 3; ++d) {
+    cell_lo[d] = 0;
+    cell_hi[d] = -1;
+  }
+  apf::MeshIterator* vertices = mesh->begin(0);
+  apf::MeshEntity* vertex;
+  while ((vertex = mesh->iterate(vertices))) {
+    Vertex entry;
+    entry.entity = vertex;
+    mesh->getPoint(vertex, 0, entry.point);
+    long cell[3];
+    for (int d = 0; d < 3; ++d) {
+      cell[d] = cellIndex(entry.point[d]);
+      if (num_vertices == 0 || cell[d] < cell_lo[d]) cell_lo[d] = cell[d];
+      if (num_vertices == 0 || cell[d] > cell_hi[d]) cell_hi[d] = cell[d];
+    }
+    buckets[cellKey(cell[0], cell[1], cell[2])].push_back(entry);
+    ++num_vertices;
+  }
+  mesh->end(vertices);
+}
+
+long PathVertexIndex::cellIndex(double x) const
+{
+  return static_cast<long>(std::floor(x / cell_size));
+}
+
+/* 21 bits per direction; distant cells may share a key, which only
+   adds candidates that the callers filter by distance anyway. */
+unsigned long long PathVertexIndex::cellKey(long i, long j, long k)
+{
+  unsigned long long const mask = (1ULL << 21) - 1;
+  return ((static_cast<unsigned long long>(i) & mask) << 42) |
+         ((static_cast<unsigned long long>(j) & mask) << 21) |
+         (static_cast<unsigned long long>(k) & mask);
+}
+
+void PathVertexIndex::collectNearSegment(
+    apf::Vector3 const& a, apf::Vector3 const& b,
+    double radius, std::vector<Vertex>& out) const
+{
+  /* there is nothing to find outside of the cells spanned by the mesh */
+  long lo[3], hi[3];
+  for (int d = 0; d < 3; ++d) {
+    lo[d] = std::max(cell_lo[d], cellIndex(std::min(a[d], b[d]) - radius));
+    hi[d] = std::min(cell_hi[d], cellIndex(std::max(a[d], b[d]) + radius));
+  }
+  /* skip the cells of the bounding box that are outside the capsule */
+  double const cell_reach = radius + 0.5 * std::sqrt(3.0) * cell_size;
+  for (long i = lo[0]; i <= hi[0]; ++i)
+  for (long j = lo[1]; j <= hi[1]; ++j)
+  for (long k = lo[2]; k <= hi[2]; ++k) {
+    apf::Vector3 center((i + 0.5) * cell_size,
+                        (j + 0.5) * cell_size,
+                        (k + 0.5) * cell_size);
+    if (getSegmentDistance(a, b, center) > cell_reach)
+      continue;
+    auto it = buckets.find(cellKey(i, j, k));
+    if (it != buckets.end())
+      out.insert(out.end(), it->second.begin(), it->second.end());
+  }
+}
+
+static bool compareEntities(PathVertexIndex::Vertex const& a,
+    PathVertexIndex::Vertex const& b)
+{
+  return std::less<apf::MeshEntity*>()(a.entity, b.entity);
+}
+
+static bool sameEntity(PathVertexIndex::Vertex const& a,
+    PathVertexIndex::Vertex const& b)
+{
+  return a.entity == b.entity;
+}
+
+bool PathVertexIndex::findNearest(apf::Vector3 const& point,
+    Vertex& nearest) const
+{
+  if (num_vertices == 0)
+    return false;
+  std::vector<Vertex> near;
+  for (double radius = cell_size; ; radius *= 2.0) {
+    near.clear();
+    collectNearSegment(point, point, radius, near);
+    /* cell key collisions may visit a bucket twice */
+    std::sort(near.begin(), near.end(), compareEntities);
+    near.erase(std::unique(near.begin(), near.end(), sameEntity), near.end());
+    double nearest_distance = 0.0;
+    bool found = false;
+    for (auto const& vertex : near) {
+      double distance = (vertex.point - point).getLength();
+      if (!found || distance < nearest_distance) {
+        nearest = vertex;
+        nearest_distance = distance;
+        found = true;
+      }
+    }
+    /* every vertex within radius has been visited, so a vertex this close
+       is the nearest one; once all the vertices have been visited, so is
+       the closest of them */
+    if (found && (nearest_distance <= radius || near.size() >= num_vertices))
+      return true;
+  }
+}
+
 struct SampledSize {
   double constant_value;
 };
 
-static SampledSize sampleSizeAtOldPoint(apf::Mesh* m,
+/* The size at the vertex closest to the old laser position. The closest
+   vertex is normally within a beam radius, but the old point may also lie
+   outside of the local part (or of the mesh): then the search widens. */
+static SampledSize sampleSizeAtOldPoint(
     apf::Field* size_field,
-    apf::Vector3 const& old_point,
-    PathSizeParameters const& parameters)
+    PathVertexIndex const& index,
+    apf::Vector3 const& old_point)
 {
-  apf::MeshIterator* vertices = m->begin(0);
-  apf::MeshEntity* vertex;
-  apf::MeshEntity* closest_vertex = 0;
-  double closest_distance;
-  while ((vertex = m->iterate(vertices))) {
-    apf::Vector3 vertex_point;
-    m->getPoint(vertex, 0, vertex_point);
-    double distance = (vertex_point - old_point).getLength();
-    if (closest_vertex == 0 ||
-        (distance < closest_distance)) {
-      closest_vertex = vertex;
-      closest_distance = distance;
-    }
-  }
-  m->end(vertices);
-  assert(closest_distance < parameters.beam_radius);
-  double closest_value = apf::getScalar(size_field, closest_vertex, 0);
+  PathVertexIndex::Vertex closest;
+  index.findNearest(old_point, closest);
   SampledSize output;
-  output.constant_value = closest_value;
+  output.constant_value = apf::getScalar(size_field, closest.entity, 0);
   return output;
 }
 
-static void applySizeAlongPath(apf::Mesh* m,
+static void applySizeAlongPath(
     apf::Field* size_field,
+    PathVertexIndex const& index,
     apf::Vector3 const& old_point, apf::Vector3 const& new_point,
     SampledSize const& sampled_size, PathSizeParameters const& parameters)
 {
-  apf::MeshIterator* vertices = m->begin(0);
-  apf::MeshEntity* vertex;
-  apf::LineSegment segment(old_point, new_point);
-  while ((vertex = m->iterate(vertices))) {
-    apf::Vector3 vertex_point;
-    m->getPoint(vertex, 0, vertex_point);
-    double distance = apf::getDistance(segment, vertex_point);
+  std::vector<PathVertexIndex::Vertex> near;
+  index.collectNearSegment(old_point, new_point, parameters.beam_radius, near);
+  for (auto const& vertex : near) {
+    double distance = getSegmentDistance(old_point, new_point, vertex.point);
     if (distance < parameters.beam_radius)
-      apf::setScalar(size_field, vertex, 0, sampled_size.constant_value);
+      apf::setScalar(size_field, vertex.entity, 0, sampled_size.constant_value);
   }
-  m->end(vertices);
 }
 
-void addPredictedLaserSizeField(apf::Mesh* m,
+void addPredictedLaserSizeField(apf::Mesh*,
     apf::Field* size_field,
+    PathVertexIndex const& index,
     apf::Vector3 const& old_point, apf::Vector3 const& new_point,
     PathSizeParameters const& parameters)
 {
+  if (index.empty())
+    return;
   SampledSize sampled_size = sampleSizeAtOldPoint(
-      m, size_field, old_point, parameters);
-  applySizeAlongPath(m, size_field, old_point, new_point,
+      size_field, index, old_point);
+  applySizeAlongPath(size_field, index, old_point, new_point,
       sampled_size, parameters);
 }
 
+void addPredictedLaserSizeField(apf::Mesh* m,
+    apf::Field* size_field,
+    apf::Vector3 const& old_point, apf::Vector3 const& new_point,
+    PathSizeParameters const& parameters)
+{
+  PathVertexIndex index(m, parameters.beam_radius);
+  addPredictedLaserSizeField(m, size_field, index, old_point, new_point,
+      parameters);
+}
+
 }
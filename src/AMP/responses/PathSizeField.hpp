@@ -7,6 +7,9 @@
 #ifndef PATH_SIZE_FIELD_HPP
 #define PATH_SIZE_FIELD_HPP
 
+#include <unordered_map>
+#include <vector>
+
 #include <apfMesh.h>
 
 namespace Albany {
@@ -15,7 +18,50 @@ struct PathSizeParameters {
   double beam_radius;
 };
 
+/* Mesh vertices bucketed on a uniform grid, so that the size field updates
+ * only visit the vertices near the laser path instead of the whole mesh.
+ * The index keeps the vertex coordinates: whoever drives the laser steps
+ * should keep one index alive and call rebuild() after each adaptation, as
+ * AAdapt::LaserPathSizeField does. */
+class PathVertexIndex {
+  public:
+    struct Vertex {
+      apf::MeshEntity* entity;
+      apf::Vector3 point;
+    };
+    PathVertexIndex(apf::Mesh* m, double cell_size);
+    void rebuild();
+    bool empty() const { return num_vertices == 0; }
+    /* Appends to out the vertices in the grid cells that intersect the
+     * capsule of the given radius around the segment [a, b]. */
+    void collectNearSegment(apf::Vector3 const& a, apf::Vector3 const& b,
+        double radius, std::vector<Vertex>& out) const;
+    /* The vertex closest to point, wherever it is: the search radius grows
+     * until a vertex is found. Returns false if there are no vertices. */
+    bool findNearest(apf::Vector3 const& point, Vertex& nearest) const;
+  private:
+    typedef std::vector<Vertex> Bucket;
+    long cellIndex(double x) const;
+    static unsigned long long cellKey(long i, long j, long k);
+    apf::Mesh* mesh;
+    double cell_size;
+    std::size_t num_vertices;
+    /* grid cells spanned by the vertices */
+    long cell_lo[3];
+    long cell_hi[3];
+    std::unordered_map<unsigned long long, Bucket> buckets;
+};
+
+void addPredictedLaserSizeField(apf::Mesh* m,
+    apf::Field* size_field,
+    PathVertexIndex const& index,
+    apf::Vector3 const& old_point, apf::Vector3 const& new_point,
+    PathSizeParameters const& parameters);
+
+/* Same, with a temporary index: use the overload above when the size
+ * field is updated at every laser step. */
 void addPredictedLaserSizeField(apf::Mesh* m,
+    apf::Field* size_field,
     apf::Vector3 const& old_point, apf::Vector3 const& new_point,
     PathSizeParameters const& parameters);
 
@@ -995,6 +995,70 @@ void Solver::ComputeMeasure(const std::string& measureType, const double* p,
                                 measure, dmdp, integrationMethod);
 }
 
+//**********************************************************************
+void Solver::ComputeMeasures(const std::string& measureType,
+                             const std::vector<const double*>& ps,
+                             std::vector<double>& measures,
+                             const std::string& integrationMethod)
+//**********************************************************************
+{
+  // Each candidate topology is filtered and communicated separately, but the
+  // mesh pass and the global reduction are shared by all candidates.
+  Albany::StateManager& stateMgr = m_subProblems[0].app->getStateMgr();
+  
+  const auto& wsElNodeID = stateMgr.getDiscretization()->getWsElNodeID();
+
+  const int numWorksets = wsElNodeID.size();
+  const int ntopos = m_topologyInfoStructs.size();
+  const int ncands = ps.size();
+
+  auto indexer = Albany::createGlobalLocalIndexer(m_localNodeVS);
+
+  for (int icand=m_candidateOverlapVectors.size(); icand<ncands; ++icand) {
+    std::vector<Teuchos::RCP<Thyra_Vector> > overlapVecs(ntopos);
+    for (int itopo=0; itopo<ntopos; ++itopo) {
+      overlapVecs[itopo] = Thyra::createMember(m_topologyInfoStructs[itopo]->overlapVector->space());
+    }
+    m_candidateOverlapVectors.push_back(overlapVecs);
+  }
+
+  std::vector<std::vector<Teuchos::RCP<TopologyStruct> > > candidateStructs(ncands);
+  for (int icand=0; icand<ncands; ++icand) {
+    const double* p = ps[icand];
+    candidateStructs[icand].resize(ntopos);
+    for (int itopo=0; itopo<ntopos; ++itopo) {
+
+      Teuchos::RCP<Thyra_Vector> topoVec = m_topologyInfoStructs[itopo]->localVector;
+      Teuchos::ArrayRCP<double> ltopo = Albany::getNonconstLocalData(topoVec);
+      const int numLocalNodes = ltopo.size();
+      const int offset = itopo*numLocalNodes;
+      for (int ws=0; ws<numWorksets; ++ws) {
+        const int numCells = wsElNodeID[ws].size();
+        const int numNodes = wsElNodeID[ws][0].size();
+        for (int cell=0; cell<numCells; ++cell) {
+          for (int node=0; node<numNodes; ++node) {
+            const int gid = wsElNodeID[ws][cell][node];
+            if (indexer->isLocallyOwnedElement(gid)) {
+              const int lid = indexer->getLocalElement(gid);
+              ltopo[lid] = p[lid+offset];
+            }
+          }
+        }
+      }
+      smoothTopology(m_topologyInfoStructs[itopo]);
+
+      Teuchos::RCP<Thyra_Vector> overlapTopoVec = m_candidateOverlapVectors[icand][itopo];
+      m_cas_manager->scatter(topoVec,overlapTopoVec,Albany::CombineMode::INSERT);
+
+      candidateStructs[icand][itopo] = Teuchos::rcp(new TopologyStruct());
+      candidateStructs[icand][itopo]->topology = m_topologyInfoStructs[itopo]->topology;
+      candidateStructs[icand][itopo]->dataVector = overlapTopoVec;
+    }
+  }
+
+  m_atoProblem->ComputeMeasures(measureType, candidateStructs, measures, integrationMethod);
+}
+
 //**********************************************************************
 void Solver::ComputeVolume(double* p, const double* dfdp, 
                            double& v, double threshhold, double minP)
@@ -99,6 +99,8 @@ public:
   void ComputeMeasure(const std::string& measureType, const double* p,
                       double& measure, double* dmdp, const std::string& integrationMethod) override;
   void ComputeMeasure(const std::string& measureType, double& measure) override;
+  void ComputeMeasures(const std::string& measureType, const std::vector<const double*>& ps,
+                       std::vector<double>& measures, const std::string& integrationMethod) override;
   int GetNumOptDofs() const override;
 
 private:
@@ -135,6 +137,10 @@ private:
   };
 
   std::vector<Teuchos::RCP<TopologyInfoStruct> >  m_topologyInfoStructs;
+
+  // overlap topology vectors for each candidate of a batched measure evaluation
+  // (indexed as [candidate][topology]). Grown on demand and reused.
+  std::vector<std::vector<Teuchos::RCP<Thyra_Vector> > >  m_candidateOverlapVectors;
   Teuchos::RCP<TopologyArray>                     m_topologyArray;
 
   // currently all topologies must have the same entity type
@@ -297,6 +297,10 @@ void OptimizationProblem::InitTopOpt()
 
   weighted_measure.resize(numWorksets);
 
+  // worksets and cell coordinates may have changed since the last call
+  for(auto& integrator : conformalIntegrators)
+    if( integrator != Teuchos::null ) integrator->clearCache();
+
   if(isNonconformal){
     for(int ws=0; ws<numWorksets; ws++){
       Albany::StateArray& 
@@ -815,6 +819,113 @@ computeMeasure (const std::string& measureType,
 }
 
 
+/******************************************************************************/
+void OptimizationProblem::
+ComputeMeasures (const std::string& measureType, 
+                 const std::vector<std::vector<Teuchos::RCP<TopologyStruct>>>& candidateStructs,
+                 std::vector<double>& measures,
+                 const std::string& strIntegrationMethod)
+{
+  if(strIntegrationMethod == "Gauss Quadrature") {
+    computeMeasures(measureType, candidateStructs, measures);
+  } else {
+    // conformal integration is done one candidate at a time
+    int nCandidates = candidateStructs.size();
+    measures.resize(nCandidates);
+    for(int icand=0; icand<nCandidates; icand++)
+      ComputeMeasure(measureType, candidateStructs[icand], measures[icand], 
+                     nullptr, strIntegrationMethod);
+  }
+}
+
+/******************************************************************************/
+void OptimizationProblem::
+computeMeasures (const std::string& measureType, 
+                 const std::vector<std::vector<Teuchos::RCP<TopologyStruct>>>& candidateStructs,
+                 std::vector<double>& measures)
+{
+  const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+        wsElNodeID = disc->getWsElNodeID();
+  int numWorksets = wsElNodeID.size();
+
+  int nCandidates = candidateStructs.size();
+  measures.assign(nCandidates, 0.0);
+  if(nCandidates == 0) return;
+
+  if(isNonconformal){
+    for(int ws=0; ws<numWorksets; ws++){
+      Albany::StateArray&
+      stateArrayRef = stateMgr->getStateArray(Albany::StateManager::ELEM, ws);
+      Albany::MDArray savedWeights = stateArrayRef["Weights"];
+      int numCells  = weighted_measure[ws].extent(0);
+      int numQPs    = weighted_measure[ws].extent(1);
+      for(int cell=0; cell<numCells; cell++)
+        for(int qp=0; qp<numQPs; qp++)
+          weighted_measure[ws](cell,qp) = savedWeights(cell,qp);
+    }
+  }
+
+  std::vector<double> localm(nCandidates, 0.0);
+  const Albany::WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const Albany::WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+
+  // all candidates share the topology objects; only the nodal values differ
+  Teuchos::Array<Teuchos::RCP<Topology> > topologies(nTopologies);
+  for(int itopo=0; itopo<nTopologies; itopo++)
+    topologies[itopo] = candidateStructs[0][itopo]->topology;
+
+  std::vector<std::vector<Teuchos::ArrayRCP<const double>>> topoValues(nCandidates);
+  for(int icand=0; icand<nCandidates; icand++){
+    topoValues[icand].resize(nTopologies);
+    for(int itopo=0; itopo<nTopologies; itopo++)
+      topoValues[icand][itopo] = Albany::getLocalData(candidateStructs[icand][itopo]->dataVector.getConst());
+  }
+
+  Teuchos::Array<double> pVals(nTopologies);
+  std::vector<LO> lids;
+
+  Teuchos::RCP<BlockMeasureMap> measureModel = measureModels.at(measureType);
+  auto indexer = Albany::createGlobalLocalIndexer(overlapNodeVs);
+
+  for(int ws=0; ws<numWorksets; ws++){
+
+    int physIndex = wsPhysIndex[ws];
+    int numNodes  = basisAtQPs[physIndex].extent(0);
+    int numCells  = weighted_measure[ws].extent(0);
+    int numQPs    = weighted_measure[ws].extent(1);
+
+    std::string blockName = wsEBNames[ws];
+
+    if(measureModel->find(blockName) == measureModel->end()) {
+      continue;
+    }
+
+    Teuchos::RCP<MeasureModel> blockMeasureModel = measureModel->at(blockName);
+
+    lids.resize(numNodes);
+    for(int cell=0; cell<numCells; cell++){
+      for(int node=0; node<numNodes; node++)
+        lids[node] = indexer->getLocalElement(wsElNodeID[ws][cell][node]);
+
+      for(int qp=0; qp<numQPs; qp++){
+        double weight = weighted_measure[ws](cell,qp);
+        for(int icand=0; icand<nCandidates; icand++){
+          for(int itopo=0; itopo<nTopologies; itopo++) pVals[itopo]=0.0;
+          for(int node=0; node<numNodes; node++){
+            for(int itopo=0; itopo<nTopologies; itopo++) {
+              pVals[itopo] += topoValues[icand][itopo][lids[node]]*basisAtQPs[physIndex](node,qp);
+            }
+          }
+          localm[icand] += blockMeasureModel->Evaluate(pVals, topologies)*weight;
+        }
+      }
+    }
+  }
+
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, nCandidates, localm.data(), measures.data());
+}
+
+
 /******************************************************************************/
 void OptimizationProblem::
 computeConformalMeasure (const std::string& measureType, 
@@ -865,7 +976,7 @@ computeConformalMeasure (const std::string& measureType,
     int numQPs    = weighted_measure[ws].extent(1);
     int numDims   = cubatures[physIndex]->getDimension();
 
-    SubIntegrator myDicer(cellTypes[physIndex],intrepidBasis[physIndex],/*maxRefs=*/1,/*maxErr=*/1e-5);
+    SubIntegrator& myDicer = getConformalIntegrator(ws);
 
     coordCon = Kokkos::DynRankView<RealType, PHX::Device>("coordCon", numNodes, numDims);
     topoVals = Kokkos::DynRankView<RealType, PHX::Device>("topoVals", numNodes);
@@ -899,10 +1010,10 @@ computeConformalMeasure (const std::string& measureType,
       double weight=0.0;
       if(dmdp != nullptr ){
         myDicer.getMeasure(weight, topoVals, coordCon, 
-                           materialTopology->getInterfaceValue(), Sense::Positive);
+                           materialTopology->getInterfaceValue(), Sense::Positive, cell);
       } else {
         myDicer.getMeasure(weight, dMdtopo, topoVals, coordCon, 
-                           materialTopology->getInterfaceValue(), Sense::Positive);
+                           materialTopology->getInterfaceValue(), Sense::Positive, cell);
       }
 
       double totalWeight = 0.0;
@@ -966,6 +1077,21 @@ computeConformalMeasure (const std::string& measureType,
   }
 }
 
+/******************************************************************************/
+SubIntegrator& OptimizationProblem::
+getConformalIntegrator (int ws)
+{
+  if( ws >= int(conformalIntegrators.size()) )
+    conformalIntegrators.resize(ws+1);
+
+  if( conformalIntegrators[ws] == Teuchos::null ){
+    int physIndex = disc->getWsPhysIndex()[ws];
+    conformalIntegrators[ws] = Teuchos::rcp(
+      new SubIntegrator(cellTypes[physIndex],intrepidBasis[physIndex],/*maxRefs=*/1,/*maxErr=*/1e-5));
+  }
+  return *conformalIntegrators[ws];
+}
+
 /******************************************************************************/
 void OptimizationProblem::
 computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topologyStructs,
@@ -1005,7 +1131,7 @@ computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topolog
     int numCells  = weighted_measure[ws].extent(0);
     int numDims   = cubatures[physIndex]->getDimension();
 
-    SubIntegrator myDicer(cellTypes[physIndex],intrepidBasis[physIndex],/*maxRefs=*/1,/*maxErr=*/1e-5);
+    SubIntegrator& myDicer = getConformalIntegrator(ws);
 
     coordCon = Kokkos::DynRankView<RealType, PHX::Device>("coordCon", numNodes, numDims);  //inefficient, reallocating memory. 
     topoVals = Kokkos::DynRankView<RealType, PHX::Device>("topoVals", numNodes);   //inefficient, reallocating memory. 
@@ -1023,14 +1149,14 @@ computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topolog
       if( dvdp == nullptr ){
         double weight=0.0;
         myDicer.getMeasure(weight, topoVals, coordCon, 
-                           topology->getInterfaceValue(), Sense::Positive);
+                           topology->getInterfaceValue(), Sense::Positive, cell);
         localv += weight;
 
       } else { 
 
         double weight=0.0;
         myDicer.getMeasure(weight, dMdtopo, topoVals, coordCon, 
-                           topology->getInterfaceValue(), Sense::Positive);
+                           topology->getInterfaceValue(), Sense::Positive, cell);
         localv += weight;
 
         for(int node=0; node<numNodes; node++){
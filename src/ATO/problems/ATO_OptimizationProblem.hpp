@@ -20,6 +20,7 @@ namespace ATO {
 
 // ATO forward declarations
 class MeasureModel;
+class SubIntegrator;
 class Topology;
 
 using BlockMeasureMap = std::unordered_map<std::string, Teuchos::RCP<MeasureModel>>;
@@ -42,6 +43,15 @@ public:
                        const std::vector<Teuchos::RCP<TopologyStruct>>& topologyStructs,
                        double& v, double* dvdp = nullptr);
 
+  void ComputeMeasures (const std::string& measure, 
+                        const std::vector<std::vector<Teuchos::RCP<TopologyStruct>>>& candidateStructs,
+                        std::vector<double>& v,
+                        const std::string& strIntegrationMethod = "Gauss Quadrature");
+
+  void computeMeasures (const std::string& measure, 
+                        const std::vector<std::vector<Teuchos::RCP<TopologyStruct>>>& candidateStructs,
+                        std::vector<double>& v);
+
   void computeConformalVolume (const std::vector<Teuchos::RCP<TopologyStruct>>& topologyStructs,
                                double& m, double* dmdp);
 
@@ -51,8 +61,12 @@ public:
 
   void ComputeMeasure (const std::string& measure, double& v);
 
+  SubIntegrator& getConformalIntegrator (int ws);
+
+  // The conformal integrators cache the cell geometry of the discretization
   void setDiscretization(Teuchos::RCP<Albany::AbstractDiscretization> _disc) {
      disc = _disc;
+     conformalIntegrators.clear();
   }
 
   void setCommunicator(const Teuchos::RCP<const Teuchos_Comm>& _comm) {
@@ -100,6 +114,9 @@ protected:
   int nTopologies;
 
   bool isNonconformal;
+
+  // one integrator per workset so cell geometry is cached across design iterations
+  std::vector<Teuchos::RCP<SubIntegrator> > conformalIntegrators;
 };
 
 class MeasureModel
@@ -117,18 +117,29 @@ class SubIntegrator
                 uint maxRefs, RealType maxErr);
   virtual ~SubIntegrator(){};
 
+  // If cellIndex is non-negative, the geometry of the cell's subsimplices is
+  // cached and reused on subsequent calls with the same cellIndex.  The cell
+  // coordinates are then assumed not to change until clearCache() is called.
+  // Cells whose nodal level set values all have the same sign are not cut,
+  // and return the cached cell measure (or zero) without visiting the
+  // subsimplices.
   void getMeasure(RealType& measure, 
-                  const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                  const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   RealType zeroVal,
-                  Sense sense);
+                  Sense sense,
+                  int cellIndex = -1);
 
   void getMeasure(RealType& measure, 
                   Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
-                  const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                  const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
                   RealType zeroVal,
-                  Sense sense);
+                  Sense sense,
+                  int cellIndex = -1);
+
+  // Drops the cached cell geometry.  Call when the mesh or its worksets change.
+  void clearCache(){ cellVolumes.clear(); cellIsCached.clear(); }
 
   void getCubature(std::vector<std::vector<RealType> >& refPoints, std::vector<RealType>& weights, 
                    const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
@@ -181,6 +192,33 @@ class SubIntegrator
   void Refine( std::vector<Simplex<V,P> >& inpolys,
                std::vector<Simplex<V,P> >& outpolys);
 
+  // Table-driven path used when no refinement is requested (maxRefinements <= 1).
+  // The basis is tabulated at the vertices of the parent subsimplices at 
+  // construction, and cut subsimplices are integrated in closed form.
+  // The cached volumes of a cell are its subsimplex volumes followed by their sum.
+  enum { MaxSimplexVerts = 4, MaxSubSimplices = 24 };
+  typedef Sacado::Fad::SFad<RealType,MaxSimplexVerts> SimplexFadType;
+
+  RealType cutMeasure(const Kokkos::DynRankView<RealType, PHX::Device>& topoVals,
+                      const Kokkos::DynRankView<RealType, PHX::Device>& coordCon,
+                      RealType zeroVal, Sense sense, int cellIndex,
+                      Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo);
+
+  const RealType* getSimplexVolumes(const Kokkos::DynRankView<RealType, PHX::Device>& coordCon,
+                                    int cellIndex);
+
+  template<typename T>
+  T cutFraction(const T* f) const;
+
+  uint nBasis;
+  uint nSubSimplices;
+  uint nSimplexVerts;
+  std::vector<RealType> simplexBasis;   // (subsimplex, vertex, node)
+  bool nonnegativeBasis;                // uncut iff all nodal signs agree
+  RealType scratchVolumes[MaxSubSimplices+1];
+  std::vector<RealType> cellVolumes;    // (cell, subsimplex+1)
+  std::vector<char> cellIsCached;
+
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > basis;
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, DFadType, DFadType> > DFadBasis;
 
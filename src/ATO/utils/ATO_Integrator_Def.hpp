@@ -58,10 +58,15 @@ void ATO::SubIntegrator::getMeasure(
      RealType& measure, 
      const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
      const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
-     const RealType zeroVal, Sense sense)
+     const RealType zeroVal, Sense sense, int cellIndex)
 //******************************************************************************//
 {
 
+  if( maxRefinements <= 1 ){
+    measure = cutMeasure(topoVals, coordCon, zeroVal, sense, cellIndex, nullptr);
+    return;
+  }
+
   measure = 0.0;
   RealType volumeChange = 1e6;
   RealType tolerance(maxError);
@@ -107,9 +112,14 @@ void ATO::SubIntegrator::getMeasure(
      Kokkos::DynRankView<RealType, PHX::Device>& dMdtopo,
      const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
      const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
-     const RealType zeroVal, Sense sense)
+     const RealType zeroVal, Sense sense, int cellIndex)
 //******************************************************************************//
 {
+
+  if( maxRefinements <= 1 ){
+    measure = cutMeasure(topoVals, coordCon, zeroVal, sense, cellIndex, &dMdtopo);
+    return;
+  }
   
   measure = 0.0;
   DFadType volumeChange = 1e6;
@@ -168,6 +178,168 @@ void ATO::SubIntegrator::getMeasure(
   }
 
 }
+//******************************************************************************//
+RealType ATO::SubIntegrator::cutMeasure(
+     const Kokkos::DynRankView<RealType, PHX::Device>& topoVals, 
+     const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, 
+     RealType zeroVal, Sense sense, int cellIndex,
+     Kokkos::DynRankView<RealType, PHX::Device>* dMdtopo)
+//******************************************************************************//
+{
+  const RealType* volumes = getSimplexVolumes(coordCon, cellIndex);
+
+  if( dMdtopo != nullptr ){
+    if( dMdtopo->extent(0) != nBasis )
+      *dMdtopo = Kokkos::DynRankView<RealType, PHX::Device>("dMdtopo", nBasis);
+    for(uint I=0; I<nBasis; I++) (*dMdtopo)(I) = 0.0;
+  }
+
+  // the region is where sign*(topoVal - zeroVal) >= 0
+  const RealType sign = (sense == Sense::Positive) ? 1.0 : -1.0;
+
+  // With a nonnegative partition of unity the subsimplex vertex values are 
+  // convex combinations of the nodal values, so a cell whose nodal values all
+  // have the same sign is not cut.
+  if( nonnegativeBasis ){
+    bool inside = true, outside = true;
+    for(uint I=0; I<nBasis; I++){
+      if( sign*(topoVals(I) - zeroVal) >= 0.0 ) outside = false; else inside = false;
+    }
+    if( outside ) return 0.0;
+    if( inside ) return volumes[nSubSimplices];
+  }
+
+  RealType measure = 0.0;
+  for(uint isub=0; isub<nSubSimplices; isub++){
+    const RealType* N = &simplexBasis[isub*nSimplexVerts*nBasis];
+
+    RealType f[MaxSimplexVerts];
+    bool inside = true, outside = true;
+    for(uint v=0; v<nSimplexVerts; v++){
+      RealType val = 0.0;
+      for(uint I=0; I<nBasis; I++) val += N[v*nBasis+I]*topoVals(I);
+      f[v] = sign*(val - zeroVal);
+      if( f[v] >= 0.0 ) outside = false; else inside = false;
+    }
+
+    // uncut subsimplices have no sensitivity to the topology
+    if( outside ) continue;
+    if( inside ){ measure += volumes[isub]; continue; }
+
+    if( dMdtopo == nullptr ){
+      measure += volumes[isub]*cutFraction(f);
+    } else {
+      SimplexFadType fFad[MaxSimplexVerts];
+      for(uint v=0; v<nSimplexVerts; v++) fFad[v] = SimplexFadType(MaxSimplexVerts, v, f[v]);
+      SimplexFadType frac = cutFraction(fFad);
+      measure += volumes[isub]*frac.val();
+      for(uint v=0; v<nSimplexVerts; v++){
+        RealType dMdf = sign*volumes[isub]*frac.dx(v);
+        for(uint I=0; I<nBasis; I++) (*dMdtopo)(I) += dMdf*N[v*nBasis+I];
+      }
+    }
+  }
+  return measure;
+}
+
+//******************************************************************************//
+const RealType* ATO::SubIntegrator::getSimplexVolumes(
+     const Kokkos::DynRankView<RealType, PHX::Device>& coordCon, int cellIndex)
+//******************************************************************************//
+{
+  RealType* volumes = scratchVolumes;
+  if( cellIndex >= 0 ){
+    if( uint(cellIndex) >= cellIsCached.size() ){
+      cellIsCached.resize(cellIndex+1, 0);
+      cellVolumes.resize((cellIndex+1)*(nSubSimplices+1));
+    }
+    volumes = &cellVolumes[cellIndex*(nSubSimplices+1)];
+    if( cellIsCached[cellIndex] ) return volumes;
+    cellIsCached[cellIndex] = 1;
+  }
+
+  volumes[nSubSimplices] = 0.0;
+  for(uint isub=0; isub<nSubSimplices; isub++){
+    const RealType* N = &simplexBasis[isub*nSimplexVerts*nBasis];
+    RealType x[MaxSimplexVerts][3] = {};
+    for(uint v=0; v<nSimplexVerts; v++)
+      for(uint d=0; d<nDims; d++)
+        for(uint I=0; I<nBasis; I++)
+          x[v][d] += N[v*nBasis+I]*coordCon(I,d);
+
+    RealType detj = 0.0;
+    if( nSimplexVerts == 4 ){
+      RealType j11 = x[1][0]-x[0][0], j12 = x[2][0]-x[0][0], j13 = x[3][0]-x[0][0];
+      RealType j21 = x[1][1]-x[0][1], j22 = x[2][1]-x[0][1], j23 = x[3][1]-x[0][1];
+      RealType j31 = x[1][2]-x[0][2], j32 = x[2][2]-x[0][2], j33 = x[3][2]-x[0][2];
+      detj = (-j13*j22*j31+j12*j23*j31+j13*j21*j32-j11*j23*j32-j12*j21*j33+j11*j22*j33)/6.0;
+    } else {
+      detj = ((x[1][0]-x[0][0])*(x[2][1]-x[0][1]) - (x[2][0]-x[0][0])*(x[1][1]-x[0][1]))/2.0;
+    }
+    volumes[isub] = (detj < 0.0) ? -detj : detj;
+    volumes[nSubSimplices] += volumes[isub];
+  }
+  return volumes;
+}
+
+//******************************************************************************//
+template<typename T>
+T ATO::SubIntegrator::cutFraction(const T* f) const
+//******************************************************************************//
+{
+  // Volume fraction of the simplex where the linearly interpolated f is >= 0.
+  // The denominators below always pair vertices of opposite sign, so they
+  // never vanish.
+
+  uint in[MaxSimplexVerts], out[MaxSimplexVerts];
+  uint nin = 0, nout = 0;
+  for(uint i=0; i<nSimplexVerts; i++){
+    if( f[i] >= 0.0 ) in[nin++] = i; else out[nout++] = i;
+  }
+  if( nout == 0 ) return T(1.0);
+  if( nin == 0 ) return T(0.0);
+
+  // one vertex isolated:  the corner it cuts off is a scaled copy of the simplex
+  if( nin == 1 || nout == 1 ){
+    uint a = (nin == 1) ? in[0] : out[0];
+    T frac = 1.0;
+    for(uint i=0; i<nSimplexVerts; i++)
+      if( i != a ) frac *= f[a]/(f[a]-f[i]);
+    if( nin == 1 ) return frac;
+    return T(1.0-frac);
+  }
+
+  // two vertices on either side of a tet:  the inside region is a prism with
+  // triangles (a0, p(a0,b0), p(a0,b1)) and (a1, p(a1,b0), p(a1,b1)).  Work in
+  // the reference tet (vertex i at e_i) where the full volume is 1/6.
+  T r[6][3];
+  for(uint k=0; k<2; k++){
+    uint a = in[k];
+    for(uint d=0; d<3; d++) r[3*k][d] = (a > 0 && d == a-1) ? 1.0 : 0.0;
+    for(uint m=0; m<2; m++){
+      uint b = out[m];
+      T t = f[a]/(f[a]-f[b]);
+      for(uint d=0; d<3; d++){
+        RealType ra = (a > 0 && d == a-1) ? 1.0 : 0.0;
+        RealType rb = (b > 0 && d == b-1) ? 1.0 : 0.0;
+        r[3*k+1+m][d] = ra + t*(rb-ra);
+      }
+    }
+  }
+
+  const uint prism[3][4] = {{0,1,2,5},{0,1,4,5},{0,3,4,5}};
+  T frac = 0.0;
+  for(uint itet=0; itet<3; itet++){
+    const uint* t = prism[itet];
+    T j11 = r[t[1]][0]-r[t[0]][0], j12 = r[t[2]][0]-r[t[0]][0], j13 = r[t[3]][0]-r[t[0]][0];
+    T j21 = r[t[1]][1]-r[t[0]][1], j22 = r[t[2]][1]-r[t[0]][1], j23 = r[t[3]][1]-r[t[0]][1];
+    T j31 = r[t[1]][2]-r[t[0]][2], j32 = r[t[2]][2]-r[t[0]][2], j33 = r[t[3]][2]-r[t[0]][2];
+    T detj = -j13*j22*j31+j12*j23*j31+j13*j21*j32-j11*j23*j32-j12*j21*j33+j11*j22*j33;
+    if( detj < 0.0 ) frac -= detj; else frac += detj;
+  }
+  return frac;
+}
+
 //******************************************************************************//
 template<typename V, typename P>
 void ATO::SubIntegrator::Refine( 
@@ -1168,6 +1340,31 @@ uint _maxRefs, RealType _maxErr):
     // error out
   }
 
+  // tabulate the basis at the vertices of the parent subsimplices
+  nBasis = basis->getCardinality();
+  nSubSimplices = refinement[0].size();
+  nSimplexVerts = (nSubSimplices > 0) ? refinement[0][0].points.size() : 0;
+  if( nSubSimplices > 0 ){
+    const uint nPoints = nSubSimplices*nSimplexVerts;
+    Kokkos::DynRankView<RealType, PHX::Device> evalPoints("evalPoints", nPoints, nDims);
+    Kokkos::DynRankView<RealType, PHX::Device> Nvals("Nvals", nBasis, nPoints);
+    for(uint isub=0; isub<nSubSimplices; isub++)
+      for(uint v=0; v<nSimplexVerts; v++)
+        for(uint idim=0; idim<nDims; idim++)
+          evalPoints(isub*nSimplexVerts+v, idim) = refinement[0][isub].points[v](idim);
+    basis->getValues(Nvals, evalPoints, Intrepid2::OPERATOR_VALUE);
+
+    simplexBasis.resize(nPoints*nBasis);
+    for(uint ipt=0; ipt<nPoints; ipt++)
+      for(uint I=0; I<nBasis; I++)
+        simplexBasis[ipt*nBasis+I] = Nvals(I,ipt);
+  }
+
+  // the uncut cell test in cutMeasure needs nonnegative values at the vertices
+  nonnegativeBasis = true;
+  for(uint i=0; i<simplexBasis.size(); i++)
+    if( simplexBasis[i] < 0.0 ) nonnegativeBasis = false;
+
   DFadRefinement.resize(1);
   uint nPoly = refinement[0].size();
   DFadRefinement[0].resize(nPoly);
@@ -9,6 +9,7 @@
 
 #include <Teuchos_Array.hpp>
 #include <string>
+#include <vector>
 
 namespace ATO {
 
@@ -34,6 +35,19 @@ public:
     ComputeMeasure(measureType, p, measure, dmdp, "Gauss Quadrature");
   }
 
+  // Evaluate the measure for several candidate topologies at once.  The default
+  // implementation simply loops over the candidates; implementations that can
+  // integrate all candidates in a single mesh pass and reduction should override.
+  virtual void ComputeMeasures(const std::string& measureType,
+                               const std::vector<const double*>& ps,
+                               std::vector<double>& measures,
+                               const std::string& integrationMethod) {
+    measures.resize(ps.size());
+    for (std::size_t i=0; i<ps.size(); ++i) {
+      ComputeMeasure(measureType, ps[i], measures[i], nullptr, integrationMethod);
+    }
+  }
+
   virtual void InitializeOptDofs(double* p) = 0;
   virtual void getOptDofsLowerBound (Teuchos::Array<double>& b) const = 0;
   virtual void getOptDofsUpperBound (Teuchos::Array<double>& b) const = 0;
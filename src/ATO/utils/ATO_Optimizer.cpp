@@ -14,6 +14,7 @@
 #endif //ATO_USES_NLOPT
 
 #include <algorithm>
+#include <limits>
 #include <list>
 
 namespace ATO {
@@ -96,6 +97,8 @@ Optimizer(optimizerParams)
   dfdp = nullptr;
   dgdp = nullptr;
   dmdp = nullptr;
+  _multiplier = 0.0;
+  _measurePasses = 0;
 
   _moveLimit     = optimizerParams.get<double>("Move Limiter");
   _stabExponent  = optimizerParams.get<double>("Stabilization Parameter");
@@ -128,6 +131,11 @@ Optimizer(optimizerParams)
     } else {
       _useNewtonSearch = true;
     }
+    if (measureParams.isType<int>("Candidates Per Pass") ) {
+      _measureCandidates = measureParams.get<int>("Candidates Per Pass");
+    } else {
+      _measureCandidates = 1;
+    }
   } else {
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
                                "Error! Missing 'Measure Enforcement' ParameterList.\n");
@@ -726,6 +734,11 @@ Optimizer_OC::computeUpdatedTopology()
 /******************************************************************************/
 {
 
+  if (_measureCandidates > 1) {
+    computeUpdatedTopologyBatched();
+    return;
+  }
+
   // find multiplier that enforces measure constraint
   Teuchos::Array<double> upperBound, lowerBound;
   solverInterface->getOptDofsUpperBound(upperBound);
@@ -733,6 +746,7 @@ Optimizer_OC::computeUpdatedTopology()
   double vmid, v1=0.0, v2=0.0;
   double residRatio = 0.0;
   int niters=0;
+  _measurePasses = 0;
 
   double dfdp_tot = 0.0, dmdp_tot = 0.0;
   for (int i=0; i<numOptDofs; i++) {
@@ -758,30 +772,14 @@ Optimizer_OC::computeUpdatedTopology()
 
     // update topology
 
-    for (int i=0; i<numOptDofs; i++) {
-      double be = 0.0;
-      if (dmdp[i] != 0.0 )
-        be = -dfdp[i]/dmdp[i]/vmid;
-      else
-        be = -dfdp[i]/vmid;
-      double p_old = p_last[i];
-      double offset = 0.01*(upperBound[i] - lowerBound[i]) - lowerBound[i];
-      double sign = (be > 0.0) ? 1 : -1;
-      be = (be > 0.0) ? be : -be;
-      double p_new = (p_old+offset)*sign*pow(be,_stabExponent)-offset;
-      // limit change
-      double dval = p_new - p_old;
-      if (fabs(dval) > _moveLimit) { p_new = p_old+fabs(dval)/dval*_moveLimit; }
-      // enforce limits
-      if (p_new < lowerBound[i] ) { p_new = lowerBound[i]; }
-      if (p_new > upperBound[i] ) { p_new = upperBound[i]; }
-      p[i] = p_new;
-    }
+    computeTopology(vmid, p, lowerBound, upperBound);
+    _multiplier = vmid;
 
     // compute new measure
     if (_useNewtonSearch) {
       double prevResidual = measure - _measureConstraint*_optMeasure;
       solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      _measurePasses++;
       double newResidual = measure - _measureConstraint*_optMeasure;
       if (newResidual > 0.0) {
         residRatio = newResidual/prevResidual;
@@ -793,6 +791,7 @@ Optimizer_OC::computeUpdatedTopology()
       }
     } else {
       solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      _measurePasses++;
       double newResidual = measure - _measureConstraint*_optMeasure;
       if (newResidual > 0.0) {
         v1 = vmid;
@@ -817,27 +816,11 @@ Optimizer_OC::computeUpdatedTopology()
     double lambda = (residRatio*v2 - v1)/(residRatio-1.0);
     double epsilon = lambda*1e-5;
     if (lambda > 0.0 ) do {
-      for (int i=0; i<numOptDofs; i++) {
-        double be = 0.0;
-        if (dmdp[i] != 0.0 )
-          be = -dfdp[i]/dmdp[i]/lambda;
-        else
-          be = -dfdp[i]/lambda;
-        double p_old = p_last[i];
-        double offset = 0.01*(upperBound[i] - lowerBound[i]) - lowerBound[i];
-        double sign = (be > 0.0) ? 1 : -1;
-        be = (be > 0.0) ? be : -be;
-        double p_new = (p_old+offset)*sign*pow(be,_stabExponent)-offset;
-        // limit change
-        double dval = p_new - p_old;
-        if (fabs(dval) > _moveLimit) p_new = p_old+fabs(dval)/dval*_moveLimit;
-        // enforce limits
-        if (p_new < lowerBound[i] ) p_new = lowerBound[i];
-        if (p_new > upperBound[i] ) p_new = upperBound[i];
-        p[i] = p_new;
-      }
+      computeTopology(lambda, p, lowerBound, upperBound);
+      _multiplier = lambda;
       // compute new measure
       solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      _measurePasses++;
       double f0 =  (measure - _measureConstraint*_optMeasure);
 
       if (comm->getRank()==0) {
@@ -850,27 +833,11 @@ Optimizer_OC::computeUpdatedTopology()
       }
 
       double plambda = lambda+epsilon;
-      for (int i=0; i<numOptDofs; i++) {
-        double be = 0.0;
-        if (dmdp[i] != 0.0 )
-          be = -dfdp[i]/dmdp[i]/plambda;
-        else
-          be = -dfdp[i]/plambda;
-        double p_old = p_last[i];
-        double offset = 0.01*(upperBound[i] - lowerBound[i]) - lowerBound[i];
-        double sign = (be > 0.0) ? 1 : -1;
-        be = (be > 0.0) ? be : -be;
-        double p_new = (p_old+offset)*sign*pow(be,_stabExponent)-offset;
-        // limit change
-        double dval = p_new - p_old;
-        if (fabs(dval) > _moveLimit) p_new = p_old+fabs(dval)/dval*_moveLimit;
-        // enforce limits
-        if (p_new < lowerBound[i] ) p_new = lowerBound[i];
-        if (p_new > upperBound[i] ) p_new = upperBound[i];
-        p[i] = p_new;
-      }
+      computeTopology(plambda, p, lowerBound, upperBound);
+      _multiplier = plambda;
       // compute new measure
       solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      _measurePasses++;
       double f1 =  (measure - _measureConstraint*_optMeasure);
 
       if (f1-f0 == 0.0 ) break;
@@ -890,29 +857,12 @@ Optimizer_OC::computeUpdatedTopology()
         vmid = (v2+v1)/2.0;
     
         // update topology
-        for (int i=0; i<numOptDofs; i++) {
-          double be = 0.0;
-          if (dmdp[i] != 0.0 ) {
-            be = -dfdp[i]/dmdp[i]/vmid;
-          } else {
-            be = -dfdp[i]/vmid;
-          }
-          double p_old = p_last[i];
-          double offset = 0.01*(upperBound[i] - lowerBound[i]) - lowerBound[i];
-          double sign = (be > 0.0) ? 1 : -1;
-          be = (be > 0.0) ? be : -be;
-          double p_new = (p_old+offset)*sign*pow(be,_stabExponent)-offset;
-          // limit change
-          double dval = p_new - p_old;
-          if (fabs(dval) > _moveLimit) { p_new = p_old+fabs(dval)/dval*_moveLimit; }
-          // enforce limits
-          if (p_new < lowerBound[i] ) { p_new = lowerBound[i]; }
-          if (p_new > upperBound[i] ) { p_new = upperBound[i]; }
-          p[i] = p_new;
-        }
+        computeTopology(vmid, p, lowerBound, upperBound);
+        _multiplier = vmid;
     
         // compute new measure
         solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+        _measurePasses++;
         double newResidual = measure - _measureConstraint*_optMeasure;
         if (newResidual > 0.0) {
           v1 = vmid;
@@ -933,6 +883,133 @@ Optimizer_OC::computeUpdatedTopology()
                              "Enforcement of measure constraint failed:  Exceeded max iterations.\n"); 
 }
 
+/******************************************************************************/
+void
+Optimizer_OC::computeUpdatedTopologyBatched()
+/******************************************************************************/
+{
+  // Same search as computeUpdatedTopology(), but each pass evaluates the measure
+  // for _measureCandidates multipliers at once (one mesh pass, one reduction).
+  // The measure varies like a power of the multiplier, so the candidates are
+  // spaced in log(lambda): below the initial upper bound (which overestimates
+  // the multiplier by about three orders of magnitude) until a lower bound is
+  // found, and then across the bracket, with one of them at the secant
+  // estimate in log(lambda).
+
+  Teuchos::Array<double> upperBound, lowerBound;
+  solverInterface->getOptDofsUpperBound(upperBound);
+  solverInterface->getOptDofsLowerBound(lowerBound);
+
+  double dfdp_tot = 0.0, dmdp_tot = 0.0;
+  for (int i=0; i<numOptDofs; i++) {
+    dfdp_tot += dfdp[i];
+    dmdp_tot += dmdp[i];
+  }
+  double g_dfdp_tot = 0.0, g_dmdp_tot = 0.0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &dfdp_tot, &g_dfdp_tot);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &dmdp_tot, &g_dmdp_tot);
+
+  double v1 = 0.0, r1 = 0.0;
+  double v2 = -1000.0* g_dfdp_tot / g_dmdp_tot, r2 = 0.0;
+  bool haveR1 = false, haveR2 = false;
+
+  if (comm->getRank()==0) {
+    std::cout << "Measure enforcement: Target = " << _measureConstraint <<  std::endl;
+    std::cout << "Measure enforcement: Beginning batched search with " 
+              << _measureCandidates << " candidates per pass." <<  std::endl;
+  }
+
+  const double target = _measureConstraint*_optMeasure;
+  const int ncands = _measureCandidates;
+  const double searchDecades = 4.0;
+
+  std::vector<double> pCandidates(ncands*numOptDofs);
+  std::vector<const double*> ps(ncands);
+  for (int icand=0; icand<ncands; icand++) ps[icand] = &pCandidates[icand*numOptDofs];
+  std::vector<double> lambdas(ncands), measures(ncands);
+
+  double bestResid = std::numeric_limits<double>::max();
+  _measurePasses = 0;
+  do {
+    if (!haveR1) {
+      for (int k=0; k<ncands; k++)
+        lambdas[k] = v2*pow(10.0, -searchDecades*(k+1)/ncands);
+    } else {
+      int nspaced = ncands;
+      double x1 = log(v1), x2 = log(v2);
+      if (haveR2 && r1 != r2) {
+        double xsec = x1 - r1*(x2-x1)/(r2-r1);
+        if (xsec > x1 && xsec < x2) {
+          lambdas[0] = exp(xsec);
+          nspaced = ncands-1;
+        }
+      }
+      for (int k=0; k<nspaced; k++)
+        lambdas[ncands-nspaced+k] = exp(x1 + (k+1)*(x2-x1)/(nspaced+1));
+    }
+
+    for (int icand=0; icand<ncands; icand++)
+      computeTopology(lambdas[icand], &pCandidates[icand*numOptDofs], lowerBound, upperBound);
+
+    solverInterface->ComputeMeasures(_measureType, ps, measures, _measureIntMethod);
+    _measurePasses++;
+
+    // the measure decreases with increasing multiplier
+    for (int icand=0; icand<ncands; icand++) {
+      double resid = measures[icand] - target;
+      if (resid > 0.0) {
+        if (lambdas[icand] >= v1) { v1 = lambdas[icand]; r1 = resid; haveR1 = true; }
+      } else {
+        if (lambdas[icand] <= v2) { v2 = lambdas[icand]; r2 = resid; haveR2 = true; }
+      }
+      if (fabs(resid) < bestResid) {
+        bestResid = fabs(resid);
+        _multiplier = lambdas[icand];
+        std::copy(ps[icand], ps[icand]+numOptDofs, p);
+      }
+    }
+
+    if (comm->getRank()==0) {
+      std::cout << "Measure enforcement (pass " << _measurePasses << "): Residual = " 
+                << bestResid/_optMeasure << std::endl;
+    }
+
+  } while ( _measurePasses < _measureMaxIter && bestResid > _measureConvTol*_optMeasure );
+
+  TEUCHOS_TEST_FOR_EXCEPTION(( bestResid > _measureAccpTol*_optMeasure ),
+                             Teuchos::Exceptions::InvalidParameter, 
+                             "Enforcement of measure constraint failed:  Exceeded max iterations.\n"); 
+}
+
+/******************************************************************************/
+void
+Optimizer_OC::computeTopology(double lambda, double* pOut,
+                              const Teuchos::Array<double>& lowerBound,
+                              const Teuchos::Array<double>& upperBound)
+/******************************************************************************/
+{
+  for (int i=0; i<numOptDofs; i++) {
+    double be = 0.0;
+    if (dmdp[i] != 0.0 ) {
+      be = -dfdp[i]/dmdp[i]/lambda;
+    } else {
+      be = -dfdp[i]/lambda;
+    }
+    double p_old = p_last[i];
+    double offset = 0.01*(upperBound[i] - lowerBound[i]) - lowerBound[i];
+    double sign = (be > 0.0) ? 1 : -1;
+    be = (be > 0.0) ? be : -be;
+    double p_new = (p_old+offset)*sign*pow(be,_stabExponent)-offset;
+    // limit change
+    double dval = p_new - p_old;
+    if (fabs(dval) > _moveLimit) { p_new = p_old+fabs(dval)/dval*_moveLimit; }
+    // enforce limits
+    if (p_new < lowerBound[i] ) { p_new = lowerBound[i]; }
+    if (p_new > upperBound[i] ) { p_new = upperBound[i]; }
+    pOut[i] = p_new;
+  }
+}
+
 #ifdef ATO_USES_NLOPT
 /******************************************************************************/
 void
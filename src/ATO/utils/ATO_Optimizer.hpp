@@ -66,6 +66,10 @@ class Optimizer_OC : public Optimizer {
   void Initialize();
  protected:
   void computeUpdatedTopology();
+  void computeUpdatedTopologyBatched();
+  void computeTopology(double lambda, double* pOut,
+                       const Teuchos::Array<double>& lowerBound,
+                       const Teuchos::Array<double>& upperBound);
 
   double* p;
   double* p_last;
@@ -95,6 +99,12 @@ class Optimizer_OC : public Optimizer {
   double _maxMeasure;
   double _optMeasure;
   bool   _useNewtonSearch;
+  int    _measureCandidates;
+
+  // Multiplier of the last topology update, and number of measure
+  // evaluations (single or batched) it took to find it
+  double _multiplier;
+  int    _measurePasses;
 
 };
 
@@ -9,16 +9,20 @@
 #include "AAdapt_RC_Manager.hpp"
 #include "Albany_DiscretizationFactory.hpp"
 #include "Albany_DistributedParameterLibrary.hpp"
+#include "Albany_GlobalLocalIndexer.hpp"
 #include "Albany_Macros.hpp"
 #include "Albany_ProblemFactory.hpp"
 #include "Albany_ResponseFactory.hpp"
+#include "Albany_ThyraCrsMatrixFactory.hpp"
 #include "Albany_ThyraUtils.hpp"
 #include "Thyra_MultiVectorStdOps.hpp"
 #include "Thyra_VectorBase.hpp"
 #include "Thyra_VectorStdOps.hpp"
 
+#include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_TimeMonitor.hpp"
 
+#include <chrono>
 #include <string>
 #include "Albany_DataTypes.hpp"
 
@@ -187,6 +191,16 @@ Application::initialSetUp(const RCP<Teuchos::ParameterList>& params)
   // Validate Problem parameters against list for this specific problem
   problemParams->validateParameters(*(problem->getValidProblemParameters()), 0);
 
+  // The "Cost Rebalance" adapter weighs the elements with their measured
+  // evaluation time, which is then recorded in an element state
+  if (problemParams->isSublist("Adaptation")) {
+    Teuchos::ParameterList& adaptParams = problemParams->sublist("Adaptation");
+    if (adaptParams.get<std::string>("Method", "") == "Cost Rebalance") {
+      evalCostStateName = adaptParams.get<std::string>(
+          "Cost Field Name", "evaluation_cost");
+    }
+  }
+
   try {
     tangent_deriv_dim = calcTangentDerivDimension(problemParams);
   } catch (...) {
@@ -555,6 +569,15 @@ Application::buildProblem()
 
   problem->buildProblem(meshSpecs, stateMgr);
 
+  if (!evalCostStateName.empty()) {
+    for (int ps = 0; ps < meshSpecs.size(); ps++) {
+      const Teuchos::RCP<PHX::DataLayout> cell_scalar =
+          Teuchos::rcp(new PHX::MDALayout<Cell>(meshSpecs[ps]->worksetSize));
+      stateMgr.registerStateVariable(
+          evalCostStateName, cell_scalar, meshSpecs[ps]->ebName, "scalar", 0.0);
+    }
+  }
+
   if ((requires_sdbcs_ == true) && (problem->useSDBCs() == false) &&
       (no_dir_bcs_ == false)) {
     TEUCHOS_TEST_FOR_EXCEPTION(
@@ -647,6 +670,17 @@ Application::createDiscretization()
       problem->getNullSpace());
   // The following is for Aeras problems.
   explicit_scheme = disc->isExplicitScheme();
+
+  clearDistParamDerivCache();
+}
+
+void
+Application::clearDistParamDerivCache()
+{
+  distParamDerivOverlapGraphs.clear();
+  distParamDerivGraphs.clear();
+  distParamDerivOverlapOps.clear();
+  distParamDerivOverlapVS = Teuchos::null;
 }
 
 void
@@ -698,8 +732,12 @@ Application::finalSetUp(
   setScaling(params);
 
   // Now that space is allocated in STK for state fields, initialize states.
-  // If the states have been already allocated, skip this.
-  if (!stateMgr.areStateVarsAllocated()) stateMgr.setupStateArrays(disc);
+  // If the states have been already allocated, skip this, but refresh the
+  // state handle tables, since the mesh may have been updated in between.
+  if (!stateMgr.areStateVarsAllocated())
+    stateMgr.setupStateArrays(disc);
+  else
+    stateMgr.updateStateArrayHandles();
 
   solMgr = rcp(new AAdapt::AdaptiveSolutionManager(
       params,
@@ -1379,8 +1417,17 @@ Application::computeGlobalResidualImpl(
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
+      const auto start = std::chrono::high_resolution_clock::now();
+
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+
+      if (!evalCostStateName.empty()) {
+        PHX::Device::fence();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::high_resolution_clock::now() - start;
+        recordEvaluationCost(ws, elapsed.count());
+      }
 #ifdef DEBUG_OUTPUT
       *out << "IKT after fm evaluateFields countRes = " << countRes
            << ", computeGlobalResid workset.x = \n ";
@@ -1602,8 +1649,17 @@ Application::computeGlobalJacobianImpl(
       const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
       loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
 
+      const auto start = std::chrono::high_resolution_clock::now();
+
       // FillType template argument used to specialize Sacado
       fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+
+      if (!evalCostStateName.empty()) {
+        PHX::Device::fence();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::high_resolution_clock::now() - start;
+        recordEvaluationCost(ws, elapsed.count());
+      }
       if (Teuchos::nonnull(nfm))
         deref_nfm(nfm, wsPhysIndex, ws)
             ->evaluateFields<EvalT>(workset);
@@ -2060,7 +2116,8 @@ Application::applyGlobalDistParamDerivImpl(
     const std::string&                           dist_param_name,
     const bool                                   trans,
     const Teuchos::RCP<const Thyra_MultiVector>& V,
-    const Teuchos::RCP<Thyra_MultiVector>&       fpV)
+    const Teuchos::RCP<Thyra_MultiVector>&       fpV,
+    const Teuchos::RCP<const Thyra_LinearOp>&    assembled_dfdp)
 {
   TEUCHOS_FUNC_TIME_MONITOR("Albany Fill: Distributed Parameter Derivative");
   using EvalT = PHAL::AlbanyTraits::DistParamDeriv;
@@ -2088,15 +2145,6 @@ Application::applyGlobalDistParamDerivImpl(
     }
   }
 
-  Teuchos::RCP<Thyra_MultiVector> overlapped_fpV;
-  if (trans) {
-    const auto& vs = distParamLib->get(dist_param_name)->overlap_vector_space();
-    overlapped_fpV = Thyra::createMembers(vs, V->domain()->dim());
-  } else {
-    overlapped_fpV = Thyra::createMembers(
-        disc->getOverlapVectorSpace(), fpV->domain()->dim());
-  }
-  overlapped_fpV->assign(0.0);
   fpV->assign(0.0);
 
   Teuchos::RCP<const Thyra_MultiVector> V_bc = V;
@@ -2126,60 +2174,14 @@ Application::applyGlobalDistParamDerivImpl(
     dfm->evaluateFields<EvalT>(workset);
   }
 
-  // Import V (after BC's applied) to overlapped distribution
-  RCP<Thyra_MultiVector> overlapped_V;
-  if (trans) {
-    overlapped_V = Thyra::createMembers(
-        disc->getOverlapVectorSpace(), V_bc->domain()->dim());
-    overlapped_V->assign(0.0);
-    cas_manager->scatter(V_bc, overlapped_V, CombineMode::INSERT);
-  } else {
-    const auto& vs = distParamLib->get(dist_param_name)->overlap_vector_space();
-    overlapped_V   = Thyra::createMembers(vs, V_bc->domain()->dim());
-    overlapped_V->assign(0.0);
-    distParamLib->get(dist_param_name)->get_cas_manager()
-        ->scatter(V_bc, overlapped_V, CombineMode::INSERT);
-  }
-
-  // Set data in Workset struct, and perform fill via field manager
-  {
-    TEUCHOS_FUNC_TIME_MONITOR("Albany Distributed Parameter Derivative Fill: Evaluate");
-
-    PHAL::Workset workset;
-
-    double const this_time = fixTime(current_time);
-
-    loadBasicWorksetInfo(workset, this_time);
-
-    workset.dist_param_deriv_name      = dist_param_name;
-    workset.Vp                         = overlapped_V;
-    workset.fpV                        = overlapped_fpV;
-    workset.transpose_dist_param_deriv = trans;
-
-    for (int ws = 0; ws < numWorksets; ws++) {
-      const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
-      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
-
-      // FillType template argument used to specialize Sacado
-      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
-      if (nfm != Teuchos::null)
-        deref_nfm(nfm, wsPhysIndex, ws)
-            ->evaluateFields<EvalT>(workset);
-    }
-  }
-
-  {
+  // With an assembled df/dp, the volume contributions are a mat-vec
+  if (!assembled_dfdp.is_null()) {
     TEUCHOS_FUNC_TIME_MONITOR(
-        "Albany Distributed Parameter Derivative Fill: Export");
-    // Assemble global df/dp*V
+        "Albany Distributed Parameter Derivative Fill: Apply");
     if (trans) {
-      Teuchos::RCP<const Thyra_MultiVector> temp = fpV->clone_mv();
-
-      distParamLib->get(dist_param_name)
-          ->get_cas_manager()
-          ->combine(overlapped_fpV, fpV, CombineMode::ADD);
-
-      fpV->update(1.0, *temp);  // fpV += temp;
+      // Keep the contributions of the Dirichlet conditions already in fpV
+      Thyra::apply(
+          *assembled_dfdp, Thyra::TRANS, *V_bc, fpV.ptr(), 1.0, 1.0);
 
       std::stringstream sensitivity_name;
       sensitivity_name << dist_param_name << "_sensitivity";
@@ -2189,9 +2191,88 @@ Application::applyGlobalDistParamDerivImpl(
         distParamLib->get(sensitivity_name.str())->scatter();
       }
     } else {
-      cas_manager->combine(overlapped_fpV, fpV, CombineMode::ADD);
+      Thyra::apply(
+          *assembled_dfdp, Thyra::NOTRANS, *V_bc, fpV.ptr(), 1.0, 0.0);
+    }
+  } else {
+    Teuchos::RCP<Thyra_MultiVector> overlapped_fpV;
+    if (trans) {
+      const auto& vs =
+          distParamLib->get(dist_param_name)->overlap_vector_space();
+      overlapped_fpV = Thyra::createMembers(vs, V->domain()->dim());
+    } else {
+      overlapped_fpV = Thyra::createMembers(
+          disc->getOverlapVectorSpace(), fpV->domain()->dim());
     }
-  }  // End timer
+    overlapped_fpV->assign(0.0);
+
+    // Import V (after BC's applied) to overlapped distribution
+    RCP<Thyra_MultiVector> overlapped_V;
+    if (trans) {
+      overlapped_V = Thyra::createMembers(
+          disc->getOverlapVectorSpace(), V_bc->domain()->dim());
+      overlapped_V->assign(0.0);
+      cas_manager->scatter(V_bc, overlapped_V, CombineMode::INSERT);
+    } else {
+      const auto& vs = distParamLib->get(dist_param_name)->overlap_vector_space();
+      overlapped_V   = Thyra::createMembers(vs, V_bc->domain()->dim());
+      overlapped_V->assign(0.0);
+      distParamLib->get(dist_param_name)->get_cas_manager()
+          ->scatter(V_bc, overlapped_V, CombineMode::INSERT);
+    }
+
+    // Set data in Workset struct, and perform fill via field manager
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("Albany Distributed Parameter Derivative Fill: Evaluate");
+
+      PHAL::Workset workset;
+
+      double const this_time = fixTime(current_time);
+
+      loadBasicWorksetInfo(workset, this_time);
+
+      workset.dist_param_deriv_name      = dist_param_name;
+      workset.Vp                         = overlapped_V;
+      workset.fpV                        = overlapped_fpV;
+      workset.transpose_dist_param_deriv = trans;
+
+      for (int ws = 0; ws < numWorksets; ws++) {
+        const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+        loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+
+        // FillType template argument used to specialize Sacado
+        fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+        if (nfm != Teuchos::null)
+          deref_nfm(nfm, wsPhysIndex, ws)
+              ->evaluateFields<EvalT>(workset);
+      }
+    }
+
+    {
+      TEUCHOS_FUNC_TIME_MONITOR(
+          "Albany Distributed Parameter Derivative Fill: Export");
+      // Assemble global df/dp*V
+      if (trans) {
+        Teuchos::RCP<const Thyra_MultiVector> temp = fpV->clone_mv();
+
+        distParamLib->get(dist_param_name)
+            ->get_cas_manager()
+            ->combine(overlapped_fpV, fpV, CombineMode::ADD);
+
+        fpV->update(1.0, *temp);  // fpV += temp;
+
+        std::stringstream sensitivity_name;
+        sensitivity_name << dist_param_name << "_sensitivity";
+        if (distParamLib->has(sensitivity_name.str())) {
+          auto sens_vec = distParamLib->get(sensitivity_name.str())->vector();
+          sens_vec->update(1.0, *fpV->col(0));
+          distParamLib->get(sensitivity_name.str())->scatter();
+        }
+      } else {
+        cas_manager->combine(overlapped_fpV, fpV, CombineMode::ADD);
+      }
+    }  // End timer
+  }
 
   // Apply Dirichlet conditions using dfm (Dirchelt Field Manager)
   if (!trans && dfm != Teuchos::null) {
@@ -2216,6 +2297,158 @@ Application::applyGlobalDistParamDerivImpl(
   }
 }
 
+void
+Application::computeGlobalDistParamDerivImpl(
+    const double                            current_time,
+    const Teuchos::RCP<const Thyra_Vector>& x,
+    const Teuchos::RCP<const Thyra_Vector>& xdot,
+    const Teuchos::RCP<const Thyra_Vector>& xdotdot,
+    const Teuchos::Array<ParamVec>&         p,
+    const std::string&                      dist_param_name,
+    Teuchos::RCP<Thyra_LinearOp>&           dfdp)
+{
+  TEUCHOS_FUNC_TIME_MONITOR(
+      "Albany Fill: Assemble Distributed Parameter Derivative");
+  using EvalT = PHAL::AlbanyTraits::DistParamDeriv;
+  postRegSetup<EvalT>();
+
+  const auto& wsElNodeEqID = disc->getWsElNodeEqID();
+  const auto& wsPhysIndex  = disc->getWsPhysIndex();
+
+  int numWorksets = wsElNodeEqID.size();
+
+  auto cas_manager = solMgr->get_cas_manager();
+
+  // Scatter x and xdot to the overlapped distribution
+  solMgr->scatterX(*x, xdot.ptr(), xdotdot.ptr());
+
+  // Scatter distributed parameters
+  distParamLib->scatter();
+
+  // Set parameters
+  for (int i = 0; i < p.size(); i++) {
+    for (unsigned int j = 0; j < p[i].size(); j++) {
+      p[i][j].family->setRealValueForAllTypes(p[i][j].baseValue);
+    }
+  }
+
+  PHAL::Workset workset;
+
+  double const this_time = fixTime(current_time);
+
+  loadBasicWorksetInfo(workset, this_time);
+
+  workset.dist_param_deriv_name      = dist_param_name;
+  workset.transpose_dist_param_deriv = false;
+
+  auto param = distParamLib->get(dist_param_name);
+
+  // After a mesh update the graphs, and any dfdp built on them, are stale
+  if (disc->getOverlapVectorSpace().get() != distParamDerivOverlapVS.get()) {
+    clearDistParamDerivCache();
+    distParamDerivOverlapVS = disc->getOverlapVectorSpace();
+    dfdp                    = Teuchos::null;
+  }
+
+  // The first time, run the evaluators once to find the sparsity pattern
+  if (distParamDerivOverlapGraphs.find(dist_param_name) ==
+      distParamDerivOverlapGraphs.end()) {
+    TEUCHOS_FUNC_TIME_MONITOR(
+        "Albany Distributed Parameter Derivative Fill: Graph");
+
+    const auto ov_x_vs = disc->getOverlapVectorSpace();
+    const auto ov_p_vs = param->overlap_vector_space();
+
+    workset.dist_param_deriv_pattern =
+        Teuchos::rcp(new std::vector<std::set<LO>>(getLocalSubdim(ov_x_vs)));
+
+    // Only the scatters that know about the assembled mode skip fpV. Any
+    // other evaluator adding df/dp*Vp straight into fpV would be silently
+    // dropped from the matrix: feed a random Vp and check that fpV stays zero.
+    auto probe_Vp  = Thyra::createMembers(ov_p_vs, 1);
+    auto probe_fpV = Thyra::createMembers(ov_x_vs, 1);
+    Thyra::randomize(-1.0, 1.0, probe_Vp.ptr());
+    probe_fpV->assign(0.0);
+    workset.Vp  = probe_Vp;
+    workset.fpV = probe_fpV;
+
+    for (int ws = 0; ws < numWorksets; ws++) {
+      const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+
+      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+      if (nfm != Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+    }
+
+    workset.Vp  = Teuchos::null;
+    workset.fpV = Teuchos::null;
+
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        Thyra::norm_inf(*probe_fpV->col(0)) != 0.0,
+        std::logic_error,
+        "Error! Some evaluator of the distributed parameter derivative of '"
+            << dist_param_name << "' does not support the assembled mode.\n"
+            << "       Set 'Assemble Distributed Parameter Derivative' to false.\n");
+
+    auto ov_graph =
+        Teuchos::rcp(new ThyraCrsMatrixFactory(ov_p_vs, ov_x_vs));
+    auto x_indexer = createGlobalLocalIndexer(ov_x_vs);
+    auto p_indexer = createGlobalLocalIndexer(ov_p_vs);
+    Teuchos::Array<GO> cols;
+    const auto& pattern = *workset.dist_param_deriv_pattern;
+    for (LO row = 0; row < static_cast<LO>(pattern.size()); ++row) {
+      if (pattern[row].empty()) { continue; }
+      cols.clear();
+      for (const LO col : pattern[row]) {
+        cols.push_back(p_indexer->getGlobalElement(col));
+      }
+      ov_graph->insertGlobalIndices(x_indexer->getGlobalElement(row), cols());
+    }
+    ov_graph->fillComplete();
+    workset.dist_param_deriv_pattern = Teuchos::null;
+
+    distParamDerivOverlapGraphs[dist_param_name] = ov_graph;
+    distParamDerivGraphs[dist_param_name] = Teuchos::rcp(new ThyraCrsMatrixFactory(
+        param->vector_space(), disc->getVectorSpace(), ov_graph));
+    distParamDerivOverlapOps[dist_param_name] = ov_graph->createOp();
+  }
+
+  if (dfdp.is_null()) {
+    dfdp = distParamDerivGraphs[dist_param_name]->createOp();
+  }
+
+  auto overlapped_dfdp = distParamDerivOverlapOps[dist_param_name];
+  if (!isFillActive(overlapped_dfdp)) { resumeFill(overlapped_dfdp); }
+  assign(overlapped_dfdp, 0.0);
+
+  {
+    TEUCHOS_FUNC_TIME_MONITOR(
+        "Albany Distributed Parameter Derivative Fill: Evaluate");
+
+    workset.dist_param_deriv_op = overlapped_dfdp;
+
+    for (int ws = 0; ws < numWorksets; ws++) {
+      const std::string evalName = PHAL::evalName<EvalT>("FM", wsPhysIndex[ws]);
+      loadWorksetBucketInfo<EvalT>(workset, ws, evalName);
+
+      // FillType template argument used to specialize Sacado
+      fm[wsPhysIndex[ws]]->evaluateFields<EvalT>(workset);
+      if (nfm != Teuchos::null)
+        deref_nfm(nfm, wsPhysIndex, ws)->evaluateFields<EvalT>(workset);
+    }
+  }
+
+  {
+    TEUCHOS_FUNC_TIME_MONITOR(
+        "Albany Distributed Parameter Derivative Fill: Export");
+    resumeFill(dfdp);
+    assign(dfdp, 0.0);
+    cas_manager->combine(overlapped_dfdp, dfdp, CombineMode::ADD);
+    fillComplete(dfdp);
+  }
+}
+
 void
 Application::evaluateResponse(
     int                                     response_index,
@@ -2233,6 +2466,83 @@ Application::evaluateResponse(
       this_time, x, xdot, xdotdot, p, g);
 }
 
+namespace {
+// Local copy of v, reusing copy if it lives in the same space.
+void
+copyVector(const Teuchos::RCP<const Thyra_Vector>& v,
+           Teuchos::RCP<Thyra_Vector>&             copy)
+{
+  if (v.is_null()) {
+    copy = Teuchos::null;
+    return;
+  }
+  if (copy.is_null() || !sameAs(copy->space(), v->space())) {
+    copy = Thyra::createMember(v->space());
+  }
+  copy->assign(*v);
+}
+
+bool
+locallyEqual(const Teuchos::RCP<const Thyra_Vector>& v,
+             const Teuchos::RCP<const Thyra_Vector>& w)
+{
+  if (v.is_null() || w.is_null()) return v.is_null() == w.is_null();
+  if (!sameAs(v->space(), w->space())) return false;
+  const auto v_data = getLocalData(v);
+  const auto w_data = getLocalData(w);
+  for (int i = 0; i < v_data.size(); ++i) {
+    if (v_data[i] != w_data[i]) return false;
+  }
+  return true;
+}
+}  // namespace
+
+void
+Application::recordObservedResponses(
+    const double                                             t,
+    const Teuchos::RCP<const Thyra_Vector>&                  x,
+    const Teuchos::RCP<const Thyra_Vector>&                  xdot,
+    const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& p,
+    const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& g)
+{
+  observed_t = t;
+  copyVector(x, observed_x);
+  copyVector(xdot, observed_xdot);
+  observed_p.resize(p.size());
+  for (int i = 0; i < p.size(); ++i) copyVector(p[i], observed_p[i]);
+  observed_g.resize(g.size());
+  for (int i = 0; i < g.size(); ++i) copyVector(g[i], observed_g[i]);
+}
+
+Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>
+Application::getObservedResponses(
+    const double                                             t,
+    const Teuchos::RCP<const Thyra_Vector>&                  x,
+    const Teuchos::RCP<const Thyra_Vector>&                  xdot,
+    const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& p) const
+{
+  Teuchos::Array<Teuchos::RCP<const Thyra_Vector>> g;
+
+  // All ranks have to take part in the reduction, so decide on a rank-local
+  // match first. The responses are reused only if time, state and
+  // parameters are bitwise identical on every rank.
+  int local_match = Teuchos::nonnull(observed_x) && observed_t == t &&
+                    locallyEqual(observed_x, x) &&
+                    locallyEqual(observed_xdot, xdot) &&
+                    observed_p.size() == p.size();
+  for (int i = 0; local_match && i < p.size(); ++i) {
+    local_match = locallyEqual(observed_p[i], p[i]);
+  }
+  int match = 0;
+  Teuchos::reduceAll(
+      *comm, Teuchos::REDUCE_MIN, local_match, Teuchos::ptr(&match));
+  if (match == 0) return g;
+
+  g.resize(observed_g.size());
+  for (int i = 0; i < observed_g.size(); ++i) g[i] = observed_g[i];
+  return g;
+}
+
 void
 Application::evaluateResponseTangent(
     int                                          response_index,
@@ -2722,6 +3032,24 @@ Application::loadWorksetSidesetInfo(PHAL::Workset& workset, const int ws)
   workset.sideSets = Teuchos::rcpFromRef(disc->getSideSets(ws));
 }
 
+void
+Application::recordEvaluationCost(const int ws, const double seconds)
+{
+  // The cost is only measured per workset: split it evenly among its cells.
+  // It accumulates until the adapter rebalances the mesh and resets it.
+  Albany::StateArray& states =
+      stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  auto it = states.find(evalCostStateName);
+  if (it == states.end()) { return; }
+
+  Albany::MDArray& cost     = it->second;
+  const int        numCells = disc->getWsElNodeEqID()[ws].extent(0);
+  if (numCells == 0) { return; }
+
+  const double cellCost = seconds / numCells;
+  for (int cell = 0; cell < numCells; ++cell) { cost(cell) += cellCost; }
+}
+
 void
 Application::setupBasicWorksetInfo(
     PHAL::Workset&                          workset,
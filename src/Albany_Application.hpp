@@ -43,6 +43,8 @@ class Manager;
 
 namespace Albany {
 
+struct ThyraCrsMatrixFactory;
+
 class Application
     : public Sacado::ParameterAccessor<PHAL::AlbanyTraits::Residual, SPL_Traits>
 {
@@ -132,6 +134,26 @@ class Application
     return relative_responses;
   }
 
+  //! Keep a copy of the responses g computed at (t, x, xdot, p), so that the
+  //! observer can print them without evaluating the responses again.
+  void
+  recordObservedResponses(
+      const double                                             t,
+      const Teuchos::RCP<const Thyra_Vector>&                  x,
+      const Teuchos::RCP<const Thyra_Vector>&                  xdot,
+      const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& p,
+      const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& g);
+
+  //! Responses recorded at (t, x, xdot, p), or an empty array if the last
+  //! recorded responses were computed at a different time, state or
+  //! parameters. Collective.
+  Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>
+  getObservedResponses(
+      const double                                             t,
+      const Teuchos::RCP<const Thyra_Vector>&                  x,
+      const Teuchos::RCP<const Thyra_Vector>&                  xdot,
+      const Teuchos::Array<Teuchos::RCP<const Thyra_Vector>>& p) const;
+
   Teuchos::RCP<AAdapt::AdaptiveSolutionManager>
   getAdaptSolMgr()
   {
@@ -293,7 +315,27 @@ class Application
       const std::string&                           dist_param_name,
       const bool                                   trans,
       const Teuchos::RCP<const Thyra_MultiVector>& V,
-      const Teuchos::RCP<Thyra_MultiVector>&       fpV);
+      const Teuchos::RCP<Thyra_MultiVector>&       fpV,
+      const Teuchos::RCP<const Thyra_LinearOp>&    assembled_dfdp =
+          Teuchos::null);
+
+  //! Assemble df/dp for distributed parameter p into dfdp
+  /*!
+   * Only the volume (and extruded) contributions are assembled; Dirichlet
+   * conditions are applied by applyGlobalDistParamDerivImpl. If dfdp is null,
+   * it is created. The sparsity pattern is computed on the first call for each
+   * parameter and then reused until the discretization's mesh changes; a dfdp
+   * built on an older mesh is then replaced by a new one.
+   */
+  void
+  computeGlobalDistParamDerivImpl(
+      const double                            current_time,
+      const Teuchos::RCP<const Thyra_Vector>& x,
+      const Teuchos::RCP<const Thyra_Vector>& xdot,
+      const Teuchos::RCP<const Thyra_Vector>& xdotdot,
+      const Teuchos::Array<ParamVec>&         p,
+      const std::string&                      dist_param_name,
+      Teuchos::RCP<Thyra_LinearOp>&           dfdp);
 
   //! Evaluate response functions
   /*!
@@ -436,6 +478,10 @@ class Application
   void
   removeEpetraRelatedPLs(const Teuchos::RCP<Teuchos::ParameterList>& params);
 
+  //! Spreads the measured evaluation time of a workset over its cells
+  void
+  recordEvaluationCost(const int ws, const double seconds);
+
  public:
   //! Routine to get workset (bucket) size info needed by all Evaluation types
   template <typename EvalT>
@@ -753,6 +799,18 @@ class Application
   //! Distributed parameter library
   Teuchos::RCP<DistributedParameterLibrary> distParamLib;
 
+  //! Graphs and overlapped operators of the assembled df/dp, per parameter
+  std::map<std::string, Teuchos::RCP<ThyraCrsMatrixFactory>>
+      distParamDerivOverlapGraphs;
+  std::map<std::string, Teuchos::RCP<ThyraCrsMatrixFactory>>
+      distParamDerivGraphs;
+  std::map<std::string, Teuchos::RCP<Thyra_LinearOp>> distParamDerivOverlapOps;
+
+  //! Overlapped solution space the df/dp graphs were built on. The
+  //! discretization rebuilds its spaces on every mesh update, so a different
+  //! space means the graphs are stale.
+  Teuchos::RCP<const Thyra_VectorSpace> distParamDerivOverlapVS;
+
   //! Solution memory manager
   Teuchos::RCP<AAdapt::AdaptiveSolutionManager> solMgr;
 
@@ -836,6 +894,10 @@ class Application
   determinePiroSolver(
       const Teuchos::RCP<Teuchos::ParameterList>& topLevelParams);
 
+  //! Drop the df/dp graphs and overlapped operators of all parameters
+  void
+  clearDistParamDerivCache();
+
   int derivatives_check_;
 
   int num_time_deriv;
@@ -854,6 +916,18 @@ class Application
 
   // local responses
   Teuchos::Array<unsigned int> relative_responses;
+
+  // element state accumulating the measured evaluation time of each cell,
+  // used as Zoltan weights by the "Cost Rebalance" adapter (empty if unused)
+  std::string evalCostStateName;
+
+  // responses of the last evaluation that computed all of them, and the
+  // time, state and parameters they were computed at
+  double                                     observed_t;
+  Teuchos::RCP<Thyra_Vector>                 observed_x;
+  Teuchos::RCP<Thyra_Vector>                 observed_xdot;
+  Teuchos::Array<Teuchos::RCP<Thyra_Vector>> observed_p;
+  Teuchos::Array<Teuchos::RCP<Thyra_Vector>> observed_g;
 };
 
 template <typename EvalT>
@@ -894,6 +968,8 @@ Application::loadWorksetBucketInfo(PHAL::Workset& workset, const int& ws,
 
   workset.stateArrayPtr =
       &stateMgr.getStateArray(Albany::StateManager::ELEM, ws);
+  workset.stateArrayHandles =
+      &stateMgr.getStateArrayHandles(Albany::StateManager::ELEM, ws);
 #if defined(ALBANY_EPETRA)
   workset.disc         = disc;  // Needed by LandIce for sideset DOF save
   workset.eigenDataPtr = stateMgr.getEigenData();
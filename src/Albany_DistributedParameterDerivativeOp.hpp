@@ -12,6 +12,9 @@
 #include "Albany_DistributedParameterLibrary.hpp"
 
 #include "Teuchos_RCP.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+#include <map>
 
 namespace Albany {
 
@@ -21,6 +24,11 @@ namespace Albany {
    * op(df/dp)*v where op() is the identity or tranpose, f is the Albany
    * residual vector, p is a distributed parameter vector, and v is a given
    * vector.
+   *
+   * If assemble is true, df/dp is assembled into a sparse matrix, which is
+   * reused by all the applications until the solution, the time, any
+   * parameter or the mesh changes. This pays off when many vectors are applied at the same
+   * linearization point (e.g., when computing reduced gradients/Hessians).
    */
   class DistributedParameterDerivativeOp : public Thyra_LinearOp {
   public:
@@ -28,9 +36,11 @@ namespace Albany {
     // Constructor
     DistributedParameterDerivativeOp(
       const Teuchos::RCP<Application>& app_,
-      const std::string& param_name_) :
+      const std::string& param_name_,
+      const bool assemble_ = false) :
       app(app_),
-      param_name(param_name_) {}
+      param_name(param_name_),
+      assemble(assemble_) {}
 
     //! Destructor
     virtual ~DistributedParameterDerivativeOp() {}
@@ -75,12 +85,76 @@ namespace Albany {
                     const ST /* beta */) const {
 
       bool use_transpose = (Thyra::real_trans(M_trans) == Thyra::TRANS);
+      if (assemble && linearizationPointChanged()) {
+        app->computeGlobalDistParamDerivImpl(time, x, xdot, xdotdot,
+                                             *scalar_params,
+                                             param_name,
+                                             dfdp);
+      }
       app->applyGlobalDistParamDerivImpl(time, x, xdot, xdotdot,
                                          *scalar_params,
                                          param_name,
                                          use_transpose,
                                          Teuchos::rcpFromRef(X),
-                                         Teuchos::rcpFromPtr(Y));
+                                         Teuchos::rcpFromPtr(Y),
+                                         dfdp);
+    }
+
+    //! Compare v with its stored copy, and update the copy.
+    //! Returns true if they differ.
+    static bool updateSnapshot(const Teuchos::RCP<const Thyra_Vector>& v,
+                               Teuchos::RCP<Thyra_Vector>& snapshot) {
+      if (v.is_null()) {
+        const bool changed = !snapshot.is_null();
+        snapshot = Teuchos::null;
+        return changed;
+      }
+      bool changed = true;
+      if (snapshot.is_null() || !snapshot->space()->isCompatible(*v->space())) {
+        snapshot = Thyra::createMember(v->space());
+      } else {
+        snapshot->update(-1.0, *v);
+        changed = (Thyra::norm_inf(*snapshot) != 0.0);
+      }
+      snapshot->assign(*v);
+      return changed;
+    }
+
+    //! Returns true if df/dp has to be re-assembled
+    bool linearizationPointChanged() const {
+      // A mesh update rebuilds the solution space, and dfdp with it
+      if (app->getVectorSpace().get() != dfdp_vs.get()) {
+        dfdp    = Teuchos::null;
+        dfdp_vs = app->getVectorSpace();
+      }
+
+      bool changed = dfdp.is_null() || time != dfdp_time;
+      dfdp_time = time;
+
+      changed = updateSnapshot(x, x_snapshot) || changed;
+      changed = updateSnapshot(xdot, xdot_snapshot) || changed;
+      changed = updateSnapshot(xdotdot, xdotdot_snapshot) || changed;
+
+      Teuchos::Array<double> values;
+      for (const auto& pvec : *scalar_params) {
+        for (unsigned int j = 0; j < pvec.size(); ++j) {
+          values.push_back(pvec[j].baseValue);
+        }
+      }
+      changed = changed || values != scalar_params_snapshot;
+      scalar_params_snapshot = values;
+
+      for (const auto& it : *app->getDistributedParameterLibrary()) {
+        // Sensitivities are outputs, updated by the transpose apply
+        const std::string& name = it.first;
+        const std::string suffix = "_sensitivity";
+        if (name.size() > suffix.size() &&
+            name.compare(name.size()-suffix.size(), suffix.size(), suffix) == 0) {
+          continue;
+        }
+        changed = updateSnapshot(it.second->vector(), dist_params_snapshot[name]) || changed;
+      }
+      return changed;
     }
 
     //! Albany applications
@@ -89,6 +163,9 @@ namespace Albany {
     //! Name of distributed parameter we are differentiating w.r.t.
     std::string param_name;
 
+    //! Whether df/dp is assembled
+    bool assemble;
+
     //! @name Data needed for apply()
     //@{
 
@@ -109,6 +186,25 @@ namespace Albany {
 
     //@}
 
+    //! @name Assembled df/dp and the point it was computed at
+    //@{
+
+    mutable Teuchos::RCP<Thyra_LinearOp> dfdp;
+
+    mutable double dfdp_time = 0.0;
+
+    mutable Teuchos::RCP<const Thyra_VectorSpace> dfdp_vs;
+
+    mutable Teuchos::RCP<Thyra_Vector> x_snapshot;
+    mutable Teuchos::RCP<Thyra_Vector> xdot_snapshot;
+    mutable Teuchos::RCP<Thyra_Vector> xdotdot_snapshot;
+
+    mutable Teuchos::Array<double> scalar_params_snapshot;
+
+    mutable std::map<std::string, Teuchos::RCP<Thyra_Vector>> dist_params_snapshot;
+
+    //@}
+
   }; // class DistributedParameterDerivativeOp
 
 } // namespace Albany
@@ -10,6 +10,7 @@
 #include "Albany_DistributedParameterDerivativeOp.hpp"
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Thyra_VectorStdOps.hpp"
 
 #include "Albany_ThyraUtils.hpp"
 
@@ -62,6 +63,10 @@ ModelEvaluator (const Teuchos::RCP<Albany::Application>&    app_,
     use_tempus = true; 
   }
 
+  // The Hessian-vector products are finite differences of the assembled
+  // first derivatives (xx only), so they are only advertised on request
+  supports_hess_vec_prods = problemParams.get("Hessian-Vector Products", false);
+
   num_param_vecs = parameterParams.get("Number of Parameter Vectors", 0);
   bool using_old_parameter_list = false;
   if (parameterParams.isType<int>("Number")) {
@@ -347,6 +352,7 @@ ModelEvaluator (const Teuchos::RCP<Albany::Application>&    app_,
   }
 
   overwriteNominalValuesWithFinalPoint = appParams->get("Overwrite Nominal Values With Final Point",false);
+  assembleDistParamDeriv = problemParams.get("Assemble Distributed Parameter Derivative",false);
 
   timer = Teuchos::TimeMonitor::getNewTimer("Albany: Total Fill Time");
 }
@@ -478,7 +484,7 @@ ModelEvaluator::create_DfDp_op_impl(int j) const
           << j
           << std::endl);
 
-  return Teuchos::rcp( new DistributedParameterDerivativeOp(app, dist_param_names[j - num_param_vecs]) );
+  return Teuchos::rcp( new DistributedParameterDerivativeOp(app, dist_param_names[j - num_param_vecs], assembleDistParamDeriv) );
 }
 
 Teuchos::RCP<const Thyra_LOWS_Factory>
@@ -564,6 +570,8 @@ Thyra_OutArgs ModelEvaluator::createOutArgsImpl() const
     result.setSupports(Thyra_ModelEvaluator::OUT_ARG_W_prec, true);
 
   result.setSupports(Thyra_ModelEvaluator::OUT_ARG_W_op, true);
+  if (supports_hess_vec_prods)
+    result.setSupports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_f_xx, true);
   result.set_W_properties(Thyra_ModelEvaluator::DerivativeProperties(
       Thyra_ModelEvaluator::DERIV_LINEARITY_UNKNOWN,
       Thyra_ModelEvaluator::DERIV_RANK_FULL,
@@ -607,6 +615,13 @@ Thyra_OutArgs ModelEvaluator::createOutArgsImpl() const
           l,
           Thyra_ModelEvaluator::DERIV_MV_BY_COL);
 
+    // Hessian-vector products are only available for scalar responses,
+    // whose dg/dx is a multivector
+    if (supports_hess_vec_prods && app->getResponse(i)->isScalarResponse()) {
+      result.setSupports(
+          Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_g_xx, i, true);
+    }
+
     if (app->getResponse(i)->isScalarResponse()) {
       for (int j = 0; j < num_dist_param_vecs; j++)
         result.setSupports(
@@ -938,6 +953,32 @@ evalModelImpl(const Thyra_InArgs&  inArgs,
     }
   }
 
+  // Hessian-vector products
+  evalFDHessVecProds(inArgs, outArgs, curr_time, x, x_dot, x_dotdot);
+
+  // Keep the responses for the observer, which prints them at the state the
+  // solver converged to.
+  if (app->observeResponses() && outArgs.Ng() > 0) {
+    Teuchos::Array<Teuchos::RCP<const Thyra_Vector>> g(outArgs.Ng());
+    bool all_g = true;
+    for (int j = 0; j < outArgs.Ng(); ++j) {
+      g[j] = outArgs.get_g(j);
+      all_g = all_g && Teuchos::nonnull(g[j]);
+    }
+    if (all_g) {
+      // Parameters that are not passed keep their nominal values
+      Teuchos::Array<Teuchos::RCP<const Thyra_Vector>> p(
+          num_param_vecs + num_dist_param_vecs);
+      for (int l = 0; l < p.size(); ++l) {
+        p[l] = Teuchos::nonnull(inArgs.get_p(l)) ? inArgs.get_p(l) :
+                                                    nominalValues.get_p(l);
+      }
+      const ST t = inArgs.supports(Thyra_ModelEvaluator::IN_ARG_t) ?
+                       inArgs.get_t() : 0.0;
+      app->recordObservedResponses(t, x, x_dot, p, g);
+    }
+  }
+
 #ifdef WRITE_TO_MATRIX_MARKET
   Albany::writeMatrixMarket(x, "sol", mm_counter_sol);
   ++mm_counter_sol;
@@ -954,6 +995,157 @@ evalModelImpl(const Thyra_InArgs&  inArgs,
 #endif
 }
 
+void ModelEvaluator::
+evalFDHessVecProds(const Thyra_InArgs&  inArgs,
+                 const Thyra_OutArgs& outArgs,
+                 const ST curr_time,
+                 const Teuchos::RCP<const Thyra_Vector>& x,
+                 const Teuchos::RCP<const Thyra_Vector>& x_dot,
+                 const Teuchos::RCP<const Thyra_Vector>& x_dotdot) const
+{
+  // The products are not exact: they are finite differences of the
+  // assembled first derivatives, for the multiplier z and the direction v,
+  //   sum_i z_i f_i''(x) v ~ (J(x + eps v)^T z - J(x)^T z) / eps,
+  // and the same with dg/dx for the responses. Each direction costs one
+  // Jacobian (or dg/dx) assembly, plus one at x shared by all directions.
+  // The assembly at x comes last, so that the application (overlapped
+  // solution, states, ...) is left at x rather than at a perturbed point.
+  const int n_g = outArgs.Ng();
+  const Teuchos::RCP<Thyra_MultiVector> f_xx_out =
+      outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_f_xx) ?
+          outArgs.get_hess_vec_prod_f_xx() : Teuchos::null;
+  Teuchos::Array<Teuchos::RCP<Thyra_MultiVector>> g_xx_out(n_g);
+  bool any_g_xx = false;
+  for (int j = 0; j < n_g; ++j) {
+    if (outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_g_xx, j)) {
+      g_xx_out[j] = outArgs.get_hess_vec_prod_g_xx(j);
+      any_g_xx = any_g_xx || Teuchos::nonnull(g_xx_out[j]);
+    }
+  }
+  if (f_xx_out.is_null() && !any_g_xx) {
+    return;
+  }
+
+  const Teuchos::RCP<const Thyra_MultiVector> v = inArgs.get_x_direction();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      v.is_null(), std::logic_error,
+      "Error! Albany::ModelEvaluator::evalFDHessVecProds: "
+      "Hessian-vector products require the x direction.\n");
+
+  const Thyra_Derivative dummy_deriv;
+  const auto x_space = x->space();
+
+  Teuchos::RCP<const Thyra_Vector> z;
+  if (Teuchos::nonnull(f_xx_out)) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        inArgs.get_f_multiplier().is_null(), std::logic_error,
+        "Error! Albany::ModelEvaluator::evalFDHessVecProds: "
+        "hess_vec_prod_f_xx requires the f multiplier.\n");
+    z = inArgs.get_f_multiplier()->col(0);
+    if (hess_vec_prod_jac.is_null()) {
+      hess_vec_prod_jac = app->createJacobianOp();
+    }
+  }
+
+  Teuchos::Array<Teuchos::RCP<const Thyra_MultiVector>> w(n_g);
+  Teuchos::Array<Teuchos::RCP<Thyra_MultiVector>> dgdx(n_g);
+  for (int j = 0; j < n_g; ++j) {
+    if (g_xx_out[j].is_null()) continue;
+    w[j] = inArgs.get_g_multiplier(j);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        w[j].is_null(), std::logic_error,
+        "Error! Albany::ModelEvaluator::evalFDHessVecProds: "
+        "hess_vec_prod_g_xx(" << j << ") requires the g multiplier.\n");
+    dgdx[j] = Thyra::createMembers(x_space, get_g_space(j)->dim());
+  }
+
+  // Perturbed assemblies, one per direction. Each column of the output
+  // holds J(x + eps v)^T z / eps for now, and eps is kept to remove the
+  // J(x)^T z / eps part below. The step is sized with RMS norms, so that
+  // eps v perturbs a typical entry of x by rel_step (1 + |x_i|) whatever
+  // the number of unknowns: with 2-norms the relative perturbation of each
+  // entry would shrink like 1/sqrt(n) on refined meshes.
+  const ST rel_step = std::sqrt(Teuchos::ScalarTraits<ST>::eps());
+  const ST sqrt_n = std::sqrt(static_cast<ST>(x_space->dim()));
+  const ST x_rms = Thyra::norm_2(*x) / sqrt_n;
+  const int num_dirs = v->domain()->dim();
+  Teuchos::Array<ST> inv_eps(num_dirs, 0.0);
+  const Teuchos::RCP<Thyra_Vector> x_pert = Thyra::createMember(x_space);
+  for (int k = 0; k < num_dirs; ++k) {
+    const Teuchos::RCP<const Thyra_Vector> v_k = v->col(k);
+    const ST v_rms = Thyra::norm_2(*v_k) / sqrt_n;
+    if (v_rms == 0.0) {
+      if (Teuchos::nonnull(f_xx_out)) f_xx_out->col(k)->assign(0.0);
+      for (int j = 0; j < n_g; ++j)
+        if (Teuchos::nonnull(g_xx_out[j])) g_xx_out[j]->col(k)->assign(0.0);
+      continue;
+    }
+    const ST eps = rel_step * (1.0 + x_rms) / v_rms;
+    inv_eps[k] = 1.0 / eps;
+    x_pert->assign(*x);
+    Thyra::Vp_StV(x_pert.ptr(), eps, *v_k);
+
+    if (Teuchos::nonnull(f_xx_out)) {
+      app->computeGlobalJacobian(
+          0.0, 1.0, 0.0, curr_time,
+          x_pert, x_dot, x_dotdot,
+          sacado_param_vec,
+          Teuchos::null, hess_vec_prod_jac);
+      hess_vec_prod_jac->apply(
+          Thyra::TRANS, *z, f_xx_out->col(k).ptr(), inv_eps[k], 0.0);
+    }
+
+    for (int j = 0; j < n_g; ++j) {
+      if (g_xx_out[j].is_null()) continue;
+      app->evaluateResponseDerivative(
+          j, curr_time, x_pert, x_dot, x_dotdot,
+          sacado_param_vec,
+          NULL,
+          Teuchos::null,
+          Thyra_Derivative(dgdx[j], Thyra_ModelEvaluator::DERIV_TRANS_MV_BY_ROW),
+          dummy_deriv,
+          dummy_deriv,
+          dummy_deriv);
+      dgdx[j]->apply(
+          Thyra::NOTRANS, *w[j]->col(0), g_xx_out[j]->col(k).ptr(),
+          inv_eps[k], 0.0);
+    }
+  }
+
+  // J(x)^T z, which also brings the application back to x
+  if (Teuchos::nonnull(f_xx_out)) {
+    app->computeGlobalJacobian(
+        0.0, 1.0, 0.0, curr_time,
+        x, x_dot, x_dotdot,
+        sacado_param_vec,
+        Teuchos::null, hess_vec_prod_jac);
+    const Teuchos::RCP<Thyra_Vector> Jt_z = Thyra::createMember(x_space);
+    hess_vec_prod_jac->apply(Thyra::TRANS, *z, Jt_z.ptr(), 1.0, 0.0);
+    for (int k = 0; k < num_dirs; ++k) {
+      Thyra::Vp_StV(f_xx_out->col(k).ptr(), -inv_eps[k], *Jt_z);
+    }
+  }
+
+  // dg/dx(x) w, with w the g multiplier
+  for (int j = 0; j < n_g; ++j) {
+    if (g_xx_out[j].is_null()) continue;
+    app->evaluateResponseDerivative(
+        j, curr_time, x, x_dot, x_dotdot,
+        sacado_param_vec,
+        NULL,
+        Teuchos::null,
+        Thyra_Derivative(dgdx[j], Thyra_ModelEvaluator::DERIV_TRANS_MV_BY_ROW),
+        dummy_deriv,
+        dummy_deriv,
+        dummy_deriv);
+    const Teuchos::RCP<Thyra_Vector> dgdx_w = Thyra::createMember(x_space);
+    dgdx[j]->apply(Thyra::NOTRANS, *w[j]->col(0), dgdx_w.ptr(), 1.0, 0.0);
+    for (int k = 0; k < num_dirs; ++k) {
+      Thyra::Vp_StV(g_xx_out[j]->col(k).ptr(), -inv_eps[k], *dgdx_w);
+    }
+  }
+}
+
 Thyra_InArgs ModelEvaluator::createInArgsImpl() const
 {
   Thyra::ModelEvaluatorBase::InArgsSetup<ST> result;
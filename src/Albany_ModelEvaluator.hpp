@@ -75,6 +75,13 @@ public:
 
   //@}
 
+  //! Used by drivers that set the initial guess of the next solve themselves
+  void
+  setNominalValues(Thyra_InArgs nv)
+  {
+    nominalValues = nv;
+  }
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
@@ -89,12 +96,6 @@ public:
     current_time_ = t;
     return;
   }
-
-  void
-  setNominalValues(Thyra_InArgs nv)
-  {
-    nominalValues = nv;
-  }
 #endif // ALBANY_LCM
 
  protected:
@@ -127,6 +128,17 @@ public:
       const Thyra_InArgs& inArgs,
       const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const;
 
+  //! Finite-difference approximation of the Hessian-vector products
+  //! requested in outArgs (f_xx and g_xx only)
+  void
+  evalFDHessVecProds(
+      const Thyra_InArgs& inArgs,
+      const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs,
+      const ST curr_time,
+      const Teuchos::RCP<const Thyra_Vector>& x,
+      const Teuchos::RCP<const Thyra_Vector>& x_dot,
+      const Teuchos::RCP<const Thyra_Vector>& x_dotdot) const;
+
   //! Application object
   Teuchos::RCP<Albany::Application> app;
   Teuchos::RCP<Teuchos::ParameterList> appParams;
@@ -139,12 +151,18 @@ public:
   //! Allocated Jacobian for sending to user preconditioner
   mutable Teuchos::RCP<Thyra_LinearOp> Extra_W_op;
 
+  //! Jacobian assembled for the finite-difference Hessian-vector products
+  mutable Teuchos::RCP<Thyra_LinearOp> hess_vec_prod_jac;
+
   //! Whether the problem supplies its own preconditioner
   bool supplies_prec;
 
   //! Boolean marking whether Tempus is used 
   bool use_tempus{false}; 
 
+  //! Whether the Hessian-vector products are advertised
+  bool supports_hess_vec_prods{false};
+
   //@}
 
  protected:
@@ -190,6 +208,10 @@ public:
   //! As it says, when reportFinalPoint is called.
   bool overwriteNominalValuesWithFinalPoint;
 
+  //! Assemble df/dp for distributed parameters (rather than applying it
+  //! on the fly)
+  bool assembleDistParamDeriv;
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST current_time_{0.0};
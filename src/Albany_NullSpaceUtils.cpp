@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 #include "Piro_StratimikosUtils.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
 #include "Albany_NullSpaceUtils.hpp"
@@ -191,18 +192,23 @@ void subtractCentroid(const Teuchos::RCP<Thyra_MultiVector> &coordMV)
   const int ndim = coordMV->domain()->dim(); // Number of multivectors are the dimension of the problem
 
   auto data = getNonconstLocalData(coordMV);
-  ST centroid[3]; // enough for up to 3d
+
+  // Local coordinate sums and node count, reduced together in a single call.
+  ST centroid[4]; // enough for up to 3d, plus the node count
   {
-    ST sum[3];
+    ST sum[4];
     for (int i = 0; i < ndim; ++i) {
       Teuchos::ArrayRCP<const ST> x = data[i];
       sum[i] = 0;
       for (int j = 0; j < nnodes; ++j) sum[i] += x[j];
     }
-    Teuchos::reduceAll(*createTeuchosCommFromThyraComm(spmd_vs->getComm()), Teuchos::REDUCE_SUM, ndim,
+    sum[ndim] = nnodes;
+    Teuchos::reduceAll(*createTeuchosCommFromThyraComm(spmd_vs->getComm()), Teuchos::REDUCE_SUM, ndim+1,
                                 sum, centroid);
-    const int numNodes = spmd_vs->localSubDim(); // length of each vector in the multivector
-    for (int i = 0; i < ndim; ++i) centroid[i] /= numNodes;
+    const ST numNodes = centroid[ndim]; // global number of nodes
+    if (numNodes > 0) {
+      for (int i = 0; i < ndim; ++i) centroid[i] /= numNodes;
+    }
   }
 
   for (int i = 0; i < ndim; ++i) {
@@ -222,17 +228,23 @@ struct Tpetra_NullSpace_Traits {
   const LO vec_leng;
   array_type Array;
 
+  // Host views of the columns, grabbed once rather than on every access
+  Teuchos::Array<Teuchos::ArrayRCP<ST>> columns;
+
   Tpetra_NullSpace_Traits(const int ndof, const int nscalardof, const int nsdim,
      const LO veclen, array_type &array)
    : Ndof(ndof), NscalarDof(nscalardof), NSdim(nsdim), vec_leng(veclen), Array(array) {}
 
   void zero(){
       Array->putScalar(0.0);
+      columns.resize(Array->getNumVectors());
+      for (size_t j = 0; j < Array->getNumVectors(); ++j) {
+        columns[j] = Array->getDataNonConst(j);
+      }
   }
 
   double &ArrObj(const LO DOF, const int i, const int j){
-     Teuchos::ArrayRCP<ST> rdata = Array->getDataNonConst(j);
-     return rdata[DOF + i];
+     return columns[j][DOF + i];
   }
 
 };
@@ -318,6 +330,7 @@ setPiroPL(const Teuchos::RCP<Teuchos::ParameterList>& piroParams)
   } else {
     traits = Teuchos::rcp( new TraitsImpl<Tpetra_NullSpace_Traits>());
   }
+  nullSpaceVS = Teuchos::null;
 }
 
 void RigidBodyModes::
@@ -416,6 +429,9 @@ setCoordinatesAndNullspace(const Teuchos::RCP<Thyra_MultiVector>& coordMV_in,
   const int numNodes = getSpmdVectorSpace(coordMV->range())->localSubDim();
 
   if (numElasticityDim > 0 || setNonElastRBM == true ) {
+    TEUCHOS_FUNC_TIME_MONITOR("Albany: RigidBodyModes nullspace");
+
+    subtractCentroid(coordMV);
 
     if (isMLUsed()) {
 
@@ -432,8 +448,6 @@ setCoordinatesAndNullspace(const Teuchos::RCP<Thyra_MultiVector>& coordMV_in,
         }
       }
 
-      subtractCentroid(coordMV);
-
       if (setNonElastRBM == true)
         Coord2RBM_nonElasticity<Epetra_NullSpace_Traits>(coordMV, numPDEs, numScalar, nullSpaceDim, err);
       else
@@ -445,27 +459,31 @@ setCoordinatesAndNullspace(const Teuchos::RCP<Thyra_MultiVector>& coordMV_in,
       plist->set("null space: add default vectors", false);
 
     } else {  // MueLu and FROSch
+      TEUCHOS_TEST_FOR_EXCEPTION(
+        soln_vs.is_null(), std::logic_error,
+        "numElasticityDim > 0 and (isMueLuUsed() or isFROSchUsed()): soln_map must be provided.");
+
       using Traits = Tpetra_NullSpace_Traits;
       auto t_traits = Teuchos::rcp_dynamic_cast<TraitsImpl<Traits>>(traits);
       auto& trr = t_traits->arr;
-      trr = Teuchos::rcp(new Tpetra_NullSpace_Traits::base_array_type(getTpetraMap(soln_vs),
-                               nullSpaceDim + numScalar, false));
-
-      subtractCentroid(coordMV);
+      const std::size_t numVectors = nullSpaceDim + numScalar;
+      if (trr.is_null() || soln_vs.get() != nullSpaceVS.get() ||
+          trr->getNumVectors() != numVectors) {
+        trr = Teuchos::rcp(new Tpetra_NullSpace_Traits::base_array_type(getTpetraMap(soln_vs),
+                                 numVectors, false));
+        nullSpaceVS = soln_vs;
+      }
 
       if (setNonElastRBM == true)
         Coord2RBM_nonElasticity<Tpetra_NullSpace_Traits>(coordMV, numPDEs, numScalar, nullSpaceDim, trr);
       else
         Coord2RBM<Tpetra_NullSpace_Traits>(coordMV, numPDEs, numScalar, nullSpaceDim, trr);
 
-      TEUCHOS_TEST_FOR_EXCEPTION(
-        soln_vs.is_null(), std::logic_error,
-        "numElasticityDim > 0 and (isMueLuUsed() or isFROSchUsed()): soln_map must be provided.");
-        if (isMueLuUsed()) {
-          plist->set("Nullspace", trr);
-        } else { // This means that FROSch is used
-          plist->set("Null Space",trr);
-        }
+      if (isMueLuUsed()) {
+        plist->set("Nullspace", trr);
+      } else { // This means that FROSch is used
+        plist->set("Null Space",trr);
+      }
     }
   }
   if(isFROSchUsed()) {
@@ -45,6 +45,9 @@ public:
   //! MueLu or FROSch. The data accessed through getCoordArrays must have
   //! been set. soln_map must be set only if using MueLu and numElasticityDim >
   //! 0. Both maps are nonoverlapping.
+  //! The null space storage belongs to soln_vs, i.e. to one version of the
+  //! discretization: it is allocated when soln_vs changes, and otherwise
+  //! refilled in place, so the preconditioner keeps the same object.
   void setCoordinatesAndNullspace(
     const Teuchos::RCP<Thyra_MultiVector> &coordMV,
     const Teuchos::RCP<const Thyra_VectorSpace>& soln_vs = Teuchos::null,
@@ -61,6 +64,9 @@ private:
 
   Teuchos::RCP<Thyra_MultiVector> coordMV;
 
+  //! Solution vector space the null space storage was allocated for
+  Teuchos::RCP<const Thyra_VectorSpace> nullSpaceVS;
+
   Teuchos::RCP<TraitsImplBase> traits;
 };
 
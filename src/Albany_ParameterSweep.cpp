@@ -0,0 +1,356 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_ParameterSweep.hpp"
+
+#include "Albany_SolverFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+
+#include "Piro_NOXSolver.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+namespace Albany {
+
+ParameterSweep::ParameterSweep(
+    const std::string&                      inputFile_,
+    const Teuchos::RCP<const Teuchos_Comm>& comm_)
+    : inputFile(inputFile_), comm(comm_)
+{
+  TEUCHOS_FUNC_TIME_MONITOR("Albany: Sweep Setup");
+
+  SolverFactory slvrfctry(inputFile, comm);
+
+  Teuchos::ParameterList& appParams = slvrfctry.getParameters();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !appParams.isSublist("Sweep"),
+      std::logic_error,
+      "Error! The input file " << inputFile << " has no 'Sweep' sublist.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !appParams.sublist("Piro").isSublist("NOX"),
+      std::logic_error,
+      "Error! The parameter sweep requires a steady problem solved with NOX.\n");
+
+  Teuchos::ParameterList& sweepParams = appParams.sublist("Sweep");
+  paramVecIndex = sweepParams.get<int>("Parameter Vector", 0);
+  outputFile    = sweepParams.get<std::string>("Output File", "sweep.csv");
+  maxStored     = sweepParams.get<int>("Maximum Stored Solutions", 100);
+  compare       = sweepParams.get<bool>("Compare Against Separate Solves", false);
+  relTol        = sweepParams.get<double>("Relative Tolerance", 1.0e-6);
+  absTol        = sweepParams.get<double>("Absolute Tolerance", 1.0e-10);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      maxStored < 1,
+      std::logic_error,
+      "Error! 'Maximum Stored Solutions' must be positive.\n");
+
+  solver = slvrfctry.createAndGetAlbanyApp(app, comm, comm);
+  model  = Teuchos::rcp_dynamic_cast<ModelEvaluator>(slvrfctry.returnModel());
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      model.is_null() ||
+          Teuchos::rcp_dynamic_cast<Piro::NOXSolver<ST>>(solver).is_null(),
+      std::logic_error,
+      "Error! The parameter sweep requires a steady problem solved with NOX.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      paramVecIndex < 0 || paramVecIndex >= solver->Np(),
+      std::logic_error,
+      "Error! Invalid 'Parameter Vector' (" << paramVecIndex << ").\n");
+
+  // Map the swept parameters to entries of the parameter vector
+  const auto pNames   = *solver->get_p_names(paramVecIndex);
+  const int  numSwept = sweepParams.get<int>("Number of Parameters");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      numSwept < 1,
+      std::logic_error,
+      "Error! 'Number of Parameters' must be positive.\n");
+  for (int i = 0; i < numSwept; ++i) {
+    Teuchos::ParameterList& pList =
+        sweepParams.sublist(Albany::strint("Parameter", i));
+
+    SweptParameter param;
+    param.name  = pList.get<std::string>("Name");
+    param.index = -1;
+    for (int k = 0; k < pNames.size(); ++k) {
+      if (pNames[k] == param.name) { param.index = k; }
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        param.index < 0,
+        std::logic_error,
+        "Error! Parameter '" << param.name << "' is not in parameter vector "
+                             << paramVecIndex << ".\n");
+
+    if (pList.isParameter("Values")) {
+      const auto values = pList.get<Teuchos::Array<double>>("Values");
+      param.values.assign(values.begin(), values.end());
+    } else {
+      const ST  pMin = pList.get<double>("Minimum");
+      const ST  pMax = pList.get<double>("Maximum");
+      const int n    = pList.get<int>("Number of Points");
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          n < 1,
+          std::logic_error,
+          "Error! 'Number of Points' of parameter '" << param.name
+                                                     << "' must be positive.\n");
+      for (int k = 0; k < n; ++k) {
+        param.values.push_back(n == 1 ? pMin : pMin + k * (pMax - pMin) / (n - 1));
+      }
+    }
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        param.values.empty(),
+        std::logic_error,
+        "Error! Parameter '" << param.name << "' has no values.\n");
+
+    const auto bounds = std::minmax_element(param.values.begin(), param.values.end());
+    param.range = *bounds.second - *bounds.first;
+    if (param.range == 0.0) { param.range = 1.0; }
+
+    params.push_back(param);
+  }
+
+  buildPoints(sweepParams.get<std::string>("Sweep Type", "List"));
+
+  // The last response of the NOX solver is the solution itself
+  for (int j = 0; j < solver->Ng() - 1; ++j) {
+    if (app->getResponse(j)->isScalarResponse()) { responseIndices.push_back(j); }
+  }
+
+  initialGuess = model->getNominalValues().get_x()->clone_v();
+}
+
+void
+ParameterSweep::buildPoints(const std::string& sweepType)
+{
+  const int numSwept = params.size();
+  if (sweepType == "List") {
+    const int n = params[0].values.size();
+    for (const auto& param : params) {
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          static_cast<int>(param.values.size()) != n,
+          std::logic_error,
+          "Error! With 'Sweep Type: List', all the parameters must have the "
+          "same number of values.\n");
+    }
+    for (int k = 0; k < n; ++k) {
+      std::vector<ST> point(numSwept);
+      for (int i = 0; i < numSwept; ++i) { point[i] = params[i].values[k]; }
+      points.push_back(point);
+    }
+  } else if (sweepType == "Grid") {
+    // Tensor product, with the first parameter varying fastest, so that
+    // consecutive points are neighbors and make good initial guesses
+    std::vector<int> idx(numSwept, 0);
+    while (true) {
+      std::vector<ST> point(numSwept);
+      for (int i = 0; i < numSwept; ++i) { point[i] = params[i].values[idx[i]]; }
+      points.push_back(point);
+
+      int i = 0;
+      while (i < numSwept && ++idx[i] == static_cast<int>(params[i].values.size())) {
+        idx[i++] = 0;
+      }
+      if (i == numSwept) break;
+    }
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true,
+        std::logic_error,
+        "Error! Invalid 'Sweep Type' (" << sweepType
+                                        << "). Valid choices are 'List' and 'Grid'.\n");
+  }
+}
+
+Teuchos::RCP<const Thyra_Vector>
+ParameterSweep::nearestSolution(const std::vector<ST>& point) const
+{
+  Teuchos::RCP<const Thyra_Vector> nearest;
+  ST                               minDist = std::numeric_limits<ST>::max();
+  for (const auto& s : stored) {
+    ST dist = 0.0;
+    for (size_t i = 0; i < point.size(); ++i) {
+      const ST d = (point[i] - s.point[i]) / params[i].range;
+      dist += d * d;
+    }
+    // Ties go to the most recent solution
+    if (dist <= minDist) {
+      minDist = dist;
+      nearest = s.x;
+    }
+  }
+  return nearest;
+}
+
+Teuchos::RCP<Thyra_Vector>
+ParameterSweep::buildParameterVector(
+    const Thyra_ModelEvaluator& slvr,
+    const std::vector<ST>&      point) const
+{
+  const auto p = slvr.getNominalValues().get_p(paramVecIndex)->clone_v();
+  for (size_t i = 0; i < point.size(); ++i) {
+    Thyra::set_ele(params[i].index, point[i], p.ptr());
+  }
+  return p;
+}
+
+bool
+ParameterSweep::solve(
+    Thyra::ResponseOnlyModelEvaluatorBase<ST>& slvr,
+    const std::vector<ST>&                     point,
+    std::vector<ST>&                           responses,
+    int&                                       numIterations) const
+{
+  Thyra_InArgs inArgs = slvr.createInArgs();
+  inArgs.set_p(paramVecIndex, buildParameterVector(slvr, point));
+
+  Thyra_OutArgs                           outArgs = slvr.createOutArgs();
+  std::vector<Teuchos::RCP<Thyra_Vector>> g;
+  for (const int j : responseIndices) {
+    g.push_back(Thyra::createMember(slvr.get_g_space(j)));
+    outArgs.set_g(j, g.back());
+  }
+
+  slvr.evalModel(inArgs, outArgs);
+
+  auto&       piroSolver = dynamic_cast<Piro::NOXSolver<ST>&>(slvr);
+  const auto& noxSolver  = *piroSolver.getSolver()->getNOXSolver();
+  numIterations          = noxSolver.getNumIterations();
+
+  responses.clear();
+  for (const auto& gj : g) {
+    // Scalar responses are locally replicated
+    const auto gData = getLocalData(gj.getConst());
+    responses.insert(responses.end(), gData.begin(), gData.end());
+  }
+
+  return const_cast<NOX::Solver::Generic&>(noxSolver).getStatus() !=
+         NOX::StatusTest::Failed;
+}
+
+void
+ParameterSweep::writeHeader(std::ostream& os) const
+{
+  os << "point";
+  for (const auto& param : params) { os << "," << param.name; }
+  os << ",converged,nonlinear_iterations";
+  for (const int j : responseIndices) {
+    const int dim = solver->get_g_space(j)->dim();
+    for (int k = 0; k < dim; ++k) {
+      os << ",g" << j;
+      if (dim > 1) { os << "_" << k; }
+    }
+  }
+  os << "\n";
+}
+
+int
+ParameterSweep::run()
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out =
+      Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  const bool    writer = comm->getRank() == 0;
+  std::ofstream table;
+  if (writer) {
+    table.open(outputFile);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        !table.is_open(),
+        std::runtime_error,
+        "Error! Could not open sweep output file " << outputFile << ".\n");
+    table << std::setprecision(15);
+    writeHeader(table);
+  }
+
+  const int                    numPoints = points.size();
+  int                          failures  = 0;
+  std::vector<bool>            converged(numPoints, false);
+  std::vector<std::vector<ST>> sweepResponses(numPoints);
+  for (int pt = 0; pt < numPoints; ++pt) {
+    const auto& point = points[pt];
+
+    // Warm start from the closest point solved so far
+    auto x0 = nearestSolution(point);
+    if (x0.is_null()) { x0 = initialGuess; }
+    Thyra_InArgs nominalValues = model->getNominalValues();
+    nominalValues.set_x(x0);
+    model->setNominalValues(nominalValues);
+
+    int numIterations = 0;
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("Albany: Sweep Solve");
+      converged[pt] = solve(*solver, point, sweepResponses[pt], numIterations);
+    }
+
+    *out << "Sweep point " << pt << " (";
+    for (size_t i = 0; i < point.size(); ++i) {
+      *out << (i > 0 ? ", " : "") << params[i].name << " = " << point[i];
+    }
+    *out << "): " << (converged[pt] ? "converged" : "FAILED") << " in "
+         << numIterations << " nonlinear iterations\n";
+
+    if (converged[pt]) {
+      auto& piroSolver = dynamic_cast<Piro::NOXSolver<ST>&>(*solver);
+      stored.push_back(
+          {point, piroSolver.getSolver()->get_current_x()->clone_v()});
+      if (static_cast<int>(stored.size()) > maxStored) { stored.pop_front(); }
+    } else {
+      ++failures;
+    }
+
+    if (writer) {
+      table << pt;
+      for (const ST v : point) { table << "," << v; }
+      table << "," << (converged[pt] ? 1 : 0) << "," << numIterations;
+      for (const ST v : sweepResponses[pt]) { table << "," << v; }
+      table << std::endl;
+    }
+  }
+
+  if (compare) {
+    // Each point again, from scratch, as a separate Albany run would do
+    int numCompared = 0;
+    for (int pt = 0; pt < numPoints; ++pt) {
+      if (!converged[pt]) continue;
+      ++numCompared;
+
+      SolverFactory             slvrfctry(inputFile, comm);
+      Teuchos::RCP<Application> separateApp;
+      const auto                separateSolver =
+          slvrfctry.createAndGetAlbanyApp(separateApp, comm, comm);
+
+      std::vector<ST> responses;
+      int             numIterations = 0;
+      bool            ok;
+      {
+        TEUCHOS_FUNC_TIME_MONITOR("Albany: Sweep Separate Solve");
+        ok = solve(*separateSolver, points[pt], responses, numIterations);
+      }
+      for (size_t k = 0; ok && k < responses.size(); ++k) {
+        const ST diff = std::abs(responses[k] - sweepResponses[pt][k]);
+        ok = diff <= absTol || diff <= relTol * std::abs(responses[k]);
+      }
+      if (!ok) {
+        ++failures;
+        *out << "Sweep point " << pt
+             << ": responses differ from the ones of a separate solve.\n";
+      }
+    }
+    *out << "Compared " << numCompared << " sweep points against separate solves.\n";
+  }
+
+  *out << "Parameter sweep: " << numPoints << " points, " << failures
+       << " failures. Responses written to " << outputFile << ".\n";
+
+  return failures;
+}
+
+}  // namespace Albany
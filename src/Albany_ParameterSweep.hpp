@@ -0,0 +1,112 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_PARAMETER_SWEEP_HPP
+#define ALBANY_PARAMETER_SWEEP_HPP
+
+#include "Albany_Application.hpp"
+#include "Albany_ModelEvaluator.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+/*!
+ * \brief Solves a steady problem for many values of its scalar parameters,
+ *        in one process and with one Albany::Application.
+ *
+ * The mesh, discretization, Jacobian graph and evaluators are set up once.
+ * Each solve starts from the stored solution of the closest point already
+ * solved (distances are scaled by the range of each parameter), and the
+ * responses of all points are appended to one CSV table.
+ *
+ * Configured by the top level "Sweep" sublist: a "List" sweep zips the
+ * values of the parameters, a "Grid" sweep takes their tensor product.
+ * With "Compare Against Separate Solves", every converged point is solved
+ * again from scratch with a new Application, and its responses are compared
+ * with the ones of the sweep.
+ */
+class ParameterSweep
+{
+ public:
+  ParameterSweep(
+      const std::string&                      inputFile,
+      const Teuchos::RCP<const Teuchos_Comm>& comm);
+
+  //! Runs the sweep; returns the number of failed points and comparisons
+  int
+  run();
+
+ private:
+  struct SweptParameter
+  {
+    std::string      name;
+    int              index;  // entry in the parameter vector
+    std::vector<ST>  values;
+    ST               range;
+  };
+
+  struct StoredSolution
+  {
+    std::vector<ST>                  point;
+    Teuchos::RCP<const Thyra_Vector> x;
+  };
+
+  // Values of the swept parameters at each point of the sweep
+  void
+  buildPoints(const std::string& sweepType);
+
+  // Closest stored solution to the given point, or null if none is stored
+  Teuchos::RCP<const Thyra_Vector>
+  nearestSolution(const std::vector<ST>& point) const;
+
+  // Parameter vector with the swept entries replaced by the given point
+  Teuchos::RCP<Thyra_Vector>
+  buildParameterVector(
+      const Thyra_ModelEvaluator& slvr,
+      const std::vector<ST>&      point) const;
+
+  // Solves at the given point; returns false if NOX failed
+  bool
+  solve(
+      Thyra::ResponseOnlyModelEvaluatorBase<ST>& slvr,
+      const std::vector<ST>&                     point,
+      std::vector<ST>&                           responses,
+      int&                                       numIterations) const;
+
+  void
+  writeHeader(std::ostream& os) const;
+
+  std::string                      inputFile;
+  Teuchos::RCP<const Teuchos_Comm> comm;
+
+  Teuchos::RCP<Application>                               app;
+  Teuchos::RCP<ModelEvaluator>                            model;
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solver;
+
+  int                              paramVecIndex;
+  std::vector<SweptParameter>      params;
+  std::vector<std::vector<ST>>     points;
+  std::vector<int>                 responseIndices;  // scalar responses only
+
+  std::string outputFile;
+  int         maxStored;
+  bool        compare;
+  ST          relTol;
+  ST          absTol;
+
+  Teuchos::RCP<const Thyra_Vector> initialGuess;
+  std::deque<StoredSolution>       stored;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_PARAMETER_SWEEP_HPP
@@ -7,6 +7,7 @@
 #include "Albany_PiroObserver.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 #include "Teuchos_ScalarTraits.hpp"
+#include "Thyra_DetachedVectorView.hpp"
 #include "Thyra_VectorStdOps.hpp"
 
 #include <cstddef>
@@ -14,10 +15,25 @@
 namespace Albany
 {
 
+namespace {
+// All entries of a response vector on every rank. Gathering the detached
+// view is collective, so every rank takes this path, also when the
+// response is locally replicated.
+Teuchos::Array<ST> gatherResponse(const Thyra_Vector& g)
+{
+  const Thyra::ConstDetachedVectorView<ST> view(g);
+  Teuchos::Array<ST> values(view.subDim());
+  for (Thyra::Ordinal k = 0; k < view.subDim(); ++k)
+    values[k] = view[k];
+  return values;
+}
+} // namespace
+
 PiroObserver::
 PiroObserver(const Teuchos::RCP<Application> &app, 
               Teuchos::RCP<const Thyra_ModelEvaluator> model)
  : impl_(app) 
+ , app_(app)
  , model_(model) 
  , out(Teuchos::VerboseObjectBase::getDefaultOStream())
 {
@@ -157,28 +173,46 @@ observeResponse(const ST defaultStamp,
 
   std::map<int,std::string> m_response_index_to_name;
   
-  // build out args and evaluate responses if they exist
-  Thyra::ModelEvaluatorBase::OutArgs<double> outArgs = model_->createOutArgs();
-  if(outArgs.Ng()>0) {
-    // build the in arguments
-    Thyra::ModelEvaluatorBase::InArgs<double> nominal_values = model_->getNominalValues();
+  const int num_g = model_->createOutArgs().Ng();
+  if(num_g>0) {
     Thyra::ModelEvaluatorBase::InArgs<double> inArgs = model_->createInArgs();
-    inArgs.setArgs(nominal_values); 
-    inArgs.set_x(solution);
-    if(inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_x_dot))
-      inArgs.set_x_dot(solution_dot);
-    if (inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_t)) { 
-      const ST time = impl_.getTimeParamValueOrDefault(defaultStamp);
-      inArgs.set_t(time);
+    if(!inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_x_dot))
+      solution_dot = Teuchos::null;
+    const ST time = impl_.getTimeParamValueOrDefault(defaultStamp);
+    if (inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_t))
       *out << "Time = " << time << "\n";  
-    }
-  
-    // set up the output arguments, in this case only the responses
-    for(int i=0;i<outArgs.Ng();i++)
-      outArgs.set_g(i,Thyra::createMember(*model_->get_g_space(i)));
 
-    // Solve the model
-    model_->evalModel(inArgs, outArgs);
+    // The solver usually evaluated the responses at this solution already;
+    // evaluate them again only if it did not.
+    Thyra::ModelEvaluatorBase::InArgs<double> nominal_values = model_->getNominalValues();
+    Teuchos::Array<Teuchos::RCP<const Thyra_Vector> > params(inArgs.Np());
+    for(int l=0;l<inArgs.Np();l++)
+      params[l] = nominal_values.get_p(l);
+    const ST eval_time =
+        inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_t) ? time : 0.0;
+    Teuchos::Array<Teuchos::RCP<const Thyra_Vector> > responses =
+        app_->getObservedResponses(eval_time, solution, solution_dot, params);
+    if(responses.size()!=num_g) {
+      // build the in arguments
+      inArgs.setArgs(nominal_values); 
+      inArgs.set_x(solution);
+      if(Teuchos::nonnull(solution_dot))
+        inArgs.set_x_dot(solution_dot);
+      if (inArgs.supports(Thyra::ModelEvaluatorBase::IN_ARG_t))
+        inArgs.set_t(time);
+
+      // set up the output arguments, in this case only the responses
+      Thyra::ModelEvaluatorBase::OutArgs<double> outArgs = model_->createOutArgs();
+      for(int i=0;i<num_g;i++)
+        outArgs.set_g(i,Thyra::createMember(*model_->get_g_space(i)));
+
+      // Solve the model
+      model_->evalModel(inArgs, outArgs);
+
+      responses.resize(num_g);
+      for(int i=0;i<num_g;i++)
+        responses[i] = outArgs.get_g(i);
+    }
   
     std::size_t precision = 8;
     std::size_t value_width = precision + 7;
@@ -196,11 +230,11 @@ observeResponse(const ST defaultStamp,
     //right now and if in the param list "Relative Responses"="{0}", the code below will compute
     //relative values for all terms in vector Response[0].
     if((!firstResponseObtained) && calculateRelativeResponses ){
-	  storedResponses.resize(outArgs.Ng());
-	  is_relative.resize(outArgs.Ng(), false);
+	  storedResponses.resize(num_g);
+	  is_relative.resize(num_g, false);
     }
 
-    for(int i=0;i<outArgs.Ng();i++) {
+    for(int i=0;i<num_g;i++) {
       std::stringstream ss;
       std::map<int,std::string>::const_iterator itr = m_response_index_to_name.find(i);
       if(itr!=m_response_index_to_name.end())
@@ -211,10 +245,10 @@ observeResponse(const ST defaultStamp,
       //ss << "relative resp size? " << relative_responses.size() << "\n";
       //ss << "relative resp values? " << relative_responses << "\n";
 
-      Teuchos::RCP<Thyra::VectorBase<double> > g = outArgs.get_g(i);
+      const Teuchos::Array<ST> g = gatherResponse(*responses[i]);
       *out << ss.str(); // "   Response[" << i << "] = ";
-      for(Thyra::Ordinal k=0;k<g->space()->dim();k++)
-        *out << std::setw(value_width) << Thyra::get_ele(*g,k) << " ";
+      for(int k=0;k<g.size();k++)
+        *out << std::setw(value_width) << g[k] << " ";
       *out << std::endl;
 
       if(firstResponseObtained && calculateRelativeResponses )
@@ -224,7 +258,7 @@ observeResponse(const ST defaultStamp,
           for( size_t j = 0; j < storedResponses[i].size(); j++){
         	  double prevresp = storedResponses[i][j];
         	  if( std::abs(prevresp) > tol ){
-        		  *out << std::setw(value_width) << (Thyra::get_ele(*g,j) - prevresp)/prevresp << " ";
+        		  *out << std::setw(value_width) << (g[j] - prevresp)/prevresp << " ";
         	  }else{
         		  *out << " N/A(int. value 0) ";
         	  }
@@ -235,19 +269,16 @@ observeResponse(const ST defaultStamp,
       if( (!firstResponseObtained) && calculateRelativeResponses ){
     	  for(int j = 0; j < relative_responses.size(); j++){
     		  int resp_index = relative_responses[j];
-    		  if( (resp_index < outArgs.Ng()) )
+    		  if( (resp_index < num_g) )
     			  is_relative[resp_index] = true;
     	  }
 
       }
       //Save first responses for relative changes in st
       if( (!firstResponseObtained) && calculateRelativeResponses ){
-      	  int gsize = g->space()->dim();
-      	  storedResponses[i].resize(gsize);
-      	  for (int j = 0; j < gsize; j++)
-      		  storedResponses[i][j] = Thyra::get_ele(*g,j);
+      	  storedResponses[i].assign(g.begin(), g.end());
       }//end if !firstRessponseObtained
-    }//end of loop over outArgs.Ng()
+    }//end of loop over responses
     firstResponseObtained = true;
   }
 }
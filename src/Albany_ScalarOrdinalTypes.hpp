@@ -9,9 +9,17 @@
 
 #include <cstdint>
 
+// Get all Albany configuration macros
+#include "Albany_config.h"
+
 typedef double        RealType;
 typedef RealType      ST;
+#ifdef ALBANY_32BIT_GO
+// Meshes with fewer than 2^31 dofs (and entities) can use 4-byte global ids
+typedef std::int32_t  GO;
+#else
 typedef std::int64_t  GO;
+#endif
 typedef std::int32_t  LO;
 
 #endif // ALBANY_SCALAR_ORDINAL_TYPES_HPP
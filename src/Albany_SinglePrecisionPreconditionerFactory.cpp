@@ -0,0 +1,260 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_SinglePrecisionPreconditionerFactory.hpp"
+
+#include "Albany_TpetraThyraUtils.hpp"
+#include "Albany_TpetraTypes.hpp"
+
+#include "Thyra_DefaultPreconditioner.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "TpetraCore_config.h"
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+#include "Ifpack2_Factory.hpp"
+#endif
+
+namespace Albany {
+
+namespace {
+
+#ifdef HAVE_TPETRA_INST_FLOAT
+typedef Tpetra::CrsMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>   Float_CrsMatrix;
+typedef Tpetra::RowMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>   Float_RowMatrix;
+typedef Tpetra::MultiVector<float, Tpetra_LO, Tpetra_GO, KokkosNode> Float_MultiVector;
+typedef Ifpack2::Preconditioner<float, Tpetra_LO, Tpetra_GO, KokkosNode> Float_Preconditioner;
+
+// Double-precision operator applying an Ifpack2 preconditioner computed on a
+// float copy of the Jacobian.
+class SinglePrecisionOperator : public Tpetra_Operator {
+public:
+  SinglePrecisionOperator (const Tpetra_CrsMatrix& A,
+                           const std::string& precType,
+                           const Teuchos::ParameterList& precParams)
+   : num_applies_(0)
+  {
+    A_f_ = Teuchos::rcp(new Float_CrsMatrix(A.getCrsGraph()));
+    A_f_->fillComplete(A.getDomainMap(), A.getRangeMap());
+    copyValues(A);
+
+    const Teuchos::RCP<const Float_RowMatrix> A_row = A_f_;
+    prec_ = Ifpack2::Factory::create<Float_RowMatrix>(precType, A_row);
+    prec_->setParameters(precParams);
+    prec_->initialize();
+    prec_->compute();
+  }
+
+  // The float matrix shares the Jacobian's graph, so only the values change
+  // between Newton steps.
+  bool hasGraphOf (const Tpetra_CrsMatrix& A) const {
+    return A.getCrsGraph() == A_f_->getCrsGraph();
+  }
+
+  void update (const Tpetra_CrsMatrix& A) {
+    copyValues(A);
+    prec_->compute();
+    num_applies_ = 0;
+  }
+
+  size_t getNodeNumEntries () const { return A_f_->getNodeNumEntries(); }
+  int getNumApplies () const { return num_applies_; }
+
+  Teuchos::RCP<const Tpetra_Map> getDomainMap () const { return prec_->getDomainMap(); }
+  Teuchos::RCP<const Tpetra_Map> getRangeMap () const { return prec_->getRangeMap(); }
+
+  void apply (const Tpetra_MultiVector& X, Tpetra_MultiVector& Y,
+              Teuchos::ETransp mode = Teuchos::NO_TRANS,
+              ST alpha = Teuchos::ScalarTraits<ST>::one(),
+              ST beta = Teuchos::ScalarTraits<ST>::zero()) const
+  {
+    const size_t num_vecs = X.getNumVectors();
+    if (X_f_.is_null() || X_f_->getNumVectors() != num_vecs) {
+      X_f_ = Teuchos::rcp(new Float_MultiVector(X.getMap(), num_vecs, false));
+      Y_f_ = Teuchos::rcp(new Float_MultiVector(Y.getMap(), num_vecs, false));
+    }
+    Tpetra::deep_copy(*X_f_, X);
+    prec_->apply(*X_f_, *Y_f_, mode);
+    if (alpha == Teuchos::ScalarTraits<ST>::one() &&
+        beta == Teuchos::ScalarTraits<ST>::zero()) {
+      Tpetra::deep_copy(Y, *Y_f_);
+    } else {
+      Tpetra_MultiVector Z(Y.getMap(), num_vecs, false);
+      Tpetra::deep_copy(Z, *Y_f_);
+      Y.update(alpha, Z, beta);
+    }
+    ++num_applies_;
+  }
+
+private:
+  void copyValues (const Tpetra_CrsMatrix& A) {
+    A_f_->resumeFill();
+    const auto src = A.getLocalMatrix().values;
+    const auto dst = A_f_->getLocalMatrix().values;
+    typedef Kokkos::RangePolicy<KokkosNode::execution_space> Policy;
+    Kokkos::parallel_for("SinglePrecisionOperator::copyValues",
+                         Policy(0, src.extent(0)),
+                         KOKKOS_LAMBDA (const int i) {
+      dst(i) = static_cast<float>(src(i));
+    });
+    A_f_->fillComplete(A.getDomainMap(), A.getRangeMap());
+  }
+
+  Teuchos::RCP<Float_CrsMatrix>      A_f_;
+  Teuchos::RCP<Float_Preconditioner> prec_;
+
+  // Work vectors for the conversions in apply
+  mutable Teuchos::RCP<Float_MultiVector> X_f_, Y_f_;
+  mutable int num_applies_;
+};
+#endif // HAVE_TPETRA_INST_FLOAT
+
+} // namespace
+
+SinglePrecisionPreconditionerFactory::SinglePrecisionPreconditionerFactory ()
+ : paramList_(Teuchos::rcp(new Teuchos::ParameterList(*getValidParameters())))
+{
+  // Nothing to be done here
+}
+
+bool SinglePrecisionPreconditionerFactory::
+isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOp) const
+{
+#ifdef HAVE_TPETRA_INST_FLOAT
+  return Teuchos::nonnull(getConstTpetraMatrix(fwdOp.getOp(), false));
+#else
+  (void) fwdOp;
+  return false;
+#endif
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+SinglePrecisionPreconditionerFactory::createPrec () const
+{
+  return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>());
+}
+
+void SinglePrecisionPreconditionerFactory::
+initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+                Thyra::PreconditionerBase<ST>* prec,
+                const Thyra::ESupportSolveUse /* supportSolveUse */) const
+{
+#ifdef HAVE_TPETRA_INST_FLOAT
+  TEUCHOS_TEST_FOR_EXCEPTION (fwdOpSrc.is_null() || prec==nullptr, std::logic_error,
+                              "Error! Invalid inputs to SinglePrecisionPreconditionerFactory::initializePrec.\n");
+
+  const Teuchos::RCP<const Tpetra_CrsMatrix> A = getConstTpetraMatrix(fwdOpSrc->getOp());
+  auto& defaultPrec = Teuchos::dyn_cast<Thyra::DefaultPreconditioner<ST>>(*prec);
+
+  // Reuse the float matrix and the Ifpack2 symbolic setup if the graph did not change
+  Teuchos::RCP<SinglePrecisionOperator> op;
+  const Teuchos::RCP<Thyra_LinearOp> thyraOp = defaultPrec.getNonconstUnspecifiedPrecOp();
+  if (Teuchos::nonnull(thyraOp)) {
+    op = Teuchos::rcp_dynamic_cast<SinglePrecisionOperator>(getTpetraOperator(thyraOp, false));
+  }
+
+  const Teuchos::RCP<Teuchos::FancyOStream> out = this->getOStream();
+  const bool report = paramList_->get<bool>("Report Statistics");
+  if (Teuchos::nonnull(op) && op->hasGraphOf(*A)) {
+    if (report) {
+      *out << "Single precision preconditioner: " << op->getNumApplies()
+           << " applications since the last update.\n";
+    }
+    op->update(*A);
+  } else {
+    op = Teuchos::rcp(new SinglePrecisionOperator(
+        *A, paramList_->get<std::string>("Prec Type"),
+        paramList_->sublist("Ifpack2 Settings")));
+    defaultPrec.initializeUnspecified(createThyraLinearOp(op));
+
+    if (report) {
+      const double mb = 1024.0*1024.0;
+      const size_t nnz = op->getNodeNumEntries();
+      *out << "Single precision preconditioner: " << nnz << " local nonzeros, "
+           << nnz*sizeof(float)/mb << " MB of matrix values instead of "
+           << nnz*sizeof(ST)/mb << " MB in double precision (saved "
+           << nnz*(sizeof(ST) - sizeof(float))/mb << " MB, plus the same "
+           << "fraction of the preconditioner's own storage).\n";
+    }
+  }
+#else
+  (void) fwdOpSrc;
+  (void) prec;
+  TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error,
+                              "Error! The single precision preconditioner requires Tpetra "
+                              "to be instantiated on float.\n");
+#endif
+}
+
+void SinglePrecisionPreconditionerFactory::
+uninitializePrec (Thyra::PreconditionerBase<ST>* prec,
+                  Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOp,
+                  Thyra::ESupportSolveUse* supportSolveUse) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (prec==nullptr, std::logic_error,
+                              "Error! Invalid input to SinglePrecisionPreconditionerFactory::uninitializePrec.\n");
+
+  // The forward operator is not stored
+  if (fwdOp != nullptr) {
+    *fwdOp = Teuchos::null;
+  }
+  if (supportSolveUse != nullptr) {
+    *supportSolveUse = Thyra::SUPPORT_SOLVE_UNSPECIFIED;
+  }
+  Teuchos::dyn_cast<Thyra::DefaultPreconditioner<ST>>(*prec).uninitialize();
+}
+
+void SinglePrecisionPreconditionerFactory::
+setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (paramList.is_null(), std::logic_error,
+                              "Error! Null parameter list in SinglePrecisionPreconditionerFactory.\n");
+  paramList->validateParametersAndSetDefaults(*getValidParameters(), 0);
+  paramList_ = paramList;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+SinglePrecisionPreconditionerFactory::getNonconstParameterList ()
+{
+  return paramList_;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+SinglePrecisionPreconditionerFactory::unsetParameterList ()
+{
+  const Teuchos::RCP<Teuchos::ParameterList> savedParamList = paramList_;
+  paramList_ = Teuchos::null;
+  return savedParamList;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+SinglePrecisionPreconditionerFactory::getParameterList () const
+{
+  return paramList_;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+SinglePrecisionPreconditionerFactory::getValidParameters () const
+{
+  static Teuchos::RCP<Teuchos::ParameterList> validParamList;
+  if (validParamList.is_null()) {
+    validParamList = Teuchos::rcp(new Teuchos::ParameterList("Ifpack2 Single Precision"));
+    validParamList->set<std::string>("Prec Type", "RILUK",
+                                     "Ifpack2 preconditioner type, computed in single precision");
+    validParamList->sublist("Ifpack2 Settings", false,
+                            "Parameters passed to the Ifpack2 preconditioner").disableRecursiveValidation();
+    validParamList->set<bool>("Report Statistics", true,
+                              "Print the memory saved and the number of applications per update");
+  }
+  return validParamList;
+}
+
+std::string SinglePrecisionPreconditionerFactory::description () const
+{
+  return "Albany::SinglePrecisionPreconditionerFactory";
+}
+
+} // namespace Albany
@@ -0,0 +1,68 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_SINGLE_PRECISION_PRECONDITIONER_FACTORY_HPP
+#define ALBANY_SINGLE_PRECISION_PRECONDITIONER_FACTORY_HPP
+
+#include "Albany_ThyraTypes.hpp"
+
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+/*! \brief Ifpack2 preconditioner built on a single-precision copy of the Jacobian.
+ *
+ *  The Jacobian is still assembled in double precision. On each
+ *  (re)initialization its values are copied to a float matrix sharing the
+ *  Jacobian's graph, and the Ifpack2 preconditioner is computed and applied
+ *  in float. Vectors are converted at the boundaries of apply, so the outer
+ *  Krylov solve stays in double precision. Smoother application is usually
+ *  memory-bandwidth bound, and float halves the bytes read per nonzero.
+ *
+ *  Registered in Stratimikos as "Ifpack2 Single Precision". The parameters
+ *  mirror those of the Stratimikos "Ifpack2" factory ("Prec Type" and
+ *  "Ifpack2 Settings").
+ *
+ *  Requires Tpetra to be instantiated on float (HAVE_TPETRA_INST_FLOAT).
+ */
+class SinglePrecisionPreconditionerFactory
+    : public Thyra::PreconditionerFactoryBase<ST> {
+public:
+  SinglePrecisionPreconditionerFactory();
+
+  /** \name Overridden from Thyra::PreconditionerFactoryBase<ST> . */
+  //@{
+  bool isCompatible (const Thyra::LinearOpSourceBase<ST>& fwdOp) const;
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>> createPrec () const;
+
+  void initializePrec (const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOp,
+                       Thyra::PreconditionerBase<ST>* prec,
+                       const Thyra::ESupportSolveUse supportSolveUse) const;
+
+  void uninitializePrec (Thyra::PreconditionerBase<ST>* prec,
+                         Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOp,
+                         Thyra::ESupportSolveUse* supportSolveUse) const;
+  //@}
+
+  /** \name Overridden from Teuchos::ParameterListAcceptor . */
+  //@{
+  void setParameterList (const Teuchos::RCP<Teuchos::ParameterList>& paramList);
+  Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList ();
+  Teuchos::RCP<Teuchos::ParameterList> unsetParameterList ();
+  Teuchos::RCP<const Teuchos::ParameterList> getParameterList () const;
+  Teuchos::RCP<const Teuchos::ParameterList> getValidParameters () const;
+  //@}
+
+  std::string description () const;
+
+private:
+  Teuchos::RCP<Teuchos::ParameterList> paramList_;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_SINGLE_PRECISION_PRECONDITIONER_FACTORY_HPP
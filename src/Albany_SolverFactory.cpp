@@ -22,6 +22,13 @@
 #include "Schwarz_PiroObserver.hpp"
 #endif
 
+#if defined(ALBANY_LANDICE)
+#include "LandIce_BatchedLaplacianSampler.hpp"
+#if defined(ALBANY_STK)
+#include "LandIce_StaggeredHydrologySolver.hpp"
+#endif
+#endif
+
 #ifdef ALBANY_AERAS
 #include "Aeras/Aeras_HVDecorator.hpp"
 #endif
@@ -34,8 +41,10 @@
 #include "Stratimikos_DefaultLinearSolverBuilder.hpp"
 
 #ifdef ALBANY_IFPACK2
+#include "Albany_SinglePrecisionPreconditionerFactory.hpp"
 #include "Teuchos_AbstractFactoryStd.hpp"
 #include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#include "TpetraCore_config.h"
 #endif /* ALBANY_IFPACK2 */
 
 #ifdef ALBANY_MUELU
@@ -71,6 +80,12 @@ enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder)
   typedef Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix> Impl;
   linearSolverBuilder.setPreconditioningStrategyFactory(
       Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
+#ifdef HAVE_TPETRA_INST_FLOAT
+  // Same, computed and applied on a float copy of the Jacobian
+  typedef Albany::SinglePrecisionPreconditionerFactory SPImpl;
+  linearSolverBuilder.setPreconditioningStrategyFactory(
+      Teuchos::abstractFactoryStd<Base, SPImpl>(), "Ifpack2 Single Precision");
+#endif
 #endif
 }
 
@@ -345,6 +360,14 @@ SolverFactory::createAndGetAlbanyApp(
   }
 #endif /* LCM */
 
+#if defined(ALBANY_LANDICE) && defined(ALBANY_STK)
+  if (solutionMethod == "LandIce Staggered Hydrology") {
+    // WARNING: as for Schwarz Alternating, there is no primary Application
+    // instance and albanyApp is null. The subproblems own their applications.
+    return Teuchos::rcp(new LandIce::StaggeredHydrologySolver(appParams, solverComm));
+  }
+#endif /* LANDICE */
+
   model_ = createAlbanyAppAndModel(albanyApp, appComm, initial_guess, createAlbanyApp);
 
   const Teuchos::RCP<Teuchos::ParameterList> piroParams = Teuchos::sublist(appParams, "Piro");
@@ -385,6 +408,15 @@ SolverFactory::createAndGetAlbanyApp(
     modelWithSolve = rcp(new Thyra::DefaultModelEvaluatorWithSolveFactory<ST>(model_, lowsFactory));
   }
 
+#if defined(ALBANY_LANDICE)
+  if (problemParams->isSublist("Batched Sampling") &&
+      problemParams->get<std::string>("Name") == "LandIce Laplacian Sampling") {
+    // Many samples with one operator setup, instead of a single nonlinear solve
+    return Teuchos::rcp(new LandIce::BatchedLaplacianSampler(
+        albanyApp, modelWithSolve, problemParams->sublist("Batched Sampling")));
+  }
+#endif /* LANDICE */
+
   const auto solMgr = albanyApp->getAdaptSolMgr();
 
   Piro::SolverFactory piroFactory;
@@ -784,6 +816,8 @@ SolverFactory::getValidAppParameters() const
   validPL->sublist("Piro", false, "Piro sublist");
   validPL->sublist("Coupled System", false, "Coupled system sublist");
   validPL->sublist("Alternating System", false, "Alternating system sublist");
+  validPL->sublist("Staggered Coupling", false, "LandIce staggered velocity-hydrology coupling sublist");
+  validPL->sublist("Sweep", false, "In-process parameter sweep sublist (AlbanySweep)");
 
   // validPL->set<std::string>("Jacobian Operator", "Have Jacobian", "Flag to
   // allow Matrix-Free specification in Piro");
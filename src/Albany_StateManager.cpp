@@ -8,6 +8,8 @@
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
+#include <algorithm>
+
 Albany::StateManager::StateManager()
     : stateVarsAreAllocated(false), stateInfo(Teuchos::rcp(new StateInfoStruct))
 {
@@ -55,6 +57,7 @@ Albany::StateManager::registerStateVariable(
       Teuchos::rcp(new Teuchos::ParameterList(
           "Save or Load State " + stateName + " to/from field " + fieldName));
   p->set<const std::string>("State Name", stateName);
+  p->set<int>("State Handle", getStateHandle(stateName));
   p->set<const std::string>("Field Name", fieldName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -87,6 +90,7 @@ Albany::StateManager::registerStateVariable(
       Teuchos::rcp(new Teuchos::ParameterList(
           "Save or Load State " + stateName + " to/from field " + stateName));
   p->set<const std::string>("State Name", stateName);
+  p->set<int>("State Handle", getStateHandle(stateName));
   p->set<const std::string>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -119,6 +123,7 @@ Albany::StateManager::registerNodalVectorStateVariable(
       Teuchos::rcp(new Teuchos::ParameterList(
           "Save or Load State " + stateName + " to/from field " + stateName));
   p->set<const std::string>("State Name", stateName);
+  p->set<int>("State Handle", getStateHandle(stateName));
   p->set<const std::string>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("Dummy Data Layout", dummy);
@@ -151,6 +156,7 @@ Albany::StateManager::registerStateVariable(
       Teuchos::rcp(new Teuchos::ParameterList(
           "Save or Load State " + stateName + " to/from field " + stateName));
   p->set<const std::string>("State Name", stateName);
+  p->set<int>("State Handle", getStateHandle(stateName));
   p->set<const std::string>("Field Name", stateName);
   p->set<const Teuchos::RCP<PHX::DataLayout>>("State Field Layout", dl);
   return p;
@@ -639,6 +645,17 @@ Albany::StateManager::setupStateArrays(
 
   doSetStateArrays(disc, stateInfo);
 
+  // The same state may be registered in several element blocks; its handle
+  // is the first registration
+  sortedStateHandles.clear();
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    const std::string& stateName = (*stateInfo)[i]->name;
+    if (getStateHandle(stateName) == static_cast<int>(i))
+      sortedStateHandles.push_back(std::make_pair(stateName, i));
+  }
+  std::sort(sortedStateHandles.begin(), sortedStateHandles.end());
+  updateStateArrayHandles();
+
   // First, we check the explicitly required side discretizations exist...
   const auto& ss_discs = disc->getSideSetDiscretizations();
   for (auto const& it : sideSetStateInfo) {
@@ -827,6 +844,48 @@ Albany::StateManager::getStateArray(SAType type, const int ws) const
   }
 }
 
+int
+Albany::StateManager::getStateHandle(const std::string& stateName) const
+{
+  for (unsigned int i = 0; i < stateInfo->size(); i++) {
+    if ((*stateInfo)[i]->name == stateName) return i;
+  }
+  return -1;
+}
+
+const std::vector<Albany::MDArray*>&
+Albany::StateManager::getStateArrayHandles(SAType type, const int ws) const
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+
+  switch (type) {
+    case ELEM: return elemStateArrayHandles[ws]; break;
+    case NODE: return nodeStateArrayHandles[ws]; break;
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::logic_error,
+          "Error: Cannot match state array type in getStateArrayHandles()"
+              << std::endl);
+  }
+}
+
+void
+Albany::StateManager::updateStateArrayHandles()
+{
+  ALBANY_ASSERT(stateVarsAreAllocated == true);
+
+  Albany::StateArrays& sa = getStateArrays();
+
+  elemStateArrayHandles.resize(sa.elemStateArrays.size());
+  for (std::size_t ws = 0; ws < sa.elemStateArrays.size(); ++ws)
+    fillStateArrayHandles(sa.elemStateArrays[ws], elemStateArrayHandles[ws]);
+
+  nodeStateArrayHandles.resize(sa.nodeStateArrays.size());
+  for (std::size_t ws = 0; ws < sa.nodeStateArrays.size(); ++ws)
+    fillStateArrayHandles(sa.nodeStateArrays[ws], nodeStateArrayHandles[ws]);
+}
+
 Albany::StateArrays&
 Albany::StateManager::getStateArrays() const
 {
@@ -840,6 +899,7 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
 {
   ALBANY_ASSERT(stateVarsAreAllocated == true);
   disc->setStateArrays(sa);
+  updateStateArrayHandles();
   return;
 }
 
@@ -1241,3 +1301,27 @@ Albany::StateManager::doSetStateArrays(
   }
   *out << std::endl;
 }
+
+void
+Albany::StateManager::fillStateArrayHandles(
+    Albany::StateArray&            sa,
+    std::vector<Albany::MDArray*>& handles) const
+{
+  handles.assign(stateInfo->size(), nullptr);
+
+  // Both the state array and the handle list are sorted by name, so a
+  // single merge pass fills the table.
+  auto it    = sa.begin();
+  auto it_sh = sortedStateHandles.begin();
+  while (it != sa.end() && it_sh != sortedStateHandles.end()) {
+    if (it->first < it_sh->first) {
+      ++it;
+    } else if (it_sh->first < it->first) {
+      ++it_sh;
+    } else {
+      handles[it_sh->second] = &it->second;
+      ++it;
+      ++it_sh;
+    }
+  }
+}
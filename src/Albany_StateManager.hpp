@@ -226,6 +226,23 @@ class StateManager
   Albany::StateArrays&
   getStateArrays() const;
 
+  /// Integer handle of a registered state, or -1 if no such state. Handles
+  /// are assigned in registration order and do not change afterwards
+  int
+  getStateHandle(const std::string& stateName) const;
+
+  /// Table of the state arrays of a workset indexed by state handle, so that
+  /// evaluators can reach their state without a name lookup. Entries of
+  /// states not stored in this workset are null
+  const std::vector<Albany::MDArray*>&
+  getStateArrayHandles(SAType type, int ws) const;
+
+  /// Rebuild the handle tables of all worksets. The tables are built with the
+  /// state arrays; call this when the discretization rebuilds its state
+  /// arrays, e.g., after the mesh is updated
+  void
+  updateStateArrayHandles();
+
   // Set the state array for all worksets.
   void
   setStateArrays(Albany::StateArrays& sa);
@@ -290,6 +307,11 @@ class StateManager
       const Teuchos::RCP<Albany::AbstractDiscretization>& disc,
       const Teuchos::RCP<StateInfoStruct>&                stateInfoPtr);
 
+  /// Fills the handle table of one workset from its state array
+  void
+  fillStateArrayHandles(
+      Albany::StateArray& sa, std::vector<Albany::MDArray*>& handles) const;
+
   /// boolean to enforce that allocate gets called once, and after registration
   /// and befor gets
   bool stateVarsAreAllocated;
@@ -306,6 +328,15 @@ class StateManager
 
   /// NEW WAY
   Teuchos::RCP<StateInfoStruct> stateInfo;
+
+  /// Registered (state name, handle) pairs sorted by name, built once the
+  /// states are allocated
+  std::vector<std::pair<std::string, int>> sortedStateHandles;
+
+  /// Per-workset tables of state arrays indexed by handle
+  std::vector<std::vector<Albany::MDArray*>> elemStateArrayHandles;
+  std::vector<std::vector<Albany::MDArray*>> nodeStateArrayHandles;
+
   std::map<std::string, Teuchos::RCP<StateInfoStruct>>
       sideSetStateInfo;  // A map sideSetName->stateInfoBd
 
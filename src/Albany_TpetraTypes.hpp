@@ -40,7 +40,13 @@
 #endif
 
 typedef int Tpetra_LO;
-#if defined( HAVE_TPETRA_INST_INT_LONG_LONG )
+#if defined( ALBANY_32BIT_GO )
+#if defined( HAVE_TPETRA_INST_INT_INT )
+typedef int Tpetra_GO;
+#else
+#error "Albany was configured with 32-bit global ordinals, but Tpetra does not enable int as a GlobalOrdinal"
+#endif
+#elif defined( HAVE_TPETRA_INST_INT_LONG_LONG )
 typedef long long Tpetra_GO;
 #elif defined( HAVE_TPETRA_INST_INT_LONG )
 static_assert(sizeof(long) == sizeof(GO),
@@ -54,6 +60,10 @@ typedef unsigned long Tpetra_GO;
 #error "Albany needs a 64-bit GlobalOrdinal enabled in Tpetra"
 #endif
 
+// Albany reinterprets arrays of GO as arrays of Tpetra_GO
+static_assert(sizeof(Tpetra_GO) == sizeof(GO),
+    "Tpetra_GO and GO must have the same size");
+
 typedef Tpetra::Map<Tpetra_LO, Tpetra_GO, KokkosNode>                 Tpetra_Map;
 typedef Tpetra::Export<Tpetra_LO, Tpetra_GO, KokkosNode>              Tpetra_Export;
 typedef Tpetra::Import<Tpetra_LO, Tpetra_GO, KokkosNode>              Tpetra_Import;
@@ -8,6 +8,7 @@
 
 #include "Albany_Macros.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "utility/PerformanceContext.hpp"
 
 // Include the concrete Epetra Comm's, if needed
 #if defined(ALBANY_EPETRA)
@@ -19,11 +20,14 @@
 #endif
 
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <stdexcept>
 #include <time.h>
 
 #include "MatrixMarket_Tpetra.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 #include "Kokkos_Macros.hpp"
 
 // For vtune
@@ -404,7 +408,8 @@ CmdLineArgs::CmdLineArgs(
       has_first_yaml_file(false),
       has_second_yaml_file(false),
       has_third_yaml_file(false),
-      vtune(false)
+      vtune(false),
+      timers_filename("")
 {
 }
 
@@ -416,11 +421,14 @@ CmdLineArgs::parse_cmdline(int argc, char** argv, std::ostream& os)
   for (int arg = 1; arg < argc; ++arg) {
     if (!std::strcmp(argv[arg], "--help")) {
       os << argv[0]
-         << " [--vtune] [inputfile1.yaml] [inputfile2.yaml] "
-            "[inputfile3.yaml]\n";
+         << " [--vtune] [--timers timers.json] [inputfile1.yaml] "
+            "[inputfile2.yaml] [inputfile3.yaml]\n";
       std::exit(1);
     } else if (!std::strcmp(argv[arg], "--vtune")) {
       vtune = true;
+    } else if (!std::strcmp(argv[arg], "--timers")) {
+      ALBANY_ASSERT(arg + 1 < argc, "--timers requires a file name");
+      timers_filename = argv[++arg];
     } else {
       if (!found_first_yaml_file) {
         yaml_filename         = argv[arg];
@@ -438,6 +446,53 @@ CmdLineArgs::parse_cmdline(int argc, char** argv, std::ostream& os)
   }
 }
 
+void
+writeTimerStatistics(
+    const std::string&                      filename,
+    const Teuchos::RCP<const Teuchos_Comm>& comm)
+{
+  Teuchos::TimeMonitor::stat_map_type stat_data;
+  std::vector<std::string>            stat_names;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(
+      stat_data, stat_names, comm.ptr(), Teuchos::Union);
+  if (comm->getRank() != 0) return;
+
+  std::ofstream ofs(filename);
+  ALBANY_ASSERT(ofs.good(), "Cannot open timer statistics file " << filename);
+  // Timer names may contain quotes or backslashes
+  auto const quoted = [](std::string const& str) {
+    std::string q = "\"";
+    for (char const c : str) {
+      if (c == '"' || c == '\\') q += '\\';
+      q += c;
+    }
+    return q + "\"";
+  };
+
+  ofs << std::setprecision(9);
+  ofs << "{\n  \"num_procs\": " << comm->getSize() << ",\n  \"timers\": {";
+  char const* sep = "\n";
+  for (auto const& timer : stat_data) {
+    ofs << sep << "    " << quoted(timer.first) << ": {";
+    for (size_t i = 0; i < stat_names.size(); ++i) {
+      ofs << (i == 0 ? "" : ", ") << quoted(stat_names[i]) << ": "
+          << timer.second[i].first;
+    }
+    ofs << ", \"Calls\": " << timer.second[0].second << "}";
+    sep = ",\n";
+  }
+  // PerformanceContext timers are not registered with Teuchos::TimeMonitor
+  // and are reported as measured on rank 0
+  for (auto const& timer :
+       util::PerformanceContext::instance().timeMonitor().items()) {
+    ofs << sep << "    " << quoted("PerformanceContext: " + timer.first)
+        << ": {\"Rank0\": " << timer.second->totalElapsedTime()
+        << ", \"Calls\": " << timer.second->numCalls() << "}";
+    sep = ",\n";
+  }
+  ofs << "\n  }\n}\n";
+}
+
 void
 connect_vtune(const int p_rank)
 {
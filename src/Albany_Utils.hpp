@@ -192,6 +192,7 @@ struct CmdLineArgs
   bool        has_second_yaml_file;
   bool        has_third_yaml_file;
   bool        vtune;
+  std::string timers_filename;
 
   CmdLineArgs(
       const std::string& default_yaml_filename  = "input.yaml",
@@ -201,6 +202,13 @@ struct CmdLineArgs
   parse_cmdline(int argc, char** argv, std::ostream& os);
 };
 
+// Write min/mean/max over ranks of every TimeMonitor timer, and its call
+// count, to a JSON file (on rank 0) for the performance regression harness
+void
+writeTimerStatistics(
+    const std::string&                      filename,
+    const Teuchos::RCP<const Teuchos_Comm>& comm);
+
 // Connect executable to vtune for profiling
 void
 connect_vtune(const int p_rank);
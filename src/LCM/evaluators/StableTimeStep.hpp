@@ -0,0 +1,68 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef STABLE_TIME_STEP_HPP
+#define STABLE_TIME_STEP_HPP
+
+#include "Albany_Layouts.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Phalanx_config.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+
+namespace LCM {
+/**
+ * \brief Evaluates the critical time step of explicit dynamics per element.
+ *
+ * dt = safety factor * h / c, with h the smallest distance between two
+ * nodes of the element in the current configuration and c the dilatational
+ * wave speed sqrt((lambda + 2 mu) / rho) from the elastic modulus and
+ * Poisson's ratio at the integration points. The element value is stored at
+ * every integration point, so that a "Field Value" response with operation
+ * "Minimize" on this field yields the global stable time step.
+ */
+
+template <typename EvalT, typename Traits>
+class StableTimeStep : public PHX::EvaluatorWithBaseImpl<Traits>,
+                       public PHX::EvaluatorDerived<EvalT, Traits>
+{
+ public:
+  using ScalarT = typename EvalT::ScalarT;
+
+  StableTimeStep(
+      const Teuchos::ParameterList&        p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
+
+  void
+  postRegistrationSetup(
+      typename Traits::SetupData d,
+      PHX::FieldManager<Traits>& vm);
+
+  void
+  evaluateFields(typename Traits::EvalData d);
+
+ private:
+  //! Input: nodal coordinates in the current configuration
+  PHX::MDField<const ScalarT, Cell, Node, Dim> current_coords_;
+  //! Input: elastic modulus
+  PHX::MDField<const ScalarT, Cell, QuadPoint> elastic_modulus_;
+  //! Input: Poisson's ratio
+  PHX::MDField<const ScalarT, Cell, QuadPoint> poissons_ratio_;
+  //! Output: critical time step
+  PHX::MDField<ScalarT, Cell, QuadPoint> stable_dt_;
+
+  int num_nodes_;
+  int num_pts_;
+  int num_dims_;
+
+  RealType density_;
+  RealType safety_factor_;
+};
+}  // namespace LCM
+
+#endif
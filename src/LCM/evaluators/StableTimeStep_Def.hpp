@@ -0,0 +1,98 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <cmath>
+
+#include "Phalanx_DataLayout.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace LCM {
+
+template <typename EvalT, typename Traits>
+StableTimeStep<EvalT, Traits>::StableTimeStep(
+    const Teuchos::ParameterList&        p,
+    const Teuchos::RCP<Albany::Layouts>& dl)
+    : current_coords_(
+          p.get<std::string>("Current Coordinates Name"),
+          dl->node_vector),
+      elastic_modulus_(
+          p.get<std::string>("Elastic Modulus Name"),
+          dl->qp_scalar),
+      poissons_ratio_(p.get<std::string>("Poissons Ratio Name"), dl->qp_scalar),
+      stable_dt_(p.get<std::string>("Stable Time Step Name"), dl->qp_scalar),
+      density_(p.get<RealType>("Density")),
+      safety_factor_(p.get<RealType>("Safety Factor", 1.0))
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      density_ <= 0.0,
+      std::logic_error,
+      "Error! The stable time step needs a positive Density, got "
+          << density_ << ".\n");
+
+  this->addDependentField(current_coords_);
+  this->addDependentField(elastic_modulus_);
+  this->addDependentField(poissons_ratio_);
+  this->addEvaluatedField(stable_dt_);
+
+  this->setName("StableTimeStep" + PHX::print<EvalT>());
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  dl->node_qp_vector->dimensions(dims);
+  num_nodes_ = dims[1];
+  num_pts_   = dims[2];
+  num_dims_  = dims[3];
+}
+
+// **********************************************************************
+template <typename EvalT, typename Traits>
+void
+StableTimeStep<EvalT, Traits>::postRegistrationSetup(
+    typename Traits::SetupData d,
+    PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(current_coords_, fm);
+  this->utils.setFieldData(elastic_modulus_, fm);
+  this->utils.setFieldData(poissons_ratio_, fm);
+  this->utils.setFieldData(stable_dt_, fm);
+}
+
+// **********************************************************************
+template <typename EvalT, typename Traits>
+void
+StableTimeStep<EvalT, Traits>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    // Element size: smallest distance between two of its nodes
+    ScalarT h2 = 0.0;
+    for (int i = 0; i < num_nodes_; ++i) {
+      for (int j = i + 1; j < num_nodes_; ++j) {
+        ScalarT d2 = 0.0;
+        for (int k = 0; k < num_dims_; ++k) {
+          ScalarT const dx =
+              current_coords_(cell, i, k) - current_coords_(cell, j, k);
+          d2 += dx * dx;
+        }
+        if ((i == 0 && j == 1) || d2 < h2) h2 = d2;
+      }
+    }
+
+    // Largest dilatational wave speed over the integration points
+    ScalarT c2 = 0.0;
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      ScalarT const E  = elastic_modulus_(cell, pt);
+      ScalarT const nu = poissons_ratio_(cell, pt);
+      ScalarT const M  = E * (1.0 - nu) / ((1.0 + nu) * (1.0 - 2.0 * nu));
+      ScalarT const cp2 = M / density_;
+      if (pt == 0 || cp2 > c2) c2 = cp2;
+    }
+
+    ScalarT const dt = safety_factor_ * std::sqrt(h2 / c2);
+    for (int pt = 0; pt < num_pts_; ++pt) stable_dt_(cell, pt) = dt;
+  }
+}
+
+}  // namespace LCM
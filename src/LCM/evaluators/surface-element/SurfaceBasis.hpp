@@ -57,52 +57,61 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>,
   evaluateFields(typename Traits::EvalData d);
 
   ///
-  /// Takes given coordinates and computes the corresponding midplane
-  /// \param refCoords
-  /// \param midplane_coords
-  ///
-  template <typename ST>
-  void
-  computeMidplaneCoords(
-      PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
-      Kokkos::DynRankView<ST, PHX::Device>&           midplane_coords);
-
-  ///
-  /// Computes basis from the reference midplane
-  /// \param midplane_coords
+  /// Computes basis from the midplane of the given coordinates
+  /// \param cell
+  /// \param coords
   /// \param basis
   ///
   template <typename ST>
-  void
+  KOKKOS_INLINE_FUNCTION void
   computeBasisVectors(
-      Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords,
-      PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis);
+      int const                                       cell,
+      PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
+      PHX::MDField<ST, Cell, QuadPoint, Dim, Dim>     basis) const;
 
   ///
-  /// Computes the Dual from the midplane and reference bases
-  /// \param midplane_coords
+  /// Computes the Dual from the reference bases
+  /// \param cell
   /// \param basis
   /// \param normal
   /// \param dual_basis
   ///
-  void
+  KOKKOS_INLINE_FUNCTION void
   computeDualBasisVectors(
-      Kokkos::DynRankView<MeshScalarT, PHX::Device> const& midplane_coords,
+      int const                                                  cell,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis);
+      PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> dual_basis) const;
 
   ///
   /// Computes the jacobian mapping - da/dA
+  /// \param cell
   /// \param basis
   /// \param dual_basis
   /// \param area
   ///
-  void
+  KOKKOS_INLINE_FUNCTION void
   computeJacobian(
+      int const                                                  cell,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-      PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area);
+      PHX::MDField<MeshScalarT, Cell, QuadPoint> area) const;
+
+  ///
+  /// Kokkos kernel: all the surface quantities of one cell
+  ///
+  struct SurfaceBasis_Tag
+  {
+  };
+
+  using ExecutionSpace = Kokkos::View<int***, PHX::Device>::execution_space;
+
+  using SurfaceBasis_Policy =
+      Kokkos::RangePolicy<ExecutionSpace, SurfaceBasis_Tag>;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(SurfaceBasis_Tag const& tag, int const& cell) const;
 
  private:
   unsigned int container_size, num_dims_, num_nodes_, num_qps_, num_surf_nodes_,
@@ -126,16 +135,6 @@ class SurfaceBasis : public PHX::EvaluatorWithBaseImpl<Traits>,
   Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>>
       intrepid_basis_;
 
-  ///
-  /// Local View to store the reference midplane_coords
-  ///
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> ref_midplane_coords_;
-
-  ///
-  /// Local View to store the current midplane_coords
-  ///
-  Kokkos::DynRankView<ScalarT, PHX::Device> current_midplane_coords_;
-
   ///
   /// Output: Reference basis
   ///
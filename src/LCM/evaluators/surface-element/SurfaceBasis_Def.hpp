@@ -114,22 +114,6 @@ SurfaceBasis<EvalT, Traits>::postRegistrationSetup(
       "XXX", num_qps_, num_surf_dims_);
   ref_weights_ = Kokkos::DynRankView<RealType, PHX::Device>("XXX", num_qps_);
 
-  // temp space for midplane coords
-  ref_midplane_coords_ = Kokkos::createDynRankView(
-      reference_coords_.get_view(),
-      "XXX",
-      container_size,
-      num_surf_nodes_,
-      num_dims_);
-  if (need_current_basis_ == true) {
-    current_midplane_coords_ = Kokkos::createDynRankView(
-        current_coords_.get_view(),
-        "XXX",
-        container_size,
-        num_surf_nodes_,
-        num_dims_);
-  }
-
   // Pre-Calculate reference element quantitites
   cubature_->getCubature(ref_points_, ref_weights_);
   intrepid_basis_->getValues(
@@ -141,32 +125,25 @@ SurfaceBasis<EvalT, Traits>::postRegistrationSetup(
 //
 //
 template <typename EvalT, typename Traits>
-void
-SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceBasis<EvalT, Traits>::operator()(
+    SurfaceBasis_Tag const& tag,
+    int const&              cell) const
 {
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    // for the reference geometry
-    // compute the mid-plane coordinates
-    computeMidplaneCoords(reference_coords_, ref_midplane_coords_);
+  // for the reference geometry
+  // compute basis vectors
+  computeBasisVectors(cell, reference_coords_, ref_basis_);
 
-    // compute basis vectors
-    computeBasisVectors(ref_midplane_coords_, ref_basis_);
+  // compute the dual
+  computeDualBasisVectors(cell, ref_basis_, ref_normal_, ref_dual_basis_);
 
-    // compute the dual
-    computeDualBasisVectors(
-        ref_midplane_coords_, ref_basis_, ref_normal_, ref_dual_basis_);
+  // compute the Jacobian
+  computeJacobian(cell, ref_basis_, ref_dual_basis_, ref_area_);
 
-    // compute the Jacobian
-    computeJacobian(ref_basis_, ref_dual_basis_, ref_area_);
-
-    if (need_current_basis_) {
-      // for the current configuration
-      // compute the mid-plane coordinates
-      computeMidplaneCoords(current_coords_, current_midplane_coords_);
-
-      // compute base vectors
-      computeBasisVectors(current_midplane_coords_, current_basis_);
-    }
+  if (need_current_basis_) {
+    // for the current configuration
+    // compute base vectors
+    computeBasisVectors(cell, current_coords_, current_basis_);
   }
 }
 
@@ -174,23 +151,10 @@ SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 //
 //
 template <typename EvalT, typename Traits>
-template <typename ST>
 void
-SurfaceBasis<EvalT, Traits>::computeMidplaneCoords(
-    PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
-    Kokkos::DynRankView<ST, PHX::Device>&           midplane_coords)
+SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // compute the mid-plane coordinates
-    for (int node(0); node < num_surf_nodes_; ++node) {
-      int top_node = node + num_surf_nodes_;
-
-      for (int dim(0); dim < num_dims_; ++dim) {
-        midplane_coords(cell, node, dim) =
-            0.5 * (coords(cell, node, dim) + coords(cell, top_node, dim));
-      }
-    }
-  }
+  Kokkos::parallel_for(SurfaceBasis_Policy(0, workset.numCells), *this);
 }
 
 //
@@ -198,41 +162,35 @@ SurfaceBasis<EvalT, Traits>::computeMidplaneCoords(
 //
 template <typename EvalT, typename Traits>
 template <typename ST>
-void
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeBasisVectors(
-    Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords,
-    PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis)
+    int const                                       cell,
+    PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
+    PHX::MDField<ST, Cell, QuadPoint, Dim, Dim>     basis) const
 {
-  for (int cell(0); cell < midplane_coords.extent(0); ++cell) {
-    // get the midplane coordinates
-    std::vector<minitensor::Vector<ST>> midplane_nodes(num_surf_nodes_);
+  minitensor::Vector<ST, 3> g_0, g_1, g_2, midplane_node;
 
+  // compute the base vectors
+  for (int pt(0); pt < num_qps_; ++pt) {
+    g_0.fill(minitensor::Filler::ZEROS);
+    g_1.fill(minitensor::Filler::ZEROS);
     for (int node(0); node < num_surf_nodes_; ++node) {
-      midplane_nodes[node] = minitensor::Vector<ST>(
-          minitensor::Source::ARRAY, 3, midplane_coords, cell, node, 0);
-    }
-
-    minitensor::Vector<ST> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
+      int top_node = node + num_surf_nodes_;
 
-    // compute the base vectors
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0.fill(minitensor::Filler::ZEROS);
-      g_1.fill(minitensor::Filler::ZEROS);
-      for (int node(0); node < num_surf_nodes_; ++node) {
-        g_0 += ref_grads_(node, pt, 0) * midplane_nodes[node];
-        g_1 += ref_grads_(node, pt, 1) * midplane_nodes[node];
+      // the mid-plane coordinates
+      for (int dim(0); dim < 3; ++dim) {
+        midplane_node(dim) =
+            0.5 * (coords(cell, node, dim) + coords(cell, top_node, dim));
       }
-      g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
-
-      basis(cell, pt, 0, 0) = g_0(0);
-      basis(cell, pt, 0, 1) = g_0(1);
-      basis(cell, pt, 0, 2) = g_0(2);
-      basis(cell, pt, 1, 0) = g_1(0);
-      basis(cell, pt, 1, 1) = g_1(1);
-      basis(cell, pt, 1, 2) = g_1(2);
-      basis(cell, pt, 2, 0) = g_2(0);
-      basis(cell, pt, 2, 1) = g_2(1);
-      basis(cell, pt, 2, 2) = g_2(2);
+      g_0 += ref_grads_(node, pt, 0) * midplane_node;
+      g_1 += ref_grads_(node, pt, 1) * midplane_node;
+    }
+    g_2 = minitensor::unit(minitensor::cross(g_0, g_1));
+
+    for (int dim(0); dim < 3; ++dim) {
+      basis(cell, pt, 0, dim) = g_0(dim);
+      basis(cell, pt, 1, dim) = g_1(dim);
+      basis(cell, pt, 2, dim) = g_2(dim);
     }
   }
 }
@@ -241,51 +199,36 @@ SurfaceBasis<EvalT, Traits>::computeBasisVectors(
 //
 //
 template <typename EvalT, typename Traits>
-void
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
-    Kokkos::DynRankView<MeshScalarT, PHX::Device> const&       midplane_coords,
+    int const                                                  cell,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim>            normal,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim>       dual_basis)
+    PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> dual_basis) const
 {
-  int worksetSize = midplane_coords.extent(0);
+  minitensor::Vector<MeshScalarT, 3> g_0, g_1, g_2, g0, g1, g2;
 
-  minitensor::Vector<MeshScalarT> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
+  for (int pt(0); pt < num_qps_; ++pt) {
+    for (int dim(0); dim < 3; ++dim) {
+      g_0(dim) = basis(cell, pt, 0, dim);
+      g_1(dim) = basis(cell, pt, 1, dim);
+      g_2(dim) = basis(cell, pt, 2, dim);
 
-  minitensor::Vector<MeshScalarT> g0(0, 0, 0), g1(0, 0, 0), g2(0, 0, 0);
-
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      g_0 = minitensor::Vector<MeshScalarT>(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
-
-      g_1 = minitensor::Vector<MeshScalarT>(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 1, 0);
-
-      g_2 = minitensor::Vector<MeshScalarT>(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
-
-      normal(cell, pt, 0) = g_2(0);
-      normal(cell, pt, 1) = g_2(1);
-      normal(cell, pt, 2) = g_2(2);
+      normal(cell, pt, dim) = g_2(dim);
+    }
 
-      g0 = minitensor::cross(g_1, g_2);
-      g1 = minitensor::cross(g_0, g_2);
-      g2 = minitensor::cross(g_0, g_1);
+    g0 = minitensor::cross(g_1, g_2);
+    g1 = minitensor::cross(g_0, g_2);
+    g2 = minitensor::cross(g_0, g_1);
 
-      g0 = g0 / dot(g_0, g0);
-      g1 = g1 / dot(g_1, g1);
-      g2 = g2 / dot(g_2, g2);
+    g0 = g0 / dot(g_0, g0);
+    g1 = g1 / dot(g_1, g1);
+    g2 = g2 / dot(g_2, g2);
 
-      dual_basis(cell, pt, 0, 0) = g0(0);
-      dual_basis(cell, pt, 0, 1) = g0(1);
-      dual_basis(cell, pt, 0, 2) = g0(2);
-      dual_basis(cell, pt, 1, 0) = g1(0);
-      dual_basis(cell, pt, 1, 1) = g1(1);
-      dual_basis(cell, pt, 1, 2) = g1(2);
-      dual_basis(cell, pt, 2, 0) = g2(0);
-      dual_basis(cell, pt, 2, 1) = g2(1);
-      dual_basis(cell, pt, 2, 2) = g2(2);
+    for (int dim(0); dim < 3; ++dim) {
+      dual_basis(cell, pt, 0, dim) = g0(dim);
+      dual_basis(cell, pt, 1, dim) = g1(dim);
+      dual_basis(cell, pt, 2, dim) = g2(dim);
     }
   }
 }
@@ -294,33 +237,32 @@ SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
 //
 //
 template <typename EvalT, typename Traits>
-void
+KOKKOS_INLINE_FUNCTION void
 SurfaceBasis<EvalT, Traits>::computeJacobian(
+    int const                                                  cell,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
-    PHX::MDField<MeshScalarT, Cell, QuadPoint>                 area)
+    PHX::MDField<MeshScalarT, Cell, QuadPoint> area) const
 {
-  const int worksetSize = basis.extent(0);
-
-  for (int cell(0); cell < worksetSize; ++cell) {
-    for (int pt(0); pt < num_qps_; ++pt) {
-      minitensor::Tensor<MeshScalarT> dPhiInv(
-          minitensor::Source::ARRAY, 3, dual_basis, cell, pt, 0, 0);
-
-      minitensor::Tensor<MeshScalarT> dPhi(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
-
-      minitensor::Vector<MeshScalarT> G_2(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
-
-      MeshScalarT j0 = minitensor::det(dPhi);
-      MeshScalarT jacobian =
-          j0 *
-          std::sqrt(minitensor::dot(
-              minitensor::dot(G_2, minitensor::transpose(dPhiInv) * dPhiInv),
-              G_2));
-      area(cell, pt) = jacobian * ref_weights_(pt);
+  minitensor::Tensor<MeshScalarT, 3> dPhiInv, dPhi;
+  minitensor::Vector<MeshScalarT, 3> G_2;
+
+  for (int pt(0); pt < num_qps_; ++pt) {
+    for (int i(0); i < 3; ++i) {
+      for (int j(0); j < 3; ++j) {
+        dPhiInv(i, j) = dual_basis(cell, pt, i, j);
+        dPhi(i, j)    = basis(cell, pt, i, j);
+      }
+      G_2(i) = basis(cell, pt, 2, i);
     }
+
+    MeshScalarT j0 = minitensor::det(dPhi);
+    MeshScalarT jacobian =
+        j0 *
+        std::sqrt(minitensor::dot(
+            minitensor::dot(G_2, minitensor::transpose(dPhiInv) * dPhiInv),
+            G_2));
+    area(cell, pt) = jacobian * ref_weights_(pt);
   }
 }
 
@@ -38,6 +38,18 @@ class SurfaceCohesiveResidual : public PHX::EvaluatorWithBaseImpl<Traits>,
   void
   evaluateFields(typename Traits::EvalData d);
 
+  struct SurfaceCohesiveResidual_Tag
+  {
+  };
+
+  using ExecutionSpace = Kokkos::View<int***, PHX::Device>::execution_space;
+
+  using SurfaceCohesiveResidual_Policy = Kokkos::RangePolicy<ExecutionSpace, SurfaceCohesiveResidual_Tag>;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(SurfaceCohesiveResidual_Tag const& tag, int const& cell) const;
+
  private:
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
@@ -82,41 +82,45 @@ SurfaceCohesiveResidual<EvalT, Traits>::postRegistrationSetup(
 
 //**********************************************************************
 template <typename EvalT, typename Traits>
-void
-SurfaceCohesiveResidual<EvalT, Traits>::evaluateFields(
-    typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceCohesiveResidual<EvalT, Traits>::operator()(
+    SurfaceCohesiveResidual_Tag const& tag,
+    int const&                         cell) const
 {
-  minitensor::Vector<ScalarT> f_plus(0, 0, 0);
+  ScalarT f_plus[3];
 
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    for (int bottom_node(0); bottom_node < num_surf_nodes_; ++bottom_node) {
-      int top_node = bottom_node + num_surf_nodes_;
+  for (int bottom_node(0); bottom_node < num_surf_nodes_; ++bottom_node) {
+    int top_node = bottom_node + num_surf_nodes_;
 
-      // initialize force vector
-      f_plus.fill(minitensor::Filler::ZEROS);
+    // initialize force vector
+    f_plus[0] = 0.0;
+    f_plus[1] = 0.0;
+    f_plus[2] = 0.0;
 
-      for (int pt(0); pt < num_qps_; ++pt) {
-        // refValues(numPlaneNodes, numQPs) = shape function
-        // refArea(numCells, numQPs) = |Jacobian|*weight
-        f_plus(0) += cohesive_traction_(cell, pt, 0) *
-                     ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-        f_plus(1) += cohesive_traction_(cell, pt, 1) *
+    for (int pt(0); pt < num_qps_; ++pt) {
+      // refValues(numPlaneNodes, numQPs) = shape function
+      // refArea(numCells, numQPs) = |Jacobian|*weight
+      for (int i(0); i < 3; ++i) {
+        f_plus[i] += cohesive_traction_(cell, pt, i) *
                      ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-        f_plus(2) += cohesive_traction_(cell, pt, 2) *
-                     ref_values_(bottom_node, pt) * ref_area_(cell, pt);
-
-      }  // end of pt loop
-
-      force_(cell, bottom_node, 0) = -f_plus(0);
-      force_(cell, bottom_node, 1) = -f_plus(1);
-      force_(cell, bottom_node, 2) = -f_plus(2);
-
-      force_(cell, top_node, 0) = f_plus(0);
-      force_(cell, top_node, 1) = f_plus(1);
-      force_(cell, top_node, 2) = f_plus(2);
+      }
+    }  // end of pt loop
+
+    for (int i(0); i < 3; ++i) {
+      force_(cell, bottom_node, i) = -f_plus[i];
+      force_(cell, top_node, i)    = f_plus[i];
+    }
+  }  // end of planeNode loop
+}
 
-    }  // end of planeNode loop
-  }    // end of cell loop
+//**********************************************************************
+template <typename EvalT, typename Traits>
+void
+SurfaceCohesiveResidual<EvalT, Traits>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(
+      SurfaceCohesiveResidual_Policy(0, workset.numCells), *this);
 }
 //**********************************************************************
 }  // namespace LCM
@@ -41,10 +41,32 @@ class SurfaceScalarJump : public PHX::EvaluatorWithBaseImpl<Traits>,
   void
   evaluateFields(typename Traits::EvalData d);
 
+  struct SurfaceScalarJump_Tag
+  {
+  };
+
+  using ExecutionSpace = Kokkos::View<int***, PHX::Device>::execution_space;
+
+  using SurfaceScalarJump_Policy = Kokkos::RangePolicy<ExecutionSpace, SurfaceScalarJump_Tag>;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(SurfaceScalarJump_Tag const& tag, int const& cell) const;
+
  private:
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
 
+  // Interpolate a nodal scalar on the bottom and top surfaces of a cell, and
+  // store the jump and the average of the two at the integration points
+  KOKKOS_INLINE_FUNCTION
+  void
+  computeJumpAndAverage(
+      int const                                        cell,
+      PHX::MDField<const ScalarT, Cell, Vertex> const& nodal,
+      PHX::MDField<ScalarT, Cell, QuadPoint> const&    jump,
+      PHX::MDField<ScalarT, Cell, QuadPoint> const&    midPlane) const;
+
   // Input:
   //! Numerical integration rule
   Teuchos::RCP<Intrepid2::Cubature<PHX::Device>> cubature;
@@ -160,89 +160,58 @@ SurfaceScalarJump<EvalT, Traits>::postRegistrationSetup(
 
 //**********************************************************************
 template <typename EvalT, typename Traits>
-void
-SurfaceScalarJump<EvalT, Traits>::evaluateFields(
-    typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::computeJumpAndAverage(
+    int const                                        cell,
+    PHX::MDField<const ScalarT, Cell, Vertex> const& nodal,
+    PHX::MDField<ScalarT, Cell, QuadPoint> const&    jump,
+    PHX::MDField<ScalarT, Cell, QuadPoint> const&    midPlane) const
 {
-  ScalarT scalarA(0.0), scalarB(0.0);
-  /*
-  for (int cell=0; cell < workset.numCells; ++cell) {
-    for (int pt=0; pt < numQPs; ++pt) {
-      scalarA = 0.0;
-      scalarB = 0.0;
-      for (int node=0; node < numPlaneNodes; ++node) {
-        int topNode = node + numPlaneNodes;
-                scalarA += refValues(node, pt) * scalar(cell, node);
-                scalarB += refValues(node, pt) * scalar(cell, topNode);
-      }
-      scalarJump(cell,pt) = scalarB - scalarA;
-      scalarAverage(cell,pt) = 0.5*(scalarB + scalarA);
+  for (int pt = 0; pt < numQPs; ++pt) {
+    ScalarT scalarA(0.0), scalarB(0.0);
+    for (int node = 0; node < numPlaneNodes; ++node) {
+      int topNode = node + numPlaneNodes;
+      scalarA += refValues(node, pt) * nodal(cell, node);
+      scalarB += refValues(node, pt) * nodal(cell, topNode);
     }
+    jump(cell, pt)     = scalarB - scalarA;
+    midPlane(cell, pt) = 0.5 * (scalarB + scalarA);
   }
-  */
+}
+
+//**********************************************************************
+template <typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+SurfaceScalarJump<EvalT, Traits>::operator()(
+    SurfaceScalarJump_Tag const& tag,
+    int const&                   cell) const
+{
   if (havePorePressure) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalPorePressure(cell, node);
-          scalarB += refValues(node, pt) * nodalPorePressure(cell, topNode);
-        }
-        jumpPorePressure(cell, pt)     = scalarB - scalarA;
-        midPlanePorePressure(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
+    computeJumpAndAverage(
+        cell, nodalPorePressure, jumpPorePressure, midPlanePorePressure);
   }
   if (haveTemperature) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalTemperature(cell, node);
-          scalarB += refValues(node, pt) * nodalTemperature(cell, topNode);
-        }
-        jumpTemperature(cell, pt)     = scalarB - scalarA;
-        midPlaneTemperature(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
+    computeJumpAndAverage(
+        cell, nodalTemperature, jumpTemperature, midPlaneTemperature);
   }
-
   if (haveTransport) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalTransport(cell, node);
-          scalarB += refValues(node, pt) * nodalTransport(cell, topNode);
-        }
-        jumpTransport(cell, pt)     = scalarB - scalarA;
-        midPlaneTransport(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
+    computeJumpAndAverage(
+        cell, nodalTransport, jumpTransport, midPlaneTransport);
   }
-
   if (haveHydroStress) {
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < numQPs; ++pt) {
-        scalarA = 0.0;
-        scalarB = 0.0;
-        for (int node = 0; node < numPlaneNodes; ++node) {
-          int topNode = node + numPlaneNodes;
-          scalarA += refValues(node, pt) * nodalHydroStress(cell, node);
-          scalarB += refValues(node, pt) * nodalHydroStress(cell, topNode);
-        }
-        jumpHydroStress(cell, pt)     = scalarB - scalarA;
-        midPlaneHydroStress(cell, pt) = 0.5 * (scalarB + scalarA);
-      }
-    }
+    computeJumpAndAverage(
+        cell, nodalHydroStress, jumpHydroStress, midPlaneHydroStress);
   }
 }
 
+//**********************************************************************
+template <typename EvalT, typename Traits>
+void
+SurfaceScalarJump<EvalT, Traits>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+  Kokkos::parallel_for(SurfaceScalarJump_Policy(0, workset.numCells), *this);
+}
+
 //**********************************************************************
 }  // namespace LCM
@@ -40,6 +40,19 @@ class SurfaceVectorResidual : public PHX::EvaluatorWithBaseImpl<Traits>,
   void
   evaluateFields(typename Traits::EvalData d);
 
+  struct SurfaceVectorResidual_Tag
+  {
+  };
+
+  using ExecutionSpace = Kokkos::View<int***, PHX::Device>::execution_space;
+
+  using SurfaceVectorResidual_Policy =
+      Kokkos::RangePolicy<ExecutionSpace, SurfaceVectorResidual_Tag>;
+
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(SurfaceVectorResidual_Tag const& tag, int const& cell) const;
+
  private:
   using ScalarT     = typename EvalT::ScalarT;
   using MeshScalarT = typename EvalT::MeshScalarT;
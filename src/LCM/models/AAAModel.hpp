@@ -48,18 +48,21 @@ class AAAModel : public LCM::ConstitutiveModel<EvalT, Traits>
   /// Virtual Destructor
   virtual ~AAAModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   /// Method to compute the state
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -76,6 +79,13 @@ class AAAModel : public LCM::ConstitutiveModel<EvalT, Traits>
   RealType alpha_;
   RealType beta_;
   RealType mult_;
+
+  /// Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+
+  /// Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
 };
 
 }  // namespace LCM
@@ -40,18 +40,26 @@ AAAModel<EvalT, Traits>::AAAModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-AAAModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+AAAModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto defGrad = *dep_fields["F"];
-  auto J       = *dep_fields["J"];
+  def_grad_ = *dep_fields["F"];
+  J_        = *dep_fields["J"];
   // extract evaluated MDFields
   std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto        stress = *eval_fields[cauchy];
+  stress_            = *eval_fields[cauchy];
+}
 
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+AAAModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   minitensor::Tensor<ScalarT> F(num_dims_);
   minitensor::Tensor<ScalarT> S(num_dims_);
   minitensor::Tensor<ScalarT> B(
@@ -66,17 +74,19 @@ AAAModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      F.fill(defGrad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       B = F * minitensor::transpose(F);
 
-      ScalarT pressure = kappa * (J(cell, pt) - 1.0);
+      ScalarT pressure = kappa * (J_(cell, pt) - 1.0);
 
       // Cauchy stress
       S = -pressure * Id +
           2.0 * (alpha_ + 2.0 * beta_ * (minitensor::I1(B) - 3.0)) * B;
 
       for (int i(0); i < num_dims_; ++i) {
-        for (int j(0); j < num_dims_; ++j) { stress(cell, pt, i, j) = S(i, j); }
+        for (int j(0); j < num_dims_; ++j) {
+          stress_(cell, pt, i, j) = S(i, j);
+        }
       }
     }
   }
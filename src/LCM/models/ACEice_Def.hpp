@@ -250,8 +250,7 @@ ACEiceMiniKernel<EvalT, Traits>::ACEiceMiniKernel(
 
 template <typename EvalT, typename Traits>
 void
-ACEiceMiniKernel<EvalT, Traits>::init(
-    Workset&                 workset,
+ACEiceMiniKernel<EvalT, Traits>::bindFields(
     FieldMap<const ScalarT>& input_fields,
     FieldMap<ScalarT>&       output_fields)
 {
@@ -286,9 +285,21 @@ ACEiceMiniKernel<EvalT, Traits>::init(
   failed_           = *output_fields["Failure Indicator"];
   exposure_time_    = *output_fields["ACE Exposure Time"];
 
+  // names of the old state variables
+  Fp_old_string_   = Fp_string + "_old";
+  eqps_old_string_ = eqps_string + "_old";
+}
+
+template <typename EvalT, typename Traits>
+void
+ACEiceMiniKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<const ScalarT>& input_fields,
+    FieldMap<ScalarT>&       output_fields)
+{
   // get State Variables
-  Fp_old_             = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_           = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Fp_old_             = (*workset.stateArrayPtr)[Fp_old_string_];
+  eqps_old_           = (*workset.stateArrayPtr)[eqps_old_string_];
   T_old_              = (*workset.stateArrayPtr)["ACE Temperature_old"];
   ice_saturation_old_ = (*workset.stateArrayPtr)["ACE Ice Saturation_old"];
 
@@ -87,6 +87,9 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
   // Workspace arrays
   Albany::MDArray Fp_old_;
   Albany::MDArray eqps_old_;
+
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
   Albany::MDArray T_old_;
   Albany::MDArray ice_saturation_old_;
 
@@ -135,6 +138,11 @@ struct ACEpermafrostMiniKernel : public ParallelKernel<EvalT, Traits>
 
   std::string block_name_{""};
 
+  void
+  bindFields(
+      FieldMap<ScalarT const>& input_fields,
+      FieldMap<ScalarT>&       output_fields);
+
   void
   init(
       Workset&                 workset,
@@ -139,20 +139,15 @@ AnisotropicDamageModel<EvalT, Traits>::AnisotropicDamageModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-AnisotropicDamageModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+AnisotropicDamageModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
-  // bool print = false;
-  // if (typeid(ScalarT) == typeid(RealType)) print = true;
-  // cout.precision(15);
-
   // extract dependent MDFields
-  auto def_grad        = *dep_fields["F"];
-  auto J               = *dep_fields["J"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  def_grad_        = *dep_fields["F"];
+  J_               = *dep_fields["J"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string        = (*field_name_map_)["Cauchy_Stress"];
@@ -165,24 +160,40 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
   std::string tangent_string       = (*field_name_map_)["Material Tangent"];
 
   // extract evaluated MDFields
-  auto                  stress    = *eval_fields[cauchy_string];
-  auto                  energy_m  = *eval_fields[matrix_energy_string];
-  auto                  energy_f1 = *eval_fields[f1_energy_string];
-  auto                  energy_f2 = *eval_fields[f2_energy_string];
-  auto                  damage_m  = *eval_fields[matrix_damage_string];
-  auto                  damage_f1 = *eval_fields[f1_damage_string];
-  auto                  damage_f2 = *eval_fields[f2_damage_string];
-  PHX::MDField<ScalarT> tangent;
-
-  if (compute_tangent_) { tangent = *eval_fields[tangent_string]; }
+  stress_    = *eval_fields[cauchy_string];
+  energy_m_  = *eval_fields[matrix_energy_string];
+  energy_f1_ = *eval_fields[f1_energy_string];
+  energy_f2_ = *eval_fields[f2_energy_string];
+  damage_m_  = *eval_fields[matrix_damage_string];
+  damage_f1_ = *eval_fields[f1_damage_string];
+  damage_f2_ = *eval_fields[f2_damage_string];
+
+  if (compute_tangent_) { tangent_ = *eval_fields[tangent_string]; }
+
+  // names of the old state variables
+  energy_m_old_string_  = matrix_energy_string + "_old";
+  energy_f1_old_string_ = f1_energy_string + "_old";
+  energy_f2_old_string_ = f2_energy_string + "_old";
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+AnisotropicDamageModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  // bool print = false;
+  // if (typeid(ScalarT) == typeid(RealType)) print = true;
+  // cout.precision(15);
 
   // previous state
   Albany::MDArray energy_m_old =
-      (*workset.stateArrayPtr)[matrix_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_m_old_string_];
   Albany::MDArray energy_f1_old =
-      (*workset.stateArrayPtr)[f1_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f1_old_string_];
   Albany::MDArray energy_f2_old =
-      (*workset.stateArrayPtr)[f2_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f2_old_string_];
 
   ScalarT mu, lame, mu_tilde, I1_m, I3_m, lnI3_m;
   ScalarT I4_f1, I4_f2;
@@ -217,12 +228,13 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       // << std::endl;
 
       // local parameters
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      lame = elastic_modulus(cell, pt) * poissons_ratio(cell, pt) /
-             (1.0 + poissons_ratio(cell, pt)) /
-             (1.0 - 2.0 * poissons_ratio(cell, pt));
+      mu = elastic_modulus_(cell, pt) /
+           (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+      lame = elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt) /
+             (1.0 + poissons_ratio_(cell, pt)) /
+             (1.0 - 2.0 * poissons_ratio_(cell, pt));
 
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       // Right Cauchy-Green Tensor C = F^{T} * F
 
       C      = minitensor::transpose(F) * F;
@@ -232,7 +244,7 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       lnI3_m = std::log(I3_m);
 
       // energy for M
-      energy_m(cell, pt) =
+      energy_m_(cell, pt) =
           volume_fraction_m_ * (0.125 * lame * lnI3_m * lnI3_m -
                                 0.5 * mu * lnI3_m + 0.5 * mu * (I1_m - 3.0));
 
@@ -242,7 +254,7 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
       // undamaged Cauchy stress for M
       sigma_m =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_m, minitensor::transpose(F)));
 
       // elasticity tensor (undamaged) for M
@@ -259,9 +271,9 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
       // damage term in M
       alpha_m = energy_m_old(cell, pt);
-      if (energy_m(cell, pt) > alpha_m) alpha_m = energy_m(cell, pt);
+      if (energy_m_(cell, pt) > alpha_m) alpha_m = energy_m_(cell, pt);
 
-      damage_m(cell, pt) =
+      damage_m_(cell, pt) =
           max_damage_m_ * (1 - std::exp(-alpha_m / saturation_m_));
 
       // derivative of damage w.r.t alpha
@@ -270,7 +282,7 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
       // optional material tangent computation
       if (compute_tangent_) {
-        tangent_m = (1.0 - damage_m(cell, pt)) * tangent_m -
+        tangent_m = (1.0 - damage_m_(cell, pt)) * tangent_m -
                     damage_deriv_m * minitensor::tensor(S0_m, S0_m);
 
         // convert tangent_m to tangentA
@@ -290,7 +302,7 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
                 tangentA_m(i, j, p, q) =
                     tangentA_m(i, j, p, q) +
-                    (1.0 - damage_m(cell, pt)) * S0_m(q, j) * I(i, p);
+                    (1.0 - damage_m_(cell, pt)) * S0_m(q, j) * I(i, p);
               }
             }
           }
@@ -317,10 +329,10 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       M2dyadM2 = minitensor::dyad(M2, M2);
 
       // compute energy for fibers
-      energy_f1(cell, pt) =
+      energy_f1_(cell, pt) =
           volume_fraction_f1_ *
           (k_f1_ * (std::exp(q_f1_ * (I4_f1 - 1) * (I4_f1 - 1)) - 1) / q_f1_);
-      energy_f2(cell, pt) =
+      energy_f2_(cell, pt) =
           volume_fraction_f2_ *
           (k_f2_ * (std::exp(q_f2_ * (I4_f2 - 1) * (I4_f2 - 1)) - 1) / q_f2_);
 
@@ -336,10 +348,10 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
       // Fiber undamaged Cauchy stress
       sigma_f1 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f1, minitensor::transpose(F)));
       sigma_f2 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f2, minitensor::transpose(F)));
 
       // undamaged tangent for fibers
@@ -361,14 +373,14 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       alpha_f1 = energy_f1_old(cell, pt);
       alpha_f2 = energy_f2_old(cell, pt);
 
-      if (energy_f1(cell, pt) > alpha_f1) alpha_f1 = energy_f1(cell, pt);
+      if (energy_f1_(cell, pt) > alpha_f1) alpha_f1 = energy_f1_(cell, pt);
 
-      if (energy_f2(cell, pt) > alpha_f2) alpha_f2 = energy_f2(cell, pt);
+      if (energy_f2_(cell, pt) > alpha_f2) alpha_f2 = energy_f2_(cell, pt);
 
       // damage term in fibers
-      damage_f1(cell, pt) =
+      damage_f1_(cell, pt) =
           max_damage_f1_ * (1 - std::exp(-alpha_f1 / saturation_f1_));
-      damage_f2(cell, pt) =
+      damage_f2_(cell, pt) =
           max_damage_f2_ * (1 - std::exp(-alpha_f2 / saturation_f2_));
 
       // derivative of damage w.r.t alpha
@@ -381,9 +393,9 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       // tangent for fibers including damage
       // optional material tangent computation
       if (compute_tangent_) {
-        tangent_f1 = (1.0 - damage_f1(cell, pt)) * tangent_f1 -
+        tangent_f1 = (1.0 - damage_f1_(cell, pt)) * tangent_f1 -
                      damage_deriv_f1 * minitensor::tensor(S0_f1, S0_f1);
-        tangent_f2 = (1.0 - damage_f2(cell, pt)) * tangent_f2 -
+        tangent_f2 = (1.0 - damage_f2_(cell, pt)) * tangent_f2 -
                      damage_deriv_f2 * minitensor::tensor(S0_f2, S0_f2);
 
         // convert tangent_m to tangentA
@@ -408,11 +420,11 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
 
                 tangentA_f1(i, j, p, q) =
                     tangentA_f1(i, j, p, q) +
-                    (1.0 - damage_f1(cell, pt)) * S0_f1(q, j) * I(i, p);
+                    (1.0 - damage_f1_(cell, pt)) * S0_f1(q, j) * I(i, p);
 
                 tangentA_f2(i, j, p, q) =
                     tangentA_f2(i, j, p, q) +
-                    (1.0 - damage_f2(cell, pt)) * S0_f2(q, j) * I(i, p);
+                    (1.0 - damage_f2_(cell, pt)) * S0_f2(q, j) * I(i, p);
               }
             }
           }
@@ -423,9 +435,10 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
       // total Cauchy stress (M, Fibers)
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = (1.0 - damage_m(cell, pt)) * sigma_m(i, j) +
-                                   (1. - damage_f1(cell, pt)) * sigma_f1(i, j) +
-                                   (1. - damage_f2(cell, pt)) * sigma_f2(i, j);
+          stress_(cell, pt, i, j) =
+              (1.0 - damage_m_(cell, pt)) * sigma_m(i, j) +
+              (1. - damage_f1_(cell, pt)) * sigma_f1(i, j) +
+              (1. - damage_f2_(cell, pt)) * sigma_f2(i, j);
         }
       }
 
@@ -437,7 +450,7 @@ AnisotropicDamageModel<EvalT, Traits>::computeState(
               for (int l(0); l < num_dims_; ++l) {
                 // std::cout << "Tangent w.r.t. the deformation gradient"
                 // << std::endl;
-                tangent(cell, pt, i, j, k, l) = tangentA_m(i, j, k, l) +
+                tangent_(cell, pt, i, j, k, l) = tangentA_m(i, j, k, l) +
                                                 tangentA_f1(i, j, k, l) +
                                                 tangentA_f2(i, j, k, l);
 
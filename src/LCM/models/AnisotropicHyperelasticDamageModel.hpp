@@ -44,20 +44,23 @@ class AnisotropicHyperelasticDamageModel
   /// Virtual Destructor
   virtual ~AnisotropicHyperelasticDamageModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -98,6 +101,26 @@ class AnisotropicHyperelasticDamageModel
   /// Fiber 2 orientation vector
   ///
   std::vector<RealType> direction_f2_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> energy_m_;
+  PHX::MDField<ScalarT> energy_f1_;
+  PHX::MDField<ScalarT> energy_f2_;
+  PHX::MDField<ScalarT> damage_m_;
+  PHX::MDField<ScalarT> damage_f1_;
+  PHX::MDField<ScalarT> damage_f2_;
+
+  // Names of the old state variables
+  std::string energy_m_old_string_;
+  std::string energy_f1_old_string_;
+  std::string energy_f2_old_string_;
 };
 }  // namespace LCM
 
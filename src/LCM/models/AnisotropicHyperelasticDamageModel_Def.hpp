@@ -142,15 +142,10 @@ AnisotropicHyperelasticDamageModel<EvalT, Traits>::
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-AnisotropicHyperelasticDamageModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+AnisotropicHyperelasticDamageModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
-  bool print = false;
-  // if (typeid(ScalarT) == typeid(RealType)) print = true;
-  // cout.precision(15);
-
   // retrive appropriate field name strings
   std::string F_string             = (*field_name_map_)["F"];
   std::string J_string             = (*field_name_map_)["J"];
@@ -163,27 +158,44 @@ AnisotropicHyperelasticDamageModel<EvalT, Traits>::computeState(
   std::string f2_damage_string     = (*field_name_map_)["F2_Damage"];
 
   // extract dependent MDFields
-  auto def_grad        = *dep_fields[F_string];
-  auto J               = *dep_fields[J_string];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  def_grad_        = *dep_fields[F_string];
+  J_               = *dep_fields[J_string];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // extract evaluated MDFields
-  auto stress    = *eval_fields[cauchy_string];
-  auto energy_m  = *eval_fields[matrix_energy_string];
-  auto energy_f1 = *eval_fields[f1_energy_string];
-  auto energy_f2 = *eval_fields[f2_energy_string];
-  auto damage_m  = *eval_fields[matrix_damage_string];
-  auto damage_f1 = *eval_fields[f1_damage_string];
-  auto damage_f2 = *eval_fields[f2_damage_string];
+  stress_    = *eval_fields[cauchy_string];
+  energy_m_  = *eval_fields[matrix_energy_string];
+  energy_f1_ = *eval_fields[f1_energy_string];
+  energy_f2_ = *eval_fields[f2_energy_string];
+  damage_m_  = *eval_fields[matrix_damage_string];
+  damage_f1_ = *eval_fields[f1_damage_string];
+  damage_f2_ = *eval_fields[f2_damage_string];
+
+  // names of the old state variables
+  energy_m_old_string_  = matrix_energy_string + "_old";
+  energy_f1_old_string_ = f1_energy_string + "_old";
+  energy_f2_old_string_ = f2_energy_string + "_old";
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+AnisotropicHyperelasticDamageModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  bool print = false;
+  // if (typeid(ScalarT) == typeid(RealType)) print = true;
+  // cout.precision(15);
 
   // previous state
   Albany::MDArray energy_m_old =
-      (*workset.stateArrayPtr)[matrix_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_m_old_string_];
   Albany::MDArray energy_f1_old =
-      (*workset.stateArrayPtr)[f1_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f1_old_string_];
   Albany::MDArray energy_f2_old =
-      (*workset.stateArrayPtr)[f2_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f2_old_string_];
 
   ScalarT kappa, mu, Jm53, Jm23, p, I4_f1, I4_f2;
   ScalarT alpha_f1, alpha_f2, alpha_m;
@@ -202,32 +214,33 @@ AnisotropicHyperelasticDamageModel<EvalT, Traits>::computeState(
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int pt = 0; pt < num_pts_; ++pt) {
       // local parameters
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      Jm53 = std::pow(J(cell, pt), -5. / 3.);
-      Jm23 = std::pow(J(cell, pt), -2. / 3.);
-      F.fill(def_grad, cell, pt, 0, 0);
+      kappa = elastic_modulus_(cell, pt) /
+              (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+      mu   = elastic_modulus_(cell, pt) /
+             (2. * (1. + poissons_ratio_(cell, pt)));
+      Jm53 = std::pow(J_(cell, pt), -5. / 3.);
+      Jm23 = std::pow(J_(cell, pt), -2. / 3.);
+      F.fill(def_grad_, cell, pt, 0, 0);
 
       // compute deviatoric stress
       b = F * minitensor::transpose(F);
       s = mu * Jm53 * minitensor::dev(b);
       // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
+      p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
 
       sigma_m = s + p * I;
 
       // compute energy for M
-      energy_m(cell, pt) = 0.5 * kappa *
-                               (0.5 * (J(cell, pt) * J(cell, pt) - 1.0) -
-                                std::log(J(cell, pt))) +
+      energy_m_(cell, pt) = 0.5 * kappa *
+                               (0.5 * (J_(cell, pt) * J_(cell, pt) - 1.0) -
+                                std::log(J_(cell, pt))) +
                            0.5 * mu * (Jm23 * minitensor::trace(b) - 3.0);
 
       // damage term in M
       alpha_m = energy_m_old(cell, pt);
-      if (energy_m(cell, pt) > alpha_m) alpha_m = energy_m(cell, pt);
+      if (energy_m_(cell, pt) > alpha_m) alpha_m = energy_m_(cell, pt);
 
-      damage_m(cell, pt) =
+      damage_m_(cell, pt) =
           max_damage_m_ * (1 - std::exp(-alpha_m / saturation_m_));
 
       //-----------compute stress in Fibers
@@ -260,50 +273,51 @@ AnisotropicHyperelasticDamageModel<EvalT, Traits>::computeState(
               M2dyadM2;
 
       // compute energy for fibers
-      energy_f1(cell, pt) =
+      energy_f1_(cell, pt) =
           k_f1_ * (std::exp(q_f1_ * (I4_f1 - 1) * (I4_f1 - 1)) - 1) / q_f1_;
-      energy_f2(cell, pt) =
+      energy_f2_(cell, pt) =
           k_f2_ * (std::exp(q_f2_ * (I4_f2 - 1) * (I4_f2 - 1)) - 1) / q_f2_;
 
       // Fiber Cauchy stress
       sigma_f1 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f1, minitensor::transpose(F)));
       sigma_f2 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f2, minitensor::transpose(F)));
 
       // maximum thermodynamic forces
       alpha_f1 = energy_f1_old(cell, pt);
       alpha_f2 = energy_f2_old(cell, pt);
 
-      if (energy_f1(cell, pt) > alpha_f1) alpha_f1 = energy_f1(cell, pt);
+      if (energy_f1_(cell, pt) > alpha_f1) alpha_f1 = energy_f1_(cell, pt);
 
-      if (energy_f2(cell, pt) > alpha_f2) alpha_f2 = energy_f2(cell, pt);
+      if (energy_f2_(cell, pt) > alpha_f2) alpha_f2 = energy_f2_(cell, pt);
 
       // damage term in fibers
-      damage_f1(cell, pt) =
+      damage_f1_(cell, pt) =
           max_damage_f1_ * (1 - std::exp(-alpha_f1 / saturation_f1_));
-      damage_f2(cell, pt) =
+      damage_f2_(cell, pt) =
           max_damage_f2_ * (1 - std::exp(-alpha_f2 / saturation_f2_));
 
       // total Cauchy stress (M, Fibers)
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) =
-              volume_fraction_m_ * (1 - damage_m(cell, pt)) * sigma_m(i, j) +
-              volume_fraction_f1_ * (1 - damage_f1(cell, pt)) * sigma_f1(i, j) +
-              volume_fraction_f2_ * (1 - damage_f2(cell, pt)) * sigma_f2(i, j);
+          stress_(cell, pt, i, j) =
+              volume_fraction_m_ * (1 - damage_m_(cell, pt)) * sigma_m(i, j) +
+              volume_fraction_f1_ * (1 - damage_f1_(cell, pt)) *
+                  sigma_f1(i, j) +
+              volume_fraction_f2_ * (1 - damage_f2_(cell, pt)) * sigma_f2(i, j);
         }
       }
 
       if (print) {
-        std::cout << "  matrix damage: " << damage_m(cell, pt) << std::endl;
-        std::cout << "  matrix energy: " << energy_m(cell, pt) << std::endl;
-        std::cout << "  fiber1 damage: " << damage_f1(cell, pt) << std::endl;
-        std::cout << "  fiber1 energy: " << energy_f1(cell, pt) << std::endl;
-        std::cout << "  fiber2 damage: " << damage_f2(cell, pt) << std::endl;
-        std::cout << "  fiber2 energy: " << energy_f2(cell, pt) << std::endl;
+        std::cout << "  matrix damage: " << damage_m_(cell, pt) << std::endl;
+        std::cout << "  matrix energy: " << energy_m_(cell, pt) << std::endl;
+        std::cout << "  fiber1 damage: " << damage_f1_(cell, pt) << std::endl;
+        std::cout << "  fiber1 energy: " << energy_f1_(cell, pt) << std::endl;
+        std::cout << "  fiber2 damage: " << damage_f2_(cell, pt) << std::endl;
+        std::cout << "  fiber2 energy: " << energy_f2_(cell, pt) << std::endl;
       }
     }  // pt
   }    // cell
@@ -53,20 +53,23 @@ class AnisotropicViscoplasticModel
   ///
   virtual ~AnisotropicViscoplasticModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -82,6 +85,30 @@ class AnisotropicViscoplasticModel
   ///
   AnisotropicViscoplasticModel&
   operator=(const AnisotropicViscoplasticModel&);
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+  PHX::MDField<const ScalarT> yield_strength_;
+  PHX::MDField<const ScalarT> hardening_modulus_;
+  PHX::MDField<const ScalarT> recovery_modulus_;
+  PHX::MDField<const ScalarT> flow_exp_;
+  PHX::MDField<const ScalarT> flow_coeff_;
+  PHX::MDField<const ScalarT> delta_time_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> Fp_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> ess_;
+  PHX::MDField<ScalarT> iso_hardening_;
+  PHX::MDField<ScalarT> source_;
+
+  // Names of the old state variables
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
 };
 }  // namespace LCM
 
@@ -48,20 +48,23 @@ class CapExplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~CapExplicitModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Implementation of physics
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -147,6 +150,27 @@ class CapExplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   minitensor::Tensor<ScalarT>  dfdotCe, sigmaK, alphaK, dsigma, dev_plastic;
   minitensor::Tensor<ScalarT>  xi, sN, s, strainCurrent;
   minitensor::Tensor<ScalarT>  dJ3dsigma, eps_dev;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> back_stress_;
+  PHX::MDField<ScalarT> cap_parameter_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> vol_plastic_strain_;
+  PHX::MDField<ScalarT> tangent_;
+
+  // Names of the old state variables
+  std::string strain_old_string_;
+  std::string stress_old_string_;
+  std::string back_stress_old_string_;
+  std::string cap_parameter_old_string_;
+  std::string eqps_old_string_;
+  std::string vol_plastic_strain_old_string_;
 };
 }  // namespace LCM
 
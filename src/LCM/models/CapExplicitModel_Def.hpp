@@ -149,15 +149,14 @@ CapExplicitModel<EvalT, Traits>::CapExplicitModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-CapExplicitModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+CapExplicitModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string           = (*field_name_map_)["Cauchy_Stress"];
@@ -168,32 +167,48 @@ CapExplicitModel<EvalT, Traits>::computeState(
   std::string volPlasticStrain_string = (*field_name_map_)["volPlastic_Strain"];
 
   // extract evaluated MDFields
-  auto stress           = *eval_fields[cauchy_string];
-  auto backStress       = *eval_fields[backStress_string];
-  auto capParameter     = *eval_fields[capParameter_string];
-  auto eqps             = *eval_fields[eqps_string];
-  auto volPlasticStrain = *eval_fields[volPlasticStrain_string];
-  auto tangent          = *eval_fields["Material Tangent"];
-
+  stress_             = *eval_fields[cauchy_string];
+  back_stress_        = *eval_fields[backStress_string];
+  cap_parameter_      = *eval_fields[capParameter_string];
+  eqps_               = *eval_fields[eqps_string];
+  vol_plastic_strain_ = *eval_fields[volPlasticStrain_string];
+  tangent_            = *eval_fields["Material Tangent"];
+
+  // names of the old state variables
+  strain_old_string_             = strain_string + "_old";
+  stress_old_string_             = cauchy_string + "_old";
+  back_stress_old_string_        = backStress_string + "_old";
+  cap_parameter_old_string_      = capParameter_string + "_old";
+  eqps_old_string_               = eqps_string + "_old";
+  vol_plastic_strain_old_string_ = volPlasticStrain_string + "_old";
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+CapExplicitModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray strainold = (*workset.stateArrayPtr)[strain_string + "_old"];
-  Albany::MDArray stressold = (*workset.stateArrayPtr)[cauchy_string + "_old"];
+  Albany::MDArray strainold = (*workset.stateArrayPtr)[strain_old_string_];
+  Albany::MDArray stressold = (*workset.stateArrayPtr)[stress_old_string_];
   Albany::MDArray backStressold =
-      (*workset.stateArrayPtr)[backStress_string + "_old"];
+      (*workset.stateArrayPtr)[back_stress_old_string_];
   Albany::MDArray capParameterold =
-      (*workset.stateArrayPtr)[capParameter_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+      (*workset.stateArrayPtr)[cap_parameter_old_string_];
+  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_old_string_];
   Albany::MDArray volPlasticStrainold =
-      (*workset.stateArrayPtr)[volPlasticStrain_string + "_old"];
+      (*workset.stateArrayPtr)[vol_plastic_strain_old_string_];
 
   ScalarT lame, mu, bulkModulus;
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int qp = 0; qp < num_pts_; ++qp) {
       // local parameters
-      lame = elastic_modulus(cell, qp) * poissons_ratio(cell, qp) /
-             (1.0 + poissons_ratio(cell, qp)) /
-             (1.0 - 2.0 * poissons_ratio(cell, qp));
-      mu = elastic_modulus(cell, qp) / 2.0 / (1.0 + poissons_ratio(cell, qp));
+      lame = elastic_modulus_(cell, qp) * poissons_ratio_(cell, qp) /
+             (1.0 + poissons_ratio_(cell, qp)) /
+             (1.0 - 2.0 * poissons_ratio_(cell, qp));
+      mu = elastic_modulus_(cell, qp) / 2.0 / (1.0 + poissons_ratio_(cell, qp));
       bulkModulus = lame + (2. / 3.) * mu;
 
       // elastic matrix
@@ -207,7 +222,7 @@ CapExplicitModel<EvalT, Traits>::computeState(
       minitensor::Tensor<ScalarT> depsilon(3);
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          depsilon(i, j) = strain(cell, qp, i, j) - strainold(cell, qp, i, j);
+          depsilon(i, j) = strain_(cell, qp, i, j) - strainold(cell, qp, i, j);
           strainN(i, j)  = strainold(cell, qp, i, j);
           sigmaN(i, j)   = stressold(cell, qp, i, j);
           alphaVal(i, j) = backStressold(cell, qp, i, j);
@@ -454,14 +469,14 @@ CapExplicitModel<EvalT, Traits>::computeState(
       // update
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, qp, i, j)     = sigmaVal(i, j);
-          backStress(cell, qp, i, j) = alphaVal(i, j);
+          stress_(cell, qp, i, j)      = sigmaVal(i, j);
+          back_stress_(cell, qp, i, j) = alphaVal(i, j);
         }
       }
 
-      capParameter(cell, qp)     = kappaVal;
-      eqps(cell, qp)             = eqpsold(cell, qp) + deqps;
-      volPlasticStrain(cell, qp) = volPlasticStrainold(cell, qp) + devolps;
+      cap_parameter_(cell, qp)      = kappaVal;
+      eqps_(cell, qp)               = eqpsold(cell, qp) + deqps;
+      vol_plastic_strain_(cell, qp) = volPlasticStrainold(cell, qp) + devolps;
 
     }  // loop over qps
 
@@ -54,20 +54,23 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~CapImplicitModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Implementation of physics
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -187,6 +190,27 @@ class CapImplicitModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
   std::string strainName, stressName;
   std::string backStressName, capParameterName, eqpsName, volPlasticStrainName;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> back_stress_;
+  PHX::MDField<ScalarT> cap_parameter_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> vol_plastic_strain_;
+  PHX::MDField<ScalarT> tangent_;
+
+  // Names of the old state variables
+  std::string strain_old_string_;
+  std::string stress_old_string_;
+  std::string back_stress_old_string_;
+  std::string cap_parameter_old_string_;
+  std::string eqps_old_string_;
+  std::string vol_plastic_strain_old_string_;
 };
 }  // namespace LCM
 
@@ -65,14 +65,28 @@ class ConstitutiveModel
   virtual void
   computeState(
       Workset     workset,
-      DepFieldMap dep_fields,
-      FieldMap    eval_fields) = 0;
+      DepFieldMap& dep_fields,
+      FieldMap&    eval_fields) = 0;
 
   virtual void
   computeStateParallel(
       Workset     workset,
-      DepFieldMap dep_fields,
-      FieldMap    eval_fields) = 0;
+      DepFieldMap& dep_fields,
+      FieldMap&    eval_fields) = 0;
+
+  ///
+  /// Optional method to bind the dependent and evaluated fields to members.
+  /// ConstitutiveModelInterface calls it once, from postRegistrationSetup,
+  /// after the field data has been set. Models that override it keep the
+  /// bound fields and use them in computeState, which then ignores its
+  /// field map arguments instead of looking the fields up by name on every
+  /// workset.
+  ///
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields)
+  {
+    return;
+  }
 
   ///
   /// Optional Method to volume average the pressure
@@ -80,8 +94,8 @@ class ConstitutiveModel
   void
   computeVolumeAverage(
       Workset     workset,
-      DepFieldMap dep_fields,
-      FieldMap    eval_fields);
+      DepFieldMap& dep_fields,
+      FieldMap&    eval_fields);
 
   ///
   /// Accessors and mutators
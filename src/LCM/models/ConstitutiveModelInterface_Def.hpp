@@ -231,6 +231,8 @@ ConstitutiveModelInterface<EvalT, Traits>::postRegistrationSetup(
   for (auto& pair : eval_fields_map_) {
     this->utils.setFieldData(*(pair.second), fm);
   }
+
+  model_->bindFields(dep_fields_map_, eval_fields_map_);
 }
 
 //------------------------------------------------------------------------------
@@ -133,8 +133,8 @@ template <typename EvalT, typename Traits>
 void
 ConstitutiveModel<EvalT, Traits>::computeVolumeAverage(
     Workset     workset,
-    DepFieldMap dep_fields,
-    FieldMap    eval_fields)
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   int const& num_dims = this->num_dims_;
 
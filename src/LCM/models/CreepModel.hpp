@@ -52,20 +52,23 @@ class CreepModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~CreepModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -89,6 +92,25 @@ class CreepModel : public LCM::ConstitutiveModel<EvalT, Traits>
       relaxation_para_, activation_para_, return_map_tolerance;
 
   int max_return_map_count;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+  PHX::MDField<const ScalarT> yield_strength_;
+  PHX::MDField<const ScalarT> hardening_modulus_;
+  PHX::MDField<const ScalarT> delta_time_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> Fp_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> source_;
+
+  // Names of the old state variables
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
 };
 }  // namespace LCM
 
@@ -123,12 +123,10 @@ CreepModel<EvalT, Traits>::CreepModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-CreepModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+CreepModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
-  static int  times_called  = 0;
   std::string cauchy_string = (*field_name_map_)["Cauchy_Stress"];
   std::string Fp_string     = (*field_name_map_)["Fp"];
   std::string eqps_string   = (*field_name_map_)["eqps"];
@@ -137,24 +135,38 @@ CreepModel<EvalT, Traits>::computeState(
   std::string J_string      = (*field_name_map_)["J"];
 
   // extract dependent MDFields
-  auto def_grad          = *dep_fields[F_string];
-  auto J                 = *dep_fields[J_string];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto delta_time        = *dep_fields["Delta Time"];
+  def_grad_          = *dep_fields[F_string];
+  J_                 = *dep_fields[J_string];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  delta_time_        = *dep_fields["Delta Time"];
 
   // extract evaluated MDFields
-  auto                  stress = *eval_fields[cauchy_string];
-  auto                  Fp     = *eval_fields[Fp_string];
-  auto                  eqps   = *eval_fields[eqps_string];
-  PHX::MDField<ScalarT> source;
-  if (have_temperature_) { source = *eval_fields[source_string]; }
+  stress_ = *eval_fields[cauchy_string];
+  Fp_     = *eval_fields[Fp_string];
+  eqps_   = *eval_fields[eqps_string];
+  if (have_temperature_) { source_ = *eval_fields[source_string]; }
+
+  // names of the old state variables
+  Fp_old_string_   = Fp_string + "_old";
+  eqps_old_string_ = eqps_string + "_old";
+}
+
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+CreepModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  static int times_called = 0;
 
   // get State Variables
-  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_old_string_];
+  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_old_string_];
 
   ScalarT kappa, mu, mubar, K, Y;
   // new parameters introduced here for being the temperature dependent, they
@@ -176,12 +188,13 @@ CreepModel<EvalT, Traits>::computeState(
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
       debug_output_counter++;
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      K    = hardening_modulus(cell, pt);
-      Y    = yield_strength(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2. / 3.);
+      kappa = elastic_modulus_(cell, pt) /
+              (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+      mu   = elastic_modulus_(cell, pt) /
+             (2. * (1. + poissons_ratio_(cell, pt)));
+      K    = hardening_modulus_(cell, pt);
+      Y    = yield_strength_(cell, pt);
+      Jm23 = std::pow(J_(cell, pt), -2. / 3.);
 
       // ----------------------------  temperature dependent coefficient
       // ------------------------
@@ -200,7 +213,7 @@ CreepModel<EvalT, Traits>::computeState(
         std::cout << "B = " << temp_adj_relaxation_para_ << std::endl;
 
       // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
 
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
@@ -250,7 +263,7 @@ CreepModel<EvalT, Traits>::computeState(
 
           X[0] = creep_initial_guess_;
 
-          F[0] = X[0] - delta_time(0) * temp_adj_relaxation_para_ *
+          F[0] = X[0] - delta_time_(0) * temp_adj_relaxation_para_ *
                             std::pow(mu, strain_rate_expo_) *
                             std::pow(
                                 (a0 - 2. / 3. * X[0] * a1) *
@@ -259,7 +272,7 @@ CreepModel<EvalT, Traits>::computeState(
 
           dFdX[0] =
               1. -
-              delta_time(0) * temp_adj_relaxation_para_ *
+              delta_time_(0) * temp_adj_relaxation_para_ *
                   std::pow(mu, strain_rate_expo_) * (strain_rate_expo_ / 2.) *
                   std::pow(
                       (a0 - 2. / 3. * X[0] * a1) * (a0 - 2. / 3. * X[0] * a1),
@@ -276,7 +289,7 @@ CreepModel<EvalT, Traits>::computeState(
             std::cerr << "strain_rate_expo_ is " << strain_rate_expo_ << 'n';
             std::cerr << "temp_adj_relaxation_para_ is "
                       << temp_adj_relaxation_para_ << 'n';
-            std::cerr << "dt is " << delta_time(0) << 'n';
+            std::cerr << "dt is " << delta_time_(0) << 'n';
           }
 
           debug_X[0]    = X[0];
@@ -289,7 +302,7 @@ CreepModel<EvalT, Traits>::computeState(
             count++;
             solver.solve(dFdX, X, F);
 
-            F[0] = X[0] - delta_time(0) * temp_adj_relaxation_para_ *
+            F[0] = X[0] - delta_time_(0) * temp_adj_relaxation_para_ *
                               std::pow(mu, strain_rate_expo_) *
                               std::pow(
                                   (a0 - 2. / 3. * X[0] * a1) *
@@ -298,7 +311,7 @@ CreepModel<EvalT, Traits>::computeState(
 
             dFdX[0] =
                 1. -
-                delta_time(0) * temp_adj_relaxation_para_ *
+                delta_time_(0) * temp_adj_relaxation_para_ *
                     std::pow(mu, strain_rate_expo_) * (strain_rate_expo_ / 2.) *
                     std::pow(
                         (a0 - 2. / 3. * X[0] * a1) * (a0 - 2. / 3. * X[0] * a1),
@@ -367,20 +380,20 @@ CreepModel<EvalT, Traits>::computeState(
            */
 
           // exponential map to get Fpnew
-          A              = dgam * N;
-          eqps(cell, pt) = eqpsold(cell, pt);
-          expA           = minitensor::exp(A);
-          Fpnew          = expA * Fpn;
+          A               = dgam * N;
+          eqps_(cell, pt) = eqpsold(cell, pt);
+          expA            = minitensor::exp(A);
+          Fpnew           = expA * Fpn;
           for (int i(0); i < num_dims_; ++i) {
             for (int j(0); j < num_dims_; ++j) {
-              Fp(cell, pt, i, j) = Fpnew(i, j);
+              Fp_(cell, pt, i, j) = Fpnew(i, j);
             }
           }
         } else {
-          eqps(cell, pt) = eqpsold(cell, pt);
+          eqps_(cell, pt) = eqpsold(cell, pt);
           for (int i(0); i < num_dims_; ++i) {
             for (int j(0); j < num_dims_; ++j) {
-              Fp(cell, pt, i, j) = Fpn(i, j);
+              Fp_(cell, pt, i, j) = Fpn(i, j);
             }
           }
         }
@@ -408,12 +421,12 @@ CreepModel<EvalT, Traits>::computeState(
         while (!converged) {
           count++;
           solver.solve(dFdX, X, F);
-          H = 2. * mubar * delta_time(0) * temp_adj_relaxation_para_ *
+          H = 2. * mubar * delta_time_(0) * temp_adj_relaxation_para_ *
               std::pow(
                   (smag + 2. / 3. * (K * X[0]) - f) *
                       (smag + 2. / 3. * (K * X[0]) - f),
                   strain_rate_expo_ / 2.);
-          dH = strain_rate_expo_ * 2. * mubar * delta_time(0) *
+          dH = strain_rate_expo_ * 2. * mubar * delta_time_(0) *
                temp_adj_relaxation_para_ * (2. * K) / 3. *
                std::pow(
                    (smag + 2. / 3. * (K * X[0]) - f) *
@@ -446,7 +459,7 @@ CreepModel<EvalT, Traits>::computeState(
              2. * mubar * (1. + K / (3. * mubar)) * dgam_plastic * N;
 
         dgam =
-            dgam_plastic + delta_time(0) * temp_adj_relaxation_para_ *
+            dgam_plastic + delta_time_(0) * temp_adj_relaxation_para_ *
                                std::pow(minitensor::norm(s), strain_rate_expo_);
 
         alpha = eqpsold(cell, pt) + sq23 * dgam_plastic;
@@ -455,14 +468,14 @@ CreepModel<EvalT, Traits>::computeState(
         N = s / minitensor::norm(s);
 
         // update eqps
-        eqps(cell, pt) = alpha;
+        eqps_(cell, pt) = alpha;
 
         // mechanical source
-        if (have_temperature_ && delta_time(0) > 0) {
-          source(cell, pt) =
-              0.0 *
-              (sq23 * dgam / delta_time(0) * (Y + H + temperature_(cell, pt))) /
-              (density_ * heat_capacity_);
+        if (have_temperature_ && delta_time_(0) > 0) {
+          source_(cell, pt) = 0.0 *
+                              (sq23 * dgam / delta_time_(0) *
+                               (Y + H + temperature_(cell, pt))) /
+                              (density_ * heat_capacity_);
         }
 
         // exponential map to get Fpnew
@@ -471,18 +484,18 @@ CreepModel<EvalT, Traits>::computeState(
         Fpnew = expA * Fpn;
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fpnew(i, j);
+            Fp_(cell, pt, i, j) = Fpnew(i, j);
           }
         }
       }
 
-      p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
+      p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
 
       // compute stress
-      sigma = p * I + s / J(cell, pt);
+      sigma = p * I + s / J_(cell, pt);
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
     }
@@ -491,16 +504,16 @@ CreepModel<EvalT, Traits>::computeState(
   if (have_temperature_) {
     for (int cell(0); cell < workset.numCells; ++cell) {
       for (int pt(0); pt < num_pts_; ++pt) {
-        ScalarT three_kappa =
-            elastic_modulus(cell, pt) / (1.0 - 2.0 * poissons_ratio(cell, pt));
-        F.fill(def_grad, cell, pt, 0, 0);
+        ScalarT three_kappa = elastic_modulus_(cell, pt) /
+                              (1.0 - 2.0 * poissons_ratio_(cell, pt));
+        F.fill(def_grad_, cell, pt, 0, 0);
         ScalarT J = minitensor::det(F);
-        sigma.fill(stress, cell, pt, 0, 0);
+        sigma.fill(stress_, cell, pt, 0, 0);
         sigma -= three_kappa * expansion_coeff_ * (1.0 + 1.0 / (J * J)) *
                  (temperature_(cell, pt) - ref_temperature_) * I;
         for (int i = 0; i < num_dims_; ++i) {
           for (int j = 0; j < num_dims_; ++j) {
-            stress(cell, pt, i, j) = sigma(i, j);
+            stress_(cell, pt, i, j) = sigma(i, j);
           }
         }
       }
@@ -49,6 +49,7 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
 
   using BaseKernel::addStateVariable;
   using BaseKernel::extractEvaluatedFieldArray;
+  using BaseKernel::extractOldStateArray;
   using BaseKernel::setDependentField;
   using BaseKernel::setEvaluatedField;
 
@@ -71,6 +72,17 @@ class CrystalPlasticityKernel : public ParallelKernel<EvalT, Traits>
   ///
   virtual ~CrystalPlasticityKernel() {}
 
+  ///
+  /// Bind the fields, once at setup time
+  ///
+  void
+  bindFields(
+      FieldMap<const ScalarT>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
+  ///
+  /// Set the per-workset data
+  ///
   void
   init(
       Workset&                 workset,
@@ -449,32 +449,14 @@ CrystalPlasticityKernel<EvalT, Traits>::CrystalPlasticityKernel(
 }
 
 //
-// Initialize state for computing the constitutive response of the material
+// Bind the fields for computing the constitutive response of the material
 //
 template <typename EvalT, typename Traits>
 void
-CrystalPlasticityKernel<EvalT, Traits>::init(
-    Workset&                 workset,
+CrystalPlasticityKernel<EvalT, Traits>::bindFields(
     FieldMap<const ScalarT>& dep_fields,
     FieldMap<ScalarT>&       eval_fields)
 {
-  if (verbosity_ == CP::Verbosity::EXTREME) {
-    index_element_ = workset.wsIndex;
-  } else {
-    index_element_ = -1;
-  }
-
-  if (verbosity_ >= CP::Verbosity::MEDIUM) {
-    std::cout << ">>> kernel::init\n";
-  }
-
-  if (read_orientations_from_mesh_) {
-    rotation_matrix_transpose_ = workset.wsLatticeOrientation;
-    ALBANY_ASSERT(
-        rotation_matrix_transpose_.is_null() == false,
-        "Rotation matrix not found on genesis mesh");
-  }
-
   //
   // extract dependent MDFields
   //
@@ -499,27 +481,51 @@ CrystalPlasticityKernel<EvalT, Traits>::init(
   cp_residual_iter_          = *eval_fields[residual_iter_string_];
 
   // extract slip on each slip system
-  extractEvaluatedFieldArray(
-      "gamma", num_slip_, slips_, previous_slips_, eval_fields, workset);
+  extractEvaluatedFieldArray("gamma", num_slip_, slips_, eval_fields);
 
   // extract slip rate on each slip system
-  extractEvaluatedFieldArray(
-      "gamma_dot",
-      num_slip_,
-      slip_rates_,
-      previous_slip_rates_,
-      eval_fields,
-      workset);
+  extractEvaluatedFieldArray("gamma_dot", num_slip_, slip_rates_, eval_fields);
 
   // extract hardening on each slip system
-  extractEvaluatedFieldArray(
-      "tau_hard", num_slip_, hards_, previous_hards_, eval_fields, workset);
+  extractEvaluatedFieldArray("tau_hard", num_slip_, hards_, eval_fields);
 
   // store shear on each slip system for output
   extractEvaluatedFieldArray("tau", num_slip_, shears_, eval_fields);
+}
+
+//
+// Initialize state for computing the constitutive response of the material
+//
+template <typename EvalT, typename Traits>
+void
+CrystalPlasticityKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<const ScalarT>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
+{
+  if (verbosity_ == CP::Verbosity::EXTREME) {
+    index_element_ = workset.wsIndex;
+  } else {
+    index_element_ = -1;
+  }
+
+  if (verbosity_ >= CP::Verbosity::MEDIUM) {
+    std::cout << ">>> kernel::init\n";
+  }
+
+  if (read_orientations_from_mesh_) {
+    rotation_matrix_transpose_ = workset.wsLatticeOrientation;
+    ALBANY_ASSERT(
+        rotation_matrix_transpose_.is_null() == false,
+        "Rotation matrix not found on genesis mesh");
+  }
 
   // get state variables
 
+  extractOldStateArray("gamma", num_slip_, previous_slips_, workset);
+  extractOldStateArray("gamma_dot", num_slip_, previous_slip_rates_, workset);
+  extractOldStateArray("tau_hard", num_slip_, previous_hards_, workset);
+
   previous_plastic_deformation_ = (*workset.stateArrayPtr)[Fp_string_ + "_old"];
   previous_defgrad_             = (*workset.stateArrayPtr)[F_string_ + "_old"];
 
@@ -52,20 +52,23 @@ class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~DruckerPragerModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -105,6 +108,23 @@ class DruckerPragerModel : public LCM::ConstitutiveModel<EvalT, Traits>
       const ScalarT         eqN,
       const ScalarT         mu,
       const ScalarT         kappa);
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> friction_;
+  PHX::MDField<ScalarT> tangent_;
+
+  // Names of the old state variables
+  std::string strain_old_string_;
+  std::string stress_old_string_;
+  std::string eqps_old_string_;
+  std::string friction_old_string_;
 };
 }  // namespace LCM
 
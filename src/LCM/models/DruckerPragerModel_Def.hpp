@@ -86,15 +86,14 @@ DruckerPragerModel<EvalT, Traits>::DruckerPragerModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-DruckerPragerModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+DruckerPragerModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string   = (*field_name_map_)["Cauchy_Stress"];
@@ -103,17 +102,30 @@ DruckerPragerModel<EvalT, Traits>::computeState(
   std::string friction_string = (*field_name_map_)["Friction_Parameter"];
 
   // extract evaluated MDFields
-  auto stress   = *eval_fields[cauchy_string];
-  auto eqps     = *eval_fields[eqps_string];
-  auto friction = *eval_fields[friction_string];
-  auto tangent  = *eval_fields["Material Tangent"];
-
+  stress_   = *eval_fields[cauchy_string];
+  eqps_     = *eval_fields[eqps_string];
+  friction_ = *eval_fields[friction_string];
+  tangent_  = *eval_fields["Material Tangent"];
+
+  // names of the old state variables
+  strain_old_string_   = strain_string + "_old";
+  stress_old_string_   = cauchy_string + "_old";
+  eqps_old_string_     = eqps_string + "_old";
+  friction_old_string_ = friction_string + "_old";
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+DruckerPragerModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray strainold = (*workset.stateArrayPtr)[strain_string + "_old"];
-  Albany::MDArray stressold = (*workset.stateArrayPtr)[cauchy_string + "_old"];
-  Albany::MDArray eqpsold   = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray frictionold =
-      (*workset.stateArrayPtr)[friction_string + "_old"];
+  Albany::MDArray strainold   = (*workset.stateArrayPtr)[strain_old_string_];
+  Albany::MDArray stressold   = (*workset.stateArrayPtr)[stress_old_string_];
+  Albany::MDArray eqpsold     = (*workset.stateArrayPtr)[eqps_old_string_];
+  Albany::MDArray frictionold = (*workset.stateArrayPtr)[friction_old_string_];
 
   minitensor::Tensor<ScalarT>  id(minitensor::eye<ScalarT>(num_dims_));
   minitensor::Tensor4<ScalarT> id1(minitensor::identity_1<ScalarT>(num_dims_));
@@ -140,10 +152,11 @@ DruckerPragerModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      lambda =
-          (elastic_modulus(cell, pt) * poissons_ratio(cell, pt)) /
-          ((1 + poissons_ratio(cell, pt)) * (1 - 2 * poissons_ratio(cell, pt)));
-      mu    = elastic_modulus(cell, pt) / (2 * (1 + poissons_ratio(cell, pt)));
+      lambda = (elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt)) /
+               ((1 + poissons_ratio_(cell, pt)) *
+                (1 - 2 * poissons_ratio_(cell, pt)));
+      mu    = elastic_modulus_(cell, pt) /
+              (2 * (1 + poissons_ratio_(cell, pt)));
       kappa = lambda + 2.0 * mu / 3.0;
 
       // 4-th order elasticity tensor
@@ -161,7 +174,7 @@ DruckerPragerModel<EvalT, Traits>::computeState(
         }
       }
 
-      epsilon.fill(strain, cell, pt, 0, 0);
+      epsilon.fill(strain_, cell, pt, 0, 0);
       depsilon = epsilon - epsilonN;
 
       alphaN = frictionold(cell, pt);
@@ -249,12 +262,12 @@ DruckerPragerModel<EvalT, Traits>::computeState(
       s     = sqrt(2.0 / 3.0) * q * nhat;
       sigma = s + p * id;
 
-      eqps(cell, pt)     = eq;
-      friction(cell, pt) = alpha;
+      eqps_(cell, pt)     = eq;
+      friction_(cell, pt) = alpha;
 
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
 
@@ -67,21 +67,24 @@ class ElasticCrystalModel : public LCM::ConstitutiveModel<EvalT, Traits>
       // empty
   };
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   // This capability not implemented yet.
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -110,6 +113,13 @@ class ElasticCrystalModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
   // Gas constant
   RealType R_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
 };
 }  // namespace LCM
 
@@ -167,21 +167,29 @@ ElasticCrystalModel<EvalT, Traits>::ElasticCrystalModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-ElasticCrystalModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+ElasticCrystalModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   std::string F_string = (*field_name_map_)["F"];
   std::string J_string = (*field_name_map_)["J"];
   std::string cauchy   = (*field_name_map_)["Cauchy_Stress"];
 
   // extract dependent MDFields
-  auto def_grad = *dep_fields[F_string];
-  auto J        = *dep_fields[J_string];
+  def_grad_ = *dep_fields[F_string];
+  J_        = *dep_fields[J_string];
   // extract evaluated MDFields
-  auto stress = *eval_fields[cauchy];
+  stress_ = *eval_fields[cauchy];
+}
 
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+ElasticCrystalModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // deformation gradient
   minitensor::Tensor<ScalarT> F(num_dims_);
 
@@ -238,11 +246,11 @@ ElasticCrystalModel<EvalT, Traits>::computeState(
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
       // get jacobian
-      Jac = J(cell, pt);
+      Jac = J_(cell, pt);
       // get Jac23 at Gauss point
-      Jac23 = std::pow(J(cell, pt), -2.0 / 3.0);
+      Jac23 = std::pow(J_(cell, pt), -2.0 / 3.0);
       // Fill deformation gradient
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       // compute right Cauchy-Green deformation tensor ==> C = F^{T}*F
       C = transpose(F) * F;
       // compute modified right Cauchy-Green deformation tensor ==> C =
@@ -289,7 +297,7 @@ ElasticCrystalModel<EvalT, Traits>::computeState(
       // fill Cauchy stress
       for (int i = 0; i < num_dims_; i++) {
         for (int j = 0; j < num_dims_; j++) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
 
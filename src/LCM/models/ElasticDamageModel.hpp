@@ -47,20 +47,23 @@ class ElasticDamageModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~ElasticDamageModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -81,6 +84,20 @@ class ElasticDamageModel : public LCM::ConstitutiveModel<EvalT, Traits>
   /// Damage parameters
   ///
   RealType max_damage_, saturation_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> energy_;
+  PHX::MDField<ScalarT> matrix_damage_;
+  PHX::MDField<ScalarT> tangent_;
+
+  // Name of the old energy state variable
+  std::string energy_old_string_;
 };
 }  // namespace LCM
 
@@ -73,19 +73,14 @@ ElasticDamageModel<EvalT, Traits>::ElasticDamageModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-ElasticDamageModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+ElasticDamageModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
-  // bool print = false;
-  // if (typeid(ScalarT) == typeid(RealType)) print = true;
-  // cout.precision(15);
-
   // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string  = (*field_name_map_)["Cauchy_Stress"];
@@ -94,15 +89,28 @@ ElasticDamageModel<EvalT, Traits>::computeState(
   std::string tangent_string = (*field_name_map_)["Material Tangent"];
 
   // extract evaluated MDFields
-  auto                  stress = *eval_fields[cauchy_string];
-  auto                  energy = *eval_fields[energy_string];
-  auto                  damage = *eval_fields[damage_string];
-  PHX::MDField<ScalarT> tangent;
+  stress_        = *eval_fields[cauchy_string];
+  energy_        = *eval_fields[energy_string];
+  matrix_damage_ = *eval_fields[damage_string];
+
+  if (compute_tangent_) { tangent_ = *eval_fields[tangent_string]; }
 
-  if (compute_tangent_) { tangent = *eval_fields[tangent_string]; }
+  energy_old_string_ = energy_string + "_old";
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+ElasticDamageModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  // bool print = false;
+  // if (typeid(ScalarT) == typeid(RealType)) print = true;
+  // cout.precision(15);
 
   // previous state
-  Albany::MDArray energy_old = (*workset.stateArrayPtr)[energy_string + "_old"];
+  Albany::MDArray energy_old = (*workset.stateArrayPtr)[energy_old_string_];
 
   ScalarT mu, lame;
   ScalarT alpha, damage_deriv;
@@ -121,19 +129,20 @@ ElasticDamageModel<EvalT, Traits>::computeState(
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int pt = 0; pt < num_pts_; ++pt) {
       // local parameters
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      lame = elastic_modulus(cell, pt) * poissons_ratio(cell, pt) /
-             (1.0 + poissons_ratio(cell, pt)) /
-             (1.0 - 2.0 * poissons_ratio(cell, pt));
+      mu = elastic_modulus_(cell, pt) /
+           (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+      lame = elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt) /
+             (1.0 + poissons_ratio_(cell, pt)) /
+             (1.0 - 2.0 * poissons_ratio_(cell, pt));
 
       // small strain tensor
-      epsilon.fill(strain, cell, pt, 0, 0);
+      epsilon.fill(strain_, cell, pt, 0, 0);
 
       // undamaged elasticity tensor
       Ce = lame * id3 + 2.0 * mu * id4;
 
       // undamaged energy
-      energy(cell, pt) =
+      energy_(cell, pt) =
           0.5 * minitensor::dotdot(minitensor::dotdot(epsilon, Ce), epsilon);
 
       // undamaged Cauchy stress
@@ -141,24 +150,26 @@ ElasticDamageModel<EvalT, Traits>::computeState(
 
       // maximum thermodynamic force
       alpha = energy_old(cell, pt);
-      if (energy(cell, pt) > alpha) alpha = energy(cell, pt);
+      if (energy_(cell, pt) > alpha) alpha = energy_(cell, pt);
 
       // damage term
-      damage(cell, pt) = max_damage_ * (1 - std::exp(-alpha / saturation_));
+      matrix_damage_(cell, pt) =
+          max_damage_ * (1 - std::exp(-alpha / saturation_));
 
       // derivative of damage w.r.t alpha
       damage_deriv = max_damage_ / saturation_ * std::exp(-alpha / saturation_);
 
       // tangent for matrix considering damage
       if (compute_tangent_) {
-        Ce = (1.0 - damage(cell, pt)) * Ce -
+        Ce = (1.0 - matrix_damage_(cell, pt)) * Ce -
              damage_deriv * minitensor::tensor(sigma, sigma);
       }
 
       // total Cauchy stress
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = (1.0 - damage(cell, pt)) * sigma(i, j);
+          stress_(cell, pt, i, j) =
+              (1.0 - matrix_damage_(cell, pt)) * sigma(i, j);
         }
       }
 
@@ -168,7 +179,7 @@ ElasticDamageModel<EvalT, Traits>::computeState(
           for (int j(0); j < num_dims_; ++j) {
             for (int k(0); k < num_dims_; ++k) {
               for (int l(0); l < num_dims_; ++l) {
-                tangent(cell, pt, i, j, k, l) = Ce(i, j, k, l);
+                tangent_(cell, pt, i, j, k, l) = Ce(i, j, k, l);
               }
             }
           }
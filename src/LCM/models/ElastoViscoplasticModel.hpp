@@ -55,20 +55,23 @@ class ElastoViscoplasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~ElastoViscoplasticModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -158,6 +161,34 @@ class ElastoViscoplasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
   template <typename T>
   T
   compute_fstar(T f, RealType fc, RealType ff, RealType q1);
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+  PHX::MDField<const ScalarT> yield_strength_;
+  PHX::MDField<const ScalarT> hardening_modulus_;
+  PHX::MDField<const ScalarT> recovery_modulus_;
+  PHX::MDField<const ScalarT> flow_exp_;
+  PHX::MDField<const ScalarT> flow_coeff_;
+  PHX::MDField<const ScalarT> delta_time_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> Fp_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> eps_ss_;
+  PHX::MDField<ScalarT> isotropic_hardening_;
+  PHX::MDField<ScalarT> void_volume_fraction_;
+  PHX::MDField<ScalarT> source_;
+
+  // Names of the old state variables
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
+  std::string eps_ss_old_string_;
+  std::string kappa_old_string_;
+  std::string void_volume_fraction_old_string_;
 };
 }  // namespace LCM
 
@@ -289,10 +289,9 @@ ElastoViscoplasticModel<EvalT, Traits>::ElastoViscoplasticModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-ElastoViscoplasticModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+ElastoViscoplasticModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // get strings from field_name_map in order to extract MDFields
   //
@@ -309,39 +308,55 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
 
   // extract dependent MDFields
   //
-  auto def_grad_field    = *dep_fields[F_string];
-  auto J                 = *dep_fields[J_string];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto recovery_modulus  = *dep_fields["Recovery Modulus"];
-  auto flow_exp          = *dep_fields["Flow Rule Exponent"];
-  auto flow_coeff        = *dep_fields["Flow Rule Coefficient"];
-  auto delta_time        = *dep_fields["Delta Time"];
+  def_grad_          = *dep_fields[F_string];
+  J_                 = *dep_fields[J_string];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  recovery_modulus_  = *dep_fields["Recovery Modulus"];
+  flow_exp_          = *dep_fields["Flow Rule Exponent"];
+  flow_coeff_        = *dep_fields["Flow Rule Coefficient"];
+  delta_time_        = *dep_fields["Delta Time"];
 
   // extract evaluated MDFields
   //
-  auto stress_field               = *eval_fields[cauchy_string];
-  auto Fp_field                   = *eval_fields[Fp_string];
-  auto eqps_field                 = *eval_fields[eqps_string];
-  auto eps_ss_field               = *eval_fields[eps_ss_string];
-  auto kappa_field                = *eval_fields[kappa_string];
-  auto void_volume_fraction_field = *eval_fields[void_volume_fraction_string];
-  PHX::MDField<ScalarT> source_field;
-  if (have_temperature_) { source_field = *eval_fields[source_string]; }
+  stress_               = *eval_fields[cauchy_string];
+  Fp_                   = *eval_fields[Fp_string];
+  eqps_                 = *eval_fields[eqps_string];
+  eps_ss_               = *eval_fields[eps_ss_string];
+  isotropic_hardening_  = *eval_fields[kappa_string];
+  void_volume_fraction_ = *eval_fields[void_volume_fraction_string];
+  if (have_temperature_) { source_ = *eval_fields[source_string]; }
+
+  // names of the old state variables
+  //
+  Fp_old_string_                   = Fp_string + "_old";
+  eqps_old_string_                 = eqps_string + "_old";
+  eps_ss_old_string_               = eps_ss_string + "_old";
+  kappa_old_string_                = kappa_string + "_old";
+  void_volume_fraction_old_string_ = void_volume_fraction_string + "_old";
+}
 
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+ElastoViscoplasticModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
   //
-  Albany::MDArray Fp_field_old = (*workset.stateArrayPtr)[Fp_string + "_old"];
+  Albany::MDArray Fp_field_old = (*workset.stateArrayPtr)[Fp_old_string_];
   Albany::MDArray eqps_field_old =
-      (*workset.stateArrayPtr)[eqps_string + "_old"];
+      (*workset.stateArrayPtr)[eqps_old_string_];
   Albany::MDArray eps_ss_field_old =
-      (*workset.stateArrayPtr)[eps_ss_string + "_old"];
+      (*workset.stateArrayPtr)[eps_ss_old_string_];
   Albany::MDArray kappa_field_old =
-      (*workset.stateArrayPtr)[kappa_string + "_old"];
+      (*workset.stateArrayPtr)[kappa_old_string_];
   Albany::MDArray void_volume_fraction_field_old =
-      (*workset.stateArrayPtr)[void_volume_fraction_string + "_old"];
+      (*workset.stateArrayPtr)[void_volume_fraction_old_string_];
 
   // define constants
   //
@@ -366,11 +381,11 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      ScalarT bulk = elastic_modulus(cell, pt) /
-                     (3. * (1. - 2. * poissons_ratio(cell, pt)));
+      ScalarT bulk = elastic_modulus_(cell, pt) /
+                     (3. * (1. - 2. * poissons_ratio_(cell, pt)));
       ScalarT mu =
-          elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      ScalarT Y = yield_strength(cell, pt);
+          elastic_modulus_(cell, pt) / (2. * (1. + poissons_ratio_(cell, pt)));
+      ScalarT Y = yield_strength_(cell, pt);
 
       // adjustment to the yield strength in the presence of hydrogen
       //
@@ -400,7 +415,7 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
       // void volume fraction ~ damage
       //
       ScalarT kappa_old  = kappa_field_old(cell, pt);
-      ScalarT eps_ss     = eps_ss_field(cell, pt);
+      ScalarT eps_ss     = eps_ss_(cell, pt);
       ScalarT eps_ss_old = eps_ss_field_old(cell, pt);
       ScalarT eqps_old   = eqps_field_old(cell, pt);
       ScalarT void_volume_fraction_old =
@@ -416,7 +431,7 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
       if (!failed) {
         // fill local tensors
         //
-        F.fill(def_grad_field, cell, pt, 0, 0);
+        F.fill(def_grad_, cell, pt, 0, 0);
 
         // Mechanical deformation gradient
         auto Fm = minitensor::Tensor<ScalarT>(F);
@@ -497,13 +512,13 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
 
           // hardening and recovery parameters
           //
-          ScalarT H  = hardening_modulus(cell, pt);
-          ScalarT Rd = recovery_modulus(cell, pt);
+          ScalarT H  = hardening_modulus_(cell, pt);
+          ScalarT Rd = recovery_modulus_(cell, pt);
 
           // flow rule temperature dependent parameters
           //
-          ScalarT f = flow_coeff(cell, pt);
-          ScalarT n = flow_exp(cell, pt);
+          ScalarT f = flow_coeff_(cell, pt);
+          ScalarT n = flow_exp_(cell, pt);
 
           // This solver deals with Sacado type info
           //
@@ -598,8 +613,8 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
             //
             Fad eqps_rateF = 0.0;
             Fad rate_termF;
-            if (delta_time(0) > 0 && dgamF > 0.0) {
-              eqps_rateF = sq23 * dgamF / delta_time(0);
+            if (delta_time_(0) > 0 && dgamF > 0.0) {
+              eqps_rateF = sq23 * dgamF / delta_time_(0);
               rate_termF = 1.0 + std::asinh(std::pow(eqps_rateF / f, n));
             } else {
               rate_termF = 1.0;
@@ -822,8 +837,8 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
           // mechanical source
           // FIXME this is not correct, just a placeholder
           //
-          if (have_temperature_ && delta_time(0) > 0) {
-            source_field(cell, pt) = (sq23 * dgam / delta_time(0)) *
+          if (have_temperature_ && delta_time_(0) > 0) {
+            source_(cell, pt) = (sq23 * dgam / delta_time_(0)) *
                                      (Y + kappa) / (density_ * heat_capacity_);
           }
 
@@ -837,28 +852,28 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
           Fpnew = minitensor::exp(dgam * dPhi) * Fpn;
           for (std::size_t i(0); i < num_dims_; ++i) {
             for (std::size_t j(0); j < num_dims_; ++j) {
-              Fp_field(cell, pt, i, j) = Fpnew(i, j);
+              Fp_(cell, pt, i, j) = Fpnew(i, j);
             }
           }
 
           // update other plasticity state variables
           //
-          eps_ss_field(cell, pt)               = eps_ss;
-          eqps_field(cell, pt)                 = eqps;
-          kappa_field(cell, pt)                = kappa;
-          void_volume_fraction_field(cell, pt) = void_volume_fraction;
+          eps_ss_(cell, pt)               = eps_ss;
+          eqps_(cell, pt)                 = eqps;
+          isotropic_hardening_(cell, pt)  = kappa;
+          void_volume_fraction_(cell, pt) = void_volume_fraction;
 
         } else {
           // we are not yielding, variables do not evolve
           //
-          eps_ss_field(cell, pt)               = eps_ss_old;
-          eqps_field(cell, pt)                 = eqps_old;
-          kappa_field(cell, pt)                = kappa_old;
-          void_volume_fraction_field(cell, pt) = void_volume_fraction_old;
-          if (have_temperature_) source_field(cell, pt) = 0.0;
+          eps_ss_(cell, pt)               = eps_ss_old;
+          eqps_(cell, pt)                 = eqps_old;
+          isotropic_hardening_(cell, pt)  = kappa_old;
+          void_volume_fraction_(cell, pt) = void_volume_fraction_old;
+          if (have_temperature_) source_(cell, pt) = 0.0;
           for (std::size_t i(0); i < num_dims_; ++i) {
             for (std::size_t j(0); j < num_dims_; ++j) {
-              Fp_field(cell, pt, i, j) = Fpn(i, j);
+              Fp_(cell, pt, i, j) = Fpn(i, j);
             }
           }
         }
@@ -868,18 +883,18 @@ ElastoViscoplasticModel<EvalT, Traits>::computeState(
         sigma = p / Je * I + s / Je;
         for (std::size_t i(0); i < num_dims_; ++i) {
           for (std::size_t j(0); j < num_dims_; ++j) {
-            stress_field(cell, pt, i, j) = sigma(i, j);
+            stress_(cell, pt, i, j) = sigma(i, j);
           }
         }
       } else {  // this point has failed
-        eps_ss_field(cell, pt) = eps_ss_field_old(cell, pt);
-        eqps_field(cell, pt)   = eqps_field_old(cell, pt);
-        kappa_field(cell, pt)  = kappa_field_old(cell, pt);
-        if (have_temperature_) source_field(cell, pt) = 0.0;
+        eps_ss_(cell, pt)              = eps_ss_field_old(cell, pt);
+        eqps_(cell, pt)                = eqps_field_old(cell, pt);
+        isotropic_hardening_(cell, pt) = kappa_field_old(cell, pt);
+        if (have_temperature_) source_(cell, pt) = 0.0;
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp_field(cell, pt, i, j)     = Fp_field_old(cell, pt, i, j);
-            stress_field(cell, pt, i, j) = 0.0;
+            Fp_(cell, pt, i, j)     = Fp_field_old(cell, pt, i, j);
+            stress_(cell, pt, i, j) = 0.0;
           }
         }
       }
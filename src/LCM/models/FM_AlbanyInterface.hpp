@@ -50,21 +50,24 @@ class FerroicDriver : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~FerroicDriver(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   // Kokkos
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
  private:
   Teuchos::RCP<FM::FerroicModel<EvalT>> ferroicModel;
@@ -96,6 +99,17 @@ class FerroicDriver : public LCM::ConstitutiveModel<EvalT, Traits>
   /// STATE VARIABLE NAMES
   ///
   Teuchos::Array<std::string> binNames;
+  Teuchos::Array<std::string> oldBinNames_;
+
+  ///
+  /// BOUND FIELDS
+  ///
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> gradp_;
+
+  PHX::MDField<ScalarT>                 stress_;
+  PHX::MDField<ScalarT>                 edisp_;
+  Teuchos::Array<PHX::MDField<ScalarT>> newBinFractions_;
 };
 
 void
@@ -190,24 +190,39 @@ FerroicDriver<EvalT, Traits>::FerroicDriver(
 /******************************************************************************/
 template <typename EvalT, typename Traits>
 void
-FerroicDriver<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+FerroicDriver<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 /******************************************************************************/
 {
-  auto strain = *dep_fields[strainName];
-  auto Gradp  = *dep_fields[efieldName];
+  strain_ = *dep_fields[strainName];
+  gradp_  = *dep_fields[efieldName];
 
-  auto stress = *eval_fields[stressName];
-  auto edisp  = *eval_fields[edispName];
+  stress_ = *eval_fields[stressName];
+  edisp_  = *eval_fields[edispName];
 
-  int                                   nVariants = binNames.size();
-  Teuchos::Array<PHX::MDField<ScalarT>> newBinFractions(nVariants);
-  Teuchos::Array<Albany::MDArray>       oldBinFractions(nVariants);
+  int nVariants = binNames.size();
+  newBinFractions_.resize(nVariants);
+  oldBinNames_.resize(nVariants);
+  for (int i = 0; i < nVariants; i++) {
+    newBinFractions_[i] = *eval_fields[binNames[i]];
+    oldBinNames_[i]     = binNames[i] + "_old";
+  }
+}
+
+/******************************************************************************/
+template <typename EvalT, typename Traits>
+void
+FerroicDriver<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+/******************************************************************************/
+{
+  int                             nVariants = binNames.size();
+  Teuchos::Array<Albany::MDArray> oldBinFractions(nVariants);
   for (int i = 0; i < nVariants; i++) {
-    oldBinFractions[i] = (*workset.stateArrayPtr)[binNames[i] + "_old"];
-    newBinFractions[i] = *eval_fields[binNames[i]];
+    oldBinFractions[i] = (*workset.stateArrayPtr)[oldBinNames_[i]];
   }
 
   int numCells = workset.numCells;
@@ -219,8 +234,8 @@ FerroicDriver<EvalT, Traits>::computeState(
 
   for (int cell = 0; cell < numCells; ++cell) {
     for (int qp = 0; qp < num_pts_; ++qp) {
-      x.fill(strain, cell, qp, 0, 0);
-      E.fill(Gradp, cell, qp, 0);
+      x.fill(strain_, cell, qp, 0, 0);
+      E.fill(gradp_, cell, qp, 0);
       E *= -1.0;
 
       for (int vnt = 0; vnt < nVariants; vnt++) {
@@ -237,12 +252,12 @@ FerroicDriver<EvalT, Traits>::computeState(
           newfractions);
 
       for (int i = 0; i < 3; i++)
-        for (int j = 0; j < 3; j++) stress(cell, qp, i, j) = X(i, j);
+        for (int j = 0; j < 3; j++) stress_(cell, qp, i, j) = X(i, j);
 
-      for (int i = 0; i < 3; i++) edisp(cell, qp, i) = D(i);
+      for (int i = 0; i < 3; i++) edisp_(cell, qp, i) = D(i);
 
       for (int vnt = 0; vnt < nVariants; vnt++)
-        newBinFractions[vnt](cell, qp) = newfractions[vnt];
+        newBinFractions_[vnt](cell, qp) = newfractions[vnt];
     }
   }
 }
@@ -252,8 +267,8 @@ template <typename EvalT, typename Traits>
 void
 FerroicDriver<EvalT, Traits>::computeStateParallel(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 /******************************************************************************/
 {
   TEUCHOS_TEST_FOR_EXCEPTION(
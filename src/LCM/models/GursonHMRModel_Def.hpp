@@ -118,19 +118,18 @@ GursonHMRModel<EvalT, Traits>::GursonHMRModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-GursonHMRModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+GursonHMRModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto recovery_modulus  = *dep_fields["Recovery Modulus"];
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  recovery_modulus_  = *dep_fields["Recovery Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
@@ -141,21 +140,36 @@ GursonHMRModel<EvalT, Traits>::computeState(
   std::string void_string         = (*field_name_map_)["Void_Volume"];
 
   // extract evaluated MDFields
-  auto stress       = *eval_fields[cauchy_string];
-  auto Fp           = *eval_fields[Fp_string];
-  auto eqps         = *eval_fields[eqps_string];
-  auto ess          = *eval_fields[ess_string];
-  auto isoHardening = *eval_fields[isoHardening_string];
-  auto void_volume  = *eval_fields[void_string];
-
+  stress_        = *eval_fields[cauchy_string];
+  Fp_            = *eval_fields[Fp_string];
+  eqps_          = *eval_fields[eqps_string];
+  ess_           = *eval_fields[ess_string];
+  iso_hardening_ = *eval_fields[isoHardening_string];
+  void_volume_   = *eval_fields[void_string];
+
+  // names of the old state variables
+  Fp_old_string_            = Fp_string + "_old";
+  eqps_old_string_          = eqps_string + "_old";
+  ess_old_string_           = ess_string + "_old";
+  iso_hardening_old_string_ = isoHardening_string + "_old";
+  void_volume_old_string_   = void_string + "_old";
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+GursonHMRModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_string + "_old"];
-  Albany::MDArray ess_old  = (*workset.stateArrayPtr)[ess_string + "_old"];
+  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_old_string_];
+  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_old_string_];
+  Albany::MDArray ess_old  = (*workset.stateArrayPtr)[ess_old_string_];
   Albany::MDArray isoHardening_old =
-      (*workset.stateArrayPtr)[isoHardening_string + "_old"];
+      (*workset.stateArrayPtr)[iso_hardening_old_string_];
   Albany::MDArray void_volume_old =
-      (*workset.stateArrayPtr)[void_string + "_old"];
+      (*workset.stateArrayPtr)[void_volume_old_string_];
 
   minitensor::Tensor<ScalarT> F(num_dims_), be(num_dims_), logbe(num_dims_);
   minitensor::Tensor<ScalarT> s(num_dims_), sigma(num_dims_), N(num_dims_);
@@ -178,15 +192,16 @@ GursonHMRModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3.0 * (1.0 - 2.0 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      H  = hardening_modulus(cell, pt);
-      Y  = yield_strength(cell, pt);
-      Rd = recovery_modulus(cell, pt);
+      kappa = elastic_modulus_(cell, pt) /
+              (3.0 * (1.0 - 2.0 * poissons_ratio_(cell, pt)));
+      mu = elastic_modulus_(cell, pt) /
+           (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+      H  = hardening_modulus_(cell, pt);
+      Y  = yield_strength_(cell, pt);
+      Rd = recovery_modulus_(cell, pt);
 
       // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       // Fpn.fill( &Fpold(cell,pt,int(0),int(0)) );
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
@@ -209,7 +224,7 @@ GursonHMRModel<EvalT, Traits>::computeState(
       isoH       = isoHardening_old(cell, pt);
 
       // check yield condition
-      Phi = YieldFunction(s, p, fvoid, Y, isoH, J(cell, pt));
+      Phi = YieldFunction(s, p, fvoid, Y, isoH, J_(cell, pt));
 
       dgam = 0.0;
       if (Phi > 0.0) {  // plastic yielding
@@ -228,7 +243,7 @@ GursonHMRModel<EvalT, Traits>::computeState(
         // local N-R loop
         while (true) {
           ResidualJacobian(
-              X, R, dRdX, p, fvoid, es, s, mu, kappa, H, Y, Rd, J(cell, pt));
+              X, R, dRdX, p, fvoid, es, s, mu, kappa, H, Y, Rd, J_(cell, pt));
 
           norm_residual = 0.0;
           for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
@@ -303,29 +318,29 @@ GursonHMRModel<EvalT, Traits>::computeState(
 
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = 0.0;
+            Fp_(cell, pt, i, j) = 0.0;
             for (int k(0); k < num_dims_; ++k) {
-              Fp(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
+              Fp_(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
             }
           }
         }
 
-        eqps(cell, pt)         = eq;
-        ess(cell, pt)          = es;
-        isoHardening(cell, pt) = isoH;
-        void_volume(cell, pt)  = fvoid;
+        eqps_(cell, pt)          = eq;
+        ess_(cell, pt)           = es;
+        iso_hardening_(cell, pt) = isoH;
+        void_volume_(cell, pt)   = fvoid;
 
       }       // end of plastic loading
       else {  // elasticity, set state variables to previous values
 
-        eqps(cell, pt)         = eqps_old(cell, pt);
-        ess(cell, pt)          = ess_old(cell, pt);
-        isoHardening(cell, pt) = isoHardening_old(cell, pt);
-        void_volume(cell, pt)  = void_volume_old(cell, pt);
+        eqps_(cell, pt)          = eqps_old(cell, pt);
+        ess_(cell, pt)           = ess_old(cell, pt);
+        iso_hardening_(cell, pt) = isoHardening_old(cell, pt);
+        void_volume_(cell, pt)   = void_volume_old(cell, pt);
 
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fp_old(cell, pt, i, j);
+            Fp_(cell, pt, i, j) = Fp_old(cell, pt, i, j);
           }
         }
 
@@ -336,9 +351,9 @@ GursonHMRModel<EvalT, Traits>::computeState(
       // because the one computed from return mapping is the Kirchhoff pressure
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = s(i, j) / J(cell, pt);
+          stress_(cell, pt, i, j) = s(i, j) / J_(cell, pt);
         }
-        stress(cell, pt, i, i) += p / J(cell, pt);
+        stress_(cell, pt, i, i) += p / J_(cell, pt);
       }
 
     }  // end of loop over Gauss points
@@ -93,18 +93,17 @@ GursonModel<EvalT, Traits>::GursonModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-GursonModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+GursonModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string = (*field_name_map_)["Cauchy_Stress"];
@@ -113,16 +112,29 @@ GursonModel<EvalT, Traits>::computeState(
   std::string void_string   = (*field_name_map_)["void_volume_fraction"];
 
   // extract evaluated MDFields
-  auto stress      = *eval_fields[cauchy_string];
-  auto Fp          = *eval_fields[Fp_string];
-  auto eqps        = *eval_fields[eqps_string];
-  auto void_volume = *eval_fields[void_string];
-
+  stress_      = *eval_fields[cauchy_string];
+  Fp_          = *eval_fields[Fp_string];
+  eqps_        = *eval_fields[eqps_string];
+  void_volume_ = *eval_fields[void_string];
+
+  // names of the old state variables
+  Fp_old_string_          = Fp_string + "_old";
+  eqps_old_string_        = eqps_string + "_old";
+  void_volume_old_string_ = void_string + "_old";
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+GursonModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_old_string_];
+  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_old_string_];
   Albany::MDArray void_volume_old =
-      (*workset.stateArrayPtr)[void_string + "_old"];
+      (*workset.stateArrayPtr)[void_volume_old_string_];
 
   minitensor::Tensor<ScalarT> F(num_dims_), be(num_dims_), logbe(num_dims_);
   minitensor::Tensor<ScalarT> s(num_dims_), sigma(num_dims_), N(num_dims_);
@@ -143,14 +155,15 @@ GursonModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3.0 * (1.0 - 2.0 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      K  = hardening_modulus(cell, pt);
-      Y  = yield_strength(cell, pt);
+      kappa = elastic_modulus_(cell, pt) /
+              (3.0 * (1.0 - 2.0 * poissons_ratio_(cell, pt)));
+      mu = elastic_modulus_(cell, pt) /
+           (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+      K  = hardening_modulus_(cell, pt);
+      Y  = yield_strength_(cell, pt);
 
       // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       // Fpn.fill( &Fpold(cell,pt,int(0),int(0)) );
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
@@ -176,7 +189,7 @@ GursonModel<EvalT, Traits>::computeState(
 
       // check yield condition
       Phi = YieldFunction(
-          s, p, fvoid, eq, K, Y, J(cell, pt), elastic_modulus(cell, pt));
+          s, p, fvoid, eq, K, Y, J_(cell, pt), elastic_modulus_(cell, pt));
 
       dgam = 0.0;
       if (Phi > 0.0) {  // plastic yielding
@@ -195,7 +208,7 @@ GursonModel<EvalT, Traits>::computeState(
         // local N-R loop
         while (true) {
           ResidualJacobian(
-              X, R, dRdX, p, fvoid, eq, s, mu, kappa, K, Y, J(cell, pt));
+              X, R, dRdX, p, fvoid, eq, s, mu, kappa, K, Y, J_(cell, pt));
 
           norm_residual = 0.0;
           for (int i = 0; i < 4; i++) norm_residual += R[i] * R[i];
@@ -250,7 +263,7 @@ GursonModel<EvalT, Traits>::computeState(
         Ybar = Y + sat_mod_ * (1.0 - std::exp(-sat_exp_ * eq)) + K * eq;
 
         // Kirchhoff_yield_stress = Cauchy_yield_stress * J
-        Ybar = Ybar * J(cell, pt);
+        Ybar = Ybar * J_(cell, pt);
 
         // dPhi w.r.t. dKirchhoff_stress
         ScalarT tmp = 1.5 * q2_ * p / Ybar;
@@ -261,25 +274,25 @@ GursonModel<EvalT, Traits>::computeState(
 
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = 0.0;
+            Fp_(cell, pt, i, j) = 0.0;
             for (int k(0); k < num_dims_; ++k) {
-              Fp(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
+              Fp_(cell, pt, i, j) += expA(i, k) * Fpn(k, j);
             }
           }
         }
 
-        eqps(cell, pt)        = eq;
-        void_volume(cell, pt) = fvoid;
+        eqps_(cell, pt)        = eq;
+        void_volume_(cell, pt) = fvoid;
 
       }       // end of plastic loading
       else {  // elasticity, set state variables to previous values
 
-        eqps(cell, pt)        = eqps_old(cell, pt);
-        void_volume(cell, pt) = void_volume_old(cell, pt);
+        eqps_(cell, pt)        = eqps_old(cell, pt);
+        void_volume_(cell, pt) = void_volume_old(cell, pt);
 
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fp_old(cell, pt, i, j);
+            Fp_(cell, pt, i, j) = Fp_old(cell, pt, i, j);
           }
         }
 
@@ -290,9 +303,9 @@ GursonModel<EvalT, Traits>::computeState(
       // because the one computed from return mapping is the Kirchhoff pressure
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = s(i, j) / J(cell, pt);
+          stress_(cell, pt, i, j) = s(i, j) / J_(cell, pt);
         }
-        stress(cell, pt, i, i) += p / J(cell, pt);
+        stress_(cell, pt, i, i) += p / J_(cell, pt);
       }
 
     }  // end of loop over Gauss points
@@ -61,24 +61,31 @@ HyperelasticDamageModel<EvalT, Traits>::HyperelasticDamageModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-HyperelasticDamageModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+HyperelasticDamageModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad        = *dep_fields["F"];
-  auto J               = *dep_fields["J"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
-  auto delta_time      = *dep_fields["Delta Time"];
+  def_grad_        = *dep_fields["F"];
+  J_               = *dep_fields["J"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
+  delta_time_      = *dep_fields["Delta Time"];
   // extract evaluated MDFields
-  std::string           cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto                  stress = *eval_fields[cauchy];
-  auto                  alpha  = *eval_fields["alpha"];
-  PHX::MDField<ScalarT> damage;
-  if (!have_damage_) { damage = *eval_fields["local damage"]; }
-  PHX::MDField<ScalarT> source = *eval_fields["Damage_Source"];
+  std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
+  stress_            = *eval_fields[cauchy];
+  alpha_             = *eval_fields["alpha"];
+  if (!have_damage_) { local_damage_ = *eval_fields["local damage"]; }
+  source_ = *eval_fields["Damage_Source"];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+HyperelasticDamageModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get state variables
   Albany::MDArray alpha_old = (*workset.stateArrayPtr)["alpha_old"];
   ScalarT         kappa;
@@ -86,7 +93,7 @@ HyperelasticDamageModel<EvalT, Traits>::computeState(
   ScalarT         Jm53, Jm23;
   ScalarT         smag;
   ScalarT         energy;
-  ScalarT         dt = delta_time(0);
+  ScalarT         dt = delta_time_(0);
 
   minitensor::Tensor<ScalarT> F(num_dims_), b(num_dims_), sigma(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
@@ -94,13 +101,14 @@ HyperelasticDamageModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      Jm53 = std::pow(J(cell, pt), -5. / 3.);
-      Jm23 = Jm53 * J(cell, pt);
+      kappa = elastic_modulus_(cell, pt) /
+              (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+      mu   = elastic_modulus_(cell, pt) /
+             (2. * (1. + poissons_ratio_(cell, pt)));
+      Jm53 = std::pow(J_(cell, pt), -5. / 3.);
+      Jm23 = Jm53 * J_(cell, pt);
 
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
 
       // Mechanical deformation gradient
       auto Fm = minitensor::Tensor<ScalarT>(F);
@@ -123,12 +131,12 @@ HyperelasticDamageModel<EvalT, Traits>::computeState(
 
       b     = Fm * transpose(Fm);
       mubar = (1.0 / 3.0) * mu * Jm23 * minitensor::trace(b);
-      sigma = 0.5 * kappa * (J(cell, pt) - 1. / J(cell, pt)) * I +
+      sigma = 0.5 * kappa * (J_(cell, pt) - 1. / J_(cell, pt)) * I +
               mu * Jm53 * minitensor::dev(b);
 
       energy = 0.5 * kappa *
-                   (0.5 * (J(cell, pt) * J(cell, pt) - 1.0) -
-                    std::log(J(cell, pt))) +
+                   (0.5 * (J_(cell, pt) * J_(cell, pt) - 1.0) -
+                    std::log(J_(cell, pt))) +
                0.5 * mu * (Jm23 * minitensor::trace(b) - 3.0);
 
       if (have_temperature_) {
@@ -137,24 +145,25 @@ HyperelasticDamageModel<EvalT, Traits>::computeState(
                       ((delta_temp)-temperature_(cell, pt) *
                        std::log(temperature_(cell, pt) / ref_temperature_)) -
                   3.0 * kappa * expansion_coeff_ *
-                      (J(cell, pt) - 1.0 / J(cell, pt)) * delta_temp;
+                      (J_(cell, pt) - 1.0 / J_(cell, pt)) * delta_temp;
       }
 
-      alpha(cell, pt) = std::max((ScalarT)alpha_old(cell, pt), energy);
+      alpha_(cell, pt) = std::max((ScalarT)alpha_old(cell, pt), energy);
 
-      source(cell, pt) = (max_damage_ / damage_saturation_) *
-                         std::exp(-alpha(cell, pt) / damage_saturation_) *
-                         (alpha(cell, pt) - alpha_old(cell, pt)) / dt;
+      source_(cell, pt) = (max_damage_ / damage_saturation_) *
+                         std::exp(-alpha_(cell, pt) / damage_saturation_) *
+                         (alpha_(cell, pt) - alpha_old(cell, pt)) / dt;
 
       if (!have_damage_) {
-        damage(cell, pt) =
+        local_damage_(cell, pt) =
             max_damage_ *
-            (1.0 - std::exp(-alpha(cell, pt) / damage_saturation_));
+            (1.0 - std::exp(-alpha_(cell, pt) / damage_saturation_));
       }
 
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = (1.0 - damage(cell, pt)) * sigma(i, j);
+          stress_(cell, pt, i, j) =
+              (1.0 - local_damage_(cell, pt)) * sigma(i, j);
         }
       }
     }
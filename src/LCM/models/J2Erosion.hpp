@@ -81,6 +81,9 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   Albany::MDArray Fp_old_;
   Albany::MDArray eqps_old_;
 
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
+
   bool                       have_boundary_indicator_{false};
   Teuchos::ArrayRCP<double*> boundary_indicator_;
 
@@ -100,6 +103,11 @@ struct J2ErosionKernel : public ParallelKernel<EvalT, Traits>
   std::map<std::pair<int, int>, GO> elemWsLIDGIDMap_;
   int ws_index_{0};
 
+  void
+  bindFields(
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
   void
   init(
       Workset&                 workset,
@@ -148,8 +148,7 @@ J2ErosionKernel<EvalT, Traits>::J2ErosionKernel(
 
 template <typename EvalT, typename Traits>
 void
-J2ErosionKernel<EvalT, Traits>::init(
-    Workset&                 workset,
+J2ErosionKernel<EvalT, Traits>::bindFields(
     FieldMap<const ScalarT>& dep_fields,
     FieldMap<ScalarT>&       eval_fields)
 {
@@ -183,9 +182,21 @@ J2ErosionKernel<EvalT, Traits>::init(
     temperature_ = *dep_fields["Temperature"];
   }
 
+  // names of the old state variables
+  Fp_old_string_   = Fp_string + "_old";
+  eqps_old_string_ = eqps_string + "_old";
+}
+
+template <typename EvalT, typename Traits>
+void
+J2ErosionKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<const ScalarT>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
+{
   // get State Variables
-  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Fp_old_   = (*workset.stateArrayPtr)[Fp_old_string_];
+  eqps_old_ = (*workset.stateArrayPtr)[eqps_old_string_];
 
   auto& disc               = *workset.disc;
   auto& stk_disc           = dynamic_cast<Albany::STKDiscretization&>(disc);
@@ -162,22 +162,17 @@ J2FiberModel<EvalT, Traits>::J2FiberModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-J2FiberModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+J2FiberModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  PHX::MDField<const MeshScalarT, Cell, QuadPoint, Dim> gpt_location;
-
-  // for now, force using global fiber direction
-  if (local_coord_flag_) { gpt_location = this->coord_vec_; }
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
 
   // retrive appropriate field name strings
   std::string cauchy_string        = (*field_name_map_)["Cauchy_Stress"];
@@ -191,25 +186,45 @@ J2FiberModel<EvalT, Traits>::computeState(
   std::string f2_damage_string     = (*field_name_map_)["F2_Damage"];
 
   // extract evaluated MDFields
-  auto stress    = *eval_fields[cauchy_string];
-  auto Fp        = *eval_fields[Fp_string];
-  auto eqps      = *eval_fields[eqps_string];
-  auto energy_m  = *eval_fields[matrix_energy_string];
-  auto energy_f1 = *eval_fields[f1_energy_string];
-  auto energy_f2 = *eval_fields[f2_energy_string];
-  auto damage_m  = *eval_fields[matrix_damage_string];
-  auto damage_f1 = *eval_fields[f1_damage_string];
-  auto damage_f2 = *eval_fields[f2_damage_string];
+  stress_    = *eval_fields[cauchy_string];
+  Fp_        = *eval_fields[Fp_string];
+  eqps_      = *eval_fields[eqps_string];
+  energy_m_  = *eval_fields[matrix_energy_string];
+  energy_f1_ = *eval_fields[f1_energy_string];
+  energy_f2_ = *eval_fields[f2_energy_string];
+  damage_m_  = *eval_fields[matrix_damage_string];
+  damage_f1_ = *eval_fields[f1_damage_string];
+  damage_f2_ = *eval_fields[f2_damage_string];
+
+  // names of the old state variables
+  Fp_old_string_        = Fp_string + "_old";
+  eqps_old_string_      = eqps_string + "_old";
+  energy_m_old_string_  = matrix_energy_string + "_old";
+  energy_f1_old_string_ = f1_energy_string + "_old";
+  energy_f2_old_string_ = f2_energy_string + "_old";
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+J2FiberModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  PHX::MDField<const MeshScalarT, Cell, QuadPoint, Dim> gpt_location;
+
+  // for now, force using global fiber direction
+  if (local_coord_flag_) { gpt_location = this->coord_vec_; }
 
   // previous state
-  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fp_old   = (*workset.stateArrayPtr)[Fp_old_string_];
+  Albany::MDArray eqps_old = (*workset.stateArrayPtr)[eqps_old_string_];
   Albany::MDArray energy_m_old =
-      (*workset.stateArrayPtr)[matrix_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_m_old_string_];
   Albany::MDArray energy_f1_old =
-      (*workset.stateArrayPtr)[f1_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f1_old_string_];
   Albany::MDArray energy_f2_old =
-      (*workset.stateArrayPtr)[f2_energy_string + "_old"];
+      (*workset.stateArrayPtr)[energy_f2_old_string_];
 
   ScalarT kappa, mu, mubar, Jm23, K, Y, smag, p;
   ScalarT Phi, dgam;
@@ -237,15 +252,16 @@ J2FiberModel<EvalT, Traits>::computeState(
   for (int cell = 0; cell < workset.numCells; ++cell) {
     for (int pt = 0; pt < num_pts_; ++pt) {
       // local parameters
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      K    = hardening_modulus(cell, pt);
-      Y    = yield_strength(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2. / 3.);
+      kappa = elastic_modulus_(cell, pt) /
+              (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+      mu   = elastic_modulus_(cell, pt) /
+             (2. * (1. + poissons_ratio_(cell, pt)));
+      K    = hardening_modulus_(cell, pt);
+      Y    = yield_strength_(cell, pt);
+      Jm23 = std::pow(J_(cell, pt), -2. / 3.);
 
       // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       // Fpn.fill( &Fpold(cell,pt,int(0),int(0)) );
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
@@ -312,41 +328,41 @@ J2FiberModel<EvalT, Traits>::computeState(
         s = s - 2.0 * mubar * dgam * N;
 
         // update eqps
-        eqps(cell, pt) = alpha;
+        eqps_(cell, pt) = alpha;
 
         // exponential map to get Fp
         expA  = minitensor::exp(dgam * N);
         Fpnew = expA * Fpn;
 
         for (int i(0); i < num_dims_; ++i)
-          for (int j(0); j < num_dims_; ++j) Fp(cell, pt, i, j) = Fpnew(i, j);
+          for (int j(0); j < num_dims_; ++j) Fp_(cell, pt, i, j) = Fpnew(i, j);
 
       } else {
         // elasticity, set state variables to old values
-        eqps(cell, pt) = eqps_old(cell, pt);
+        eqps_(cell, pt) = eqps_old(cell, pt);
         for (int i(0); i < num_dims_; ++i)
-          for (int j(0); j < num_dims_; ++j) Fp(cell, pt, i, j) = Fpn(i, j);
+          for (int j(0); j < num_dims_; ++j) Fp_(cell, pt, i, j) = Fpn(i, j);
 
       }  // end of return mapping
 
       // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
+      p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
 
       // compute Cauchy stress for matrix
-      sigma_m = s / J(cell, pt) + p * I;
+      sigma_m = s / J_(cell, pt) + p * I;
 
       // compute energy for matrix
-      energy_m(cell, pt) =
+      energy_m_(cell, pt) =
           volume_fraction_m_ * (0.5 * kappa *
-                                    (0.5 * (J(cell, pt) * J(cell, pt) - 1.0) -
-                                     std::log(J(cell, pt))) +
+                                    (0.5 * (J_(cell, pt) * J_(cell, pt) - 1.0) -
+                                     std::log(J_(cell, pt))) +
                                 0.5 * mu * (trbe - 3.0));
 
       // damage term in matrix
       alpha_m = energy_m_old(cell, pt);
-      if (energy_m(cell, pt) > alpha_m) alpha_m = energy_m(cell, pt);
+      if (energy_m_(cell, pt) > alpha_m) alpha_m = energy_m_(cell, pt);
 
-      damage_m(cell, pt) =
+      damage_m_(cell, pt) =
           max_damage_m_ * (1.0 - std::exp(-alpha_m / saturation_m_));
 
       //-----------compute stress in Fibers
@@ -393,42 +409,43 @@ J2FiberModel<EvalT, Traits>::computeState(
               M2dyadM2;
 
       // compute energy for fibers
-      energy_f1(cell, pt) =
+      energy_f1_(cell, pt) =
           volume_fraction_f1_ *
           (k_f1_ * (std::exp(q_f1_ * (I4_f1 - 1) * (I4_f1 - 1)) - 1) / q_f1_);
-      energy_f2(cell, pt) =
+      energy_f2_(cell, pt) =
           volume_fraction_f2_ *
           (k_f2_ * (std::exp(q_f2_ * (I4_f2 - 1) * (I4_f2 - 1)) - 1) / q_f2_);
 
       // Fiber Cauchy stress
       sigma_f1 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f1, minitensor::transpose(F)));
       sigma_f2 =
-          (1.0 / J(cell, pt)) *
+          (1.0 / J_(cell, pt)) *
           minitensor::dot(F, minitensor::dot(S0_f2, minitensor::transpose(F)));
 
       // maximum thermodynamic forces
       alpha_f1 = energy_f1_old(cell, pt);
       alpha_f2 = energy_f2_old(cell, pt);
 
-      if (energy_f1(cell, pt) > alpha_f1) alpha_f1 = energy_f1(cell, pt);
+      if (energy_f1_(cell, pt) > alpha_f1) alpha_f1 = energy_f1_(cell, pt);
 
-      if (energy_f2(cell, pt) > alpha_f2) alpha_f2 = energy_f2(cell, pt);
+      if (energy_f2_(cell, pt) > alpha_f2) alpha_f2 = energy_f2_(cell, pt);
 
       // damage term in fibers
-      damage_f1(cell, pt) =
+      damage_f1_(cell, pt) =
           max_damage_f1_ * (1 - std::exp(-alpha_f1 / saturation_f1_));
-      damage_f2(cell, pt) =
+      damage_f2_(cell, pt) =
           max_damage_f1_ * (1 - std::exp(-alpha_f2 / saturation_f2_));
 
       // total Cauchy stress (M, Fibers)
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) =
-              volume_fraction_m_ * (1 - damage_m(cell, pt)) * sigma_m(i, j) +
-              volume_fraction_f1_ * (1 - damage_f1(cell, pt)) * sigma_f1(i, j) +
-              volume_fraction_f2_ * (1 - damage_f2(cell, pt)) * sigma_f2(i, j);
+          stress_(cell, pt, i, j) =
+              volume_fraction_m_ * (1 - damage_m_(cell, pt)) * sigma_m(i, j) +
+              volume_fraction_f1_ * (1 - damage_f1_(cell, pt)) *
+                  sigma_f1(i, j) +
+              volume_fraction_f2_ * (1 - damage_f2_(cell, pt)) * sigma_f2(i, j);
         }
       }
     }
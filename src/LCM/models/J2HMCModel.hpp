@@ -49,27 +49,30 @@ class J2HMCModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~J2HMCModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   // Kokkos
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   void
   computeVolumeAverage(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
  private:
   ///
@@ -232,6 +235,23 @@ class J2HMCModel : public LCM::ConstitutiveModel<EvalT, Traits>
   std::vector<std::string> current_doubleBackStressName;
   std::vector<std::string> updated_doubleBackStressName;
 
+  ///
+  /// BOUND FIELDS
+  ///
+  PHX::MDField<const ScalarT>              delta_macroStrain_;
+  std::vector<PHX::MDField<const ScalarT>> delta_strainDifference_;
+  std::vector<PHX::MDField<const ScalarT>> delta_microStrainGradient_;
+
+  PHX::MDField<ScalarT>              updated_macroStress_;
+  PHX::MDField<ScalarT>              updated_macroBackStress_;
+  PHX::MDField<ScalarT>              updated_macroAlpha_;
+  std::vector<PHX::MDField<ScalarT>> updated_microStress_;
+  std::vector<PHX::MDField<ScalarT>> updated_microBackStress_;
+  std::vector<PHX::MDField<ScalarT>> updated_microAlpha_;
+  std::vector<PHX::MDField<ScalarT>> updated_doubleStress_;
+  std::vector<PHX::MDField<ScalarT>> updated_doubleBackStress_;
+  std::vector<PHX::MDField<ScalarT>> updated_doubleAlpha_;
+
   typedef PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim>      HMC2Tensor;
   typedef PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim, Dim> HMC3Tensor;
 };
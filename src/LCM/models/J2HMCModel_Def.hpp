@@ -224,69 +224,74 @@ J2HMCModel<EvalT, Traits>::J2HMCModel(
 /******************************************************************************/
 template <typename EvalT, typename Traits>
 void
-J2HMCModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+J2HMCModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 /******************************************************************************/
 {
   // extract increments
-  std::vector<PHX::MDField<const ScalarT>> delta_strainDifference(
-      numMicroScales);
-  std::vector<PHX::MDField<const ScalarT>> delta_microStrainGradient(
-      numMicroScales);
-  auto delta_macroStrain = *dep_fields[delta_macroStrainName];
+  delta_strainDifference_.resize(numMicroScales);
+  delta_microStrainGradient_.resize(numMicroScales);
+  delta_macroStrain_ = *dep_fields[delta_macroStrainName];
   for (int i = 0; i < numMicroScales; i++) {
-    delta_strainDifference[i] = *dep_fields[delta_strainDifferenceName[i]];
-    delta_microStrainGradient[i] =
+    delta_strainDifference_[i] = *dep_fields[delta_strainDifferenceName[i]];
+    delta_microStrainGradient_[i] =
         *dep_fields[delta_microStrainGradientName[i]];
   }
 
   // extract states to be updated (i.e., state at N+1):
-  auto updated_macroStress = *eval_fields[updated_macroStressName];
-  std::vector<PHX::MDField<ScalarT>> updated_microStress(numMicroScales);
-  std::vector<PHX::MDField<ScalarT>> updated_doubleStress(numMicroScales);
+  updated_macroStress_ = *eval_fields[updated_macroStressName];
+  updated_microStress_.resize(numMicroScales);
+  updated_doubleStress_.resize(numMicroScales);
   for (int i = 0; i < numMicroScales; i++) {
-    updated_microStress[i]  = *eval_fields[updated_microStressName[i]];
-    updated_doubleStress[i] = *eval_fields[updated_doubleStressName[i]];
+    updated_microStress_[i]  = *eval_fields[updated_microStressName[i]];
+    updated_doubleStress_[i] = *eval_fields[updated_doubleStressName[i]];
   }
 
-  computeTrialState(
-      workset,
-      delta_macroStrain,
-      delta_strainDifference,
-      delta_microStrainGradient,
-      updated_macroStress,
-      updated_microStress,
-      updated_doubleStress);
-
-  // extract states to be updated (i.e., state at N+1):
-  PHX::MDField<ScalarT> updated_macroBackStress =
-      *eval_fields[updated_macroBackStressName];
-  PHX::MDField<ScalarT> updated_macroAlpha =
-      *eval_fields[updated_macroAlphaName];
-  std::vector<PHX::MDField<ScalarT>> updated_microBackStress(numMicroScales);
-  std::vector<PHX::MDField<ScalarT>> updated_doubleBackStress(numMicroScales);
-  std::vector<PHX::MDField<ScalarT>> updated_microAlpha(numMicroScales);
-  std::vector<PHX::MDField<ScalarT>> updated_doubleAlpha(numMicroScales);
+  updated_macroBackStress_ = *eval_fields[updated_macroBackStressName];
+  updated_macroAlpha_      = *eval_fields[updated_macroAlphaName];
+  updated_microBackStress_.resize(numMicroScales);
+  updated_doubleBackStress_.resize(numMicroScales);
+  updated_microAlpha_.resize(numMicroScales);
+  updated_doubleAlpha_.resize(numMicroScales);
   for (int i = 0; i < numMicroScales; i++) {
-    updated_microBackStress[i]  = *eval_fields[updated_microBackStressName[i]];
-    updated_doubleBackStress[i] = *eval_fields[updated_doubleBackStressName[i]];
-    updated_microAlpha[i]       = *eval_fields[updated_microAlphaName[i]];
-    updated_doubleAlpha[i]      = *eval_fields[updated_doubleAlphaName[i]];
+    updated_microBackStress_[i] = *eval_fields[updated_microBackStressName[i]];
+    updated_doubleBackStress_[i] =
+        *eval_fields[updated_doubleBackStressName[i]];
+    updated_microAlpha_[i]  = *eval_fields[updated_microAlphaName[i]];
+    updated_doubleAlpha_[i] = *eval_fields[updated_doubleAlphaName[i]];
   }
+}
+
+/******************************************************************************/
+template <typename EvalT, typename Traits>
+void
+J2HMCModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+/******************************************************************************/
+{
+  computeTrialState(
+      workset,
+      delta_macroStrain_,
+      delta_strainDifference_,
+      delta_microStrainGradient_,
+      updated_macroStress_,
+      updated_microStress_,
+      updated_doubleStress_);
 
   radialReturn(
       workset,
-      updated_macroStress,
-      updated_macroBackStress,
-      updated_macroAlpha,
-      updated_microStress,
-      updated_microBackStress,
-      updated_microAlpha,
-      updated_doubleStress,
-      updated_doubleBackStress,
-      updated_doubleAlpha);
+      updated_macroStress_,
+      updated_macroBackStress_,
+      updated_macroAlpha_,
+      updated_microStress_,
+      updated_microBackStress_,
+      updated_microAlpha_,
+      updated_doubleStress_,
+      updated_doubleBackStress_,
+      updated_doubleAlpha_);
 }
 
 /******************************************************************************/
@@ -294,8 +299,8 @@ template <typename EvalT, typename Traits>
 void
 J2HMCModel<EvalT, Traits>::computeStateParallel(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 /******************************************************************************/
 {
   TEUCHOS_TEST_FOR_EXCEPTION(
@@ -1169,8 +1174,8 @@ template <typename EvalT, typename Traits>
 void
 J2HMCModel<EvalT, Traits>::computeVolumeAverage(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 /******************************************************************************/
 {
   minitensor::Tensor<ScalarT> sig(num_dims_);
@@ -78,10 +78,18 @@ struct J2MiniKernel : public ParallelKernel<EvalT, Traits>
   Albany::MDArray Fp_old_;
   Albany::MDArray eqps_old_;
 
+  std::string Fp_old_string_;
+  std::string eqps_old_string_;
+
   // Saturation hardening constraints
   RealType sat_mod_;
   RealType sat_exp_;
 
+  void
+  bindFields(
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
+
   void
   init(
       Workset&                 workset,
@@ -106,8 +106,7 @@ J2MiniKernel<EvalT, Traits>::J2MiniKernel(
 
 template <typename EvalT, typename Traits>
 void
-J2MiniKernel<EvalT, Traits>::init(
-    Workset&                 workset,
+J2MiniKernel<EvalT, Traits>::bindFields(
     FieldMap<const ScalarT>& dep_fields,
     FieldMap<ScalarT>&       eval_fields)
 {
@@ -139,9 +138,21 @@ J2MiniKernel<EvalT, Traits>::init(
     temperature_ = *dep_fields["Temperature"];
   }
 
+  // names of the old state variables
+  Fp_old_string_   = Fp_string + "_old";
+  eqps_old_string_ = eqps_string + "_old";
+}
+
+template <typename EvalT, typename Traits>
+void
+J2MiniKernel<EvalT, Traits>::init(
+    Workset&                 workset,
+    FieldMap<const ScalarT>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
+{
   // get State Variables
-  Fp_old_   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  eqps_old_ = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Fp_old_   = (*workset.stateArrayPtr)[Fp_old_string_];
+  eqps_old_ = (*workset.stateArrayPtr)[eqps_old_string_];
 }
 
 namespace {
@@ -105,10 +105,9 @@ J2Model<EvalT, Traits>::J2Model(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-J2Model<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+J2Model<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
   std::string Fp_string           = (*field_name_map_)["Fp"];
@@ -119,25 +118,37 @@ J2Model<EvalT, Traits>::computeState(
   std::string J_string            = (*field_name_map_)["J"];
 
   // extract dependent MDFields
-  auto def_grad          = *dep_fields[F_string];
-  auto J                 = *dep_fields[J_string];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto delta_time        = *dep_fields["Delta Time"];
+  def_grad_          = *dep_fields[F_string];
+  J_                 = *dep_fields[J_string];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  delta_time_        = *dep_fields["Delta Time"];
 
   // extract evaluated MDFields
-  auto                  stress    = *eval_fields[cauchy_string];
-  auto                  Fp        = *eval_fields[Fp_string];
-  auto                  eqps      = *eval_fields[eqps_string];
-  auto                  yieldSurf = *eval_fields[yieldSurface_string];
-  PHX::MDField<ScalarT> source;
-  if (have_temperature_) { source = *eval_fields[source_string]; }
+  stress_     = *eval_fields[cauchy_string];
+  Fp_         = *eval_fields[Fp_string];
+  eqps_       = *eval_fields[eqps_string];
+  yield_surf_ = *eval_fields[yieldSurface_string];
+  if (have_temperature_) { source_ = *eval_fields[source_string]; }
+
+  // names of the old state variables
+  Fp_old_string_   = Fp_string + "_old";
+  eqps_old_string_ = eqps_string + "_old";
+}
 
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+J2Model<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_string + "_old"];
-  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray Fpold   = (*workset.stateArrayPtr)[Fp_old_string_];
+  Albany::MDArray eqpsold = (*workset.stateArrayPtr)[eqps_old_string_];
 
   ScalarT kappa, mu, mubar, K, Y;
   ScalarT Jm23, trace, smag2, smag, f, p, dgam;
@@ -153,14 +164,15 @@ J2Model<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      kappa = elastic_modulus(cell, pt) /
-              (3. * (1. - 2. * poissons_ratio(cell, pt)));
-      mu   = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      K    = hardening_modulus(cell, pt);
-      Y    = yield_strength(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2. / 3.);
+      kappa = elastic_modulus_(cell, pt) /
+              (3. * (1. - 2. * poissons_ratio_(cell, pt)));
+      mu =
+          elastic_modulus_(cell, pt) / (2. * (1. + poissons_ratio_(cell, pt)));
+      K    = hardening_modulus_(cell, pt);
+      Y    = yield_strength_(cell, pt);
+      Jm23 = std::pow(J_(cell, pt), -2. / 3.);
       // fill local tensors
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
 
       // Mechanical deformation gradient
       auto Fm = minitensor::Tensor<ScalarT>(F);
@@ -260,13 +272,13 @@ J2Model<EvalT, Traits>::computeState(
         s -= 2 * mubar * dgam * N;
 
         // update eqps
-        eqps(cell, pt) = alpha;
+        eqps_(cell, pt) = alpha;
 
         // mechanical source
-        if (have_temperature_ && delta_time(0) > 0) {
-          source(cell, pt) =
-              (sq23 * dgam / delta_time(0) * (Y + H + temperature_(cell, pt))) /
-              (density_ * heat_capacity_);
+        if (have_temperature_ && delta_time_(0) > 0) {
+          source_(cell, pt) = (sq23 * dgam / delta_time_(0) *
+                               (Y + H + temperature_(cell, pt))) /
+                              (density_ * heat_capacity_);
         }
 
         // exponential map to get Fpnew
@@ -275,30 +287,32 @@ J2Model<EvalT, Traits>::computeState(
         Fpnew = expA * Fpn;
         for (int i(0); i < num_dims_; ++i) {
           for (int j(0); j < num_dims_; ++j) {
-            Fp(cell, pt, i, j) = Fpnew(i, j);
+            Fp_(cell, pt, i, j) = Fpnew(i, j);
           }
         }
       } else {
-        eqps(cell, pt) = eqpsold(cell, pt);
-        if (have_temperature_) source(cell, pt) = 0.0;
+        eqps_(cell, pt) = eqpsold(cell, pt);
+        if (have_temperature_) source_(cell, pt) = 0.0;
         for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) { Fp(cell, pt, i, j) = Fpn(i, j); }
+          for (int j(0); j < num_dims_; ++j) {
+            Fp_(cell, pt, i, j) = Fpn(i, j);
+          }
         }
       }
 
       // update yield surface
-      yieldSurf(cell, pt) =
-          Y + K * eqps(cell, pt) +
-          sat_mod_ * (1. - std::exp(-sat_exp_ * eqps(cell, pt)));
+      yield_surf_(cell, pt) =
+          Y + K * eqps_(cell, pt) +
+          sat_mod_ * (1. - std::exp(-sat_exp_ * eqps_(cell, pt)));
 
       // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1. / (J(cell, pt)));
+      p = 0.5 * kappa * (J_(cell, pt) - 1. / (J_(cell, pt)));
 
       // compute stress
-      sigma = p * I + s / J(cell, pt);
+      sigma = p * I + s / J_(cell, pt);
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
     }
@@ -310,8 +324,8 @@ template <typename EvalT, typename Traits>
 void
 J2Model<EvalT, Traits>::computeStateParallel(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 {
   return;
 }
@@ -54,20 +54,23 @@ class LinearElasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~LinearElasticModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -83,6 +86,14 @@ class LinearElasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   LinearElasticModel&
   operator=(const LinearElasticModel&);
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
 };
 }  // namespace LCM
 
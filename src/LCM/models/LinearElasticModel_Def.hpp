@@ -38,24 +38,32 @@ LinearElasticModel<EvalT, Traits>::LinearElasticModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
+LinearElasticModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
+{
+  // extract dependent MDFields
+  strain_          = *dep_fields["Strain"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
+  // extract evaluated MDFields
+  std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
+  stress_            = *eval_fields[cauchy];
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
 LinearElasticModel<EvalT, Traits>::computeState(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 {
   bool print = false;
   // if (typeid(ScalarT) == typeid(RealType)) print = true;
   // std::cout.precision(15);
 
-  // extract dependent MDFields
-  auto strain          = *dep_fields["Strain"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
-  // extract evaluated MDFields
-  std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto        stress = *eval_fields[cauchy];
-  ScalarT     lambda;
-  ScalarT     mu;
+  ScalarT lambda;
+  ScalarT mu;
 
   minitensor::Tensor<ScalarT> eps(num_dims_), sigma(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
@@ -64,18 +72,18 @@ LinearElasticModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      lambda =
-          (elastic_modulus(cell, pt) * poissons_ratio(cell, pt)) /
-          ((1 + poissons_ratio(cell, pt)) * (1 - 2 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2 * (1 + poissons_ratio(cell, pt)));
+      lambda = (elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt)) /
+               ((1 + poissons_ratio_(cell, pt)) *
+                (1 - 2 * poissons_ratio_(cell, pt)));
+      mu = elastic_modulus_(cell, pt) / (2 * (1 + poissons_ratio_(cell, pt)));
 
-      eps.fill(strain, cell, pt, 0, 0);
+      eps.fill(strain_, cell, pt, 0, 0);
 
       sigma = 2.0 * mu * eps + lambda * minitensor::trace(eps) * I;
 
       if (print) {
-        std::cout << "E      : " << elastic_modulus(cell, pt) << std::endl;
-        std::cout << "nu     : " << poissons_ratio(cell, pt) << std::endl;
+        std::cout << "E      : " << elastic_modulus_(cell, pt) << std::endl;
+        std::cout << "nu     : " << poissons_ratio_(cell, pt) << std::endl;
         std::cout << "lambda : " << lambda << std::endl;
         std::cout << "mu     : " << mu << std::endl;
         std::cout << "eps    :\n" << eps << std::endl;
@@ -84,7 +92,7 @@ LinearElasticModel<EvalT, Traits>::computeState(
 
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
     }
@@ -94,9 +102,9 @@ LinearElasticModel<EvalT, Traits>::computeState(
   if (have_temperature_) {
     for (int cell(0); cell < workset.numCells; ++cell) {
       for (int pt(0); pt < num_pts_; ++pt) {
-        sigma.fill(stress, cell, pt, 0, 0);
-        ScalarT three_kappa =
-            elastic_modulus(cell, pt) / (1.0 - 2.0 * poissons_ratio(cell, pt));
+        sigma.fill(stress_, cell, pt, 0, 0);
+        ScalarT three_kappa = elastic_modulus_(cell, pt) /
+                              (1.0 - 2.0 * poissons_ratio_(cell, pt));
         sigma -= three_kappa * expansion_coeff_ *
                  (temperature_(cell, pt) - ref_temperature_) * I;
 
@@ -111,7 +119,7 @@ LinearElasticModel<EvalT, Traits>::computeState(
 
         for (int i = 0; i < num_dims_; ++i) {
           for (int j = 0; j < num_dims_; ++j) {
-            stress(cell, pt, i, j) = sigma(i, j);
+            stress_(cell, pt, i, j) = sigma(i, j);
           }
         }
       }
@@ -48,20 +48,23 @@ class LinearElasticVolDevModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~LinearElasticVolDevModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -74,6 +77,12 @@ class LinearElasticVolDevModel : public LCM::ConstitutiveModel<EvalT, Traits>
  private:
   RealType bulk_modulus_{0.0};
   RealType shear_modulus_{0.0};
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
 };
 }  // namespace LCM
 
@@ -40,6 +40,23 @@ LinearElasticVolDevModel<EvalT, Traits>::LinearElasticVolDevModel(
   this->state_var_output_flags_.push_back(true);
 }
 
+//
+//
+//
+template <typename EvalT, typename Traits>
+void
+LinearElasticVolDevModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
+{
+  // extract dependent MDFields
+  strain_ = *dep_fields["Strain"];
+
+  // extract evaluated MDFields
+  std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
+  stress_            = *eval_fields[cauchy];
+}
+
 //
 //
 //
@@ -47,26 +64,19 @@ template <typename EvalT, typename Traits>
 void
 LinearElasticVolDevModel<EvalT, Traits>::computeState(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 {
   // constants
   auto const kappa = bulk_modulus_;
   auto const mu    = shear_modulus_;
 
-  // extract dependent MDFields
-  auto strain = *dep_fields["Strain"];
-
-  // extract evaluated MDFields
-  std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto        stress = *eval_fields[cauchy];
-
   minitensor::Tensor<ScalarT> eps(num_dims_), sigma(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      eps.fill(strain, cell, pt, 0, 0);
+      eps.fill(strain_, cell, pt, 0, 0);
 
       auto const sigma_vol = num_dims_ * kappa * minitensor::vol(eps);
       auto const sigma_dev = 2.0 * mu * minitensor::dev(eps);
@@ -75,7 +85,7 @@ LinearElasticVolDevModel<EvalT, Traits>::computeState(
 
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
     }
@@ -44,20 +44,23 @@ class LinearHMCModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~LinearHMCModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -100,6 +103,17 @@ class LinearHMCModel : public LCM::ConstitutiveModel<EvalT, Traits>
   std::vector<std::string> microStressName;
   std::vector<std::string> doubleStressName;
 
+  ///
+  /// BOUND FIELDS
+  ///
+  PHX::MDField<const ScalarT>              macroStrain_;
+  std::vector<PHX::MDField<const ScalarT>> strainDifference_;
+  std::vector<PHX::MDField<const ScalarT>> microStrainGradient_;
+
+  PHX::MDField<ScalarT>              macroStress_;
+  std::vector<PHX::MDField<ScalarT>> microStress_;
+  std::vector<PHX::MDField<ScalarT>> doubleStress_;
+
   typedef PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim>      HMC2Tensor;
   typedef PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim, Dim> HMC3Tensor;
 };
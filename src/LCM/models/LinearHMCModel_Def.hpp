@@ -79,53 +79,60 @@ LinearHMCModel<EvalT, Traits>::LinearHMCModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-LinearHMCModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+LinearHMCModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract independent MDFields
-  auto macroStrain = *dep_fields[macroStrainName];
-  std::vector<PHX::MDField<const ScalarT>> strainDifference(numMicroScales);
-  std::vector<PHX::MDField<const ScalarT>> microStrainGradient(numMicroScales);
+  macroStrain_ = *dep_fields[macroStrainName];
+  strainDifference_.resize(numMicroScales);
+  microStrainGradient_.resize(numMicroScales);
   for (int i = 0; i < numMicroScales; i++) {
-    strainDifference[i]    = *dep_fields[strainDifferenceName[i]];
-    microStrainGradient[i] = *dep_fields[microStrainGradientName[i]];
+    strainDifference_[i]    = *dep_fields[strainDifferenceName[i]];
+    microStrainGradient_[i] = *dep_fields[microStrainGradientName[i]];
   }
 
   // extract evaluated MDFields
-  auto macroStress = *eval_fields[macroStressName];
-  std::vector<PHX::MDField<ScalarT>> microStress(numMicroScales);
-  std::vector<PHX::MDField<ScalarT>> doubleStress(numMicroScales);
+  macroStress_ = *eval_fields[macroStressName];
+  microStress_.resize(numMicroScales);
+  doubleStress_.resize(numMicroScales);
   for (int i = 0; i < numMicroScales; i++) {
-    microStress[i]  = *eval_fields[microStressName[i]];
-    doubleStress[i] = *eval_fields[doubleStressName[i]];
+    microStress_[i]  = *eval_fields[microStressName[i]];
+    doubleStress_[i] = *eval_fields[doubleStressName[i]];
   }
-
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+LinearHMCModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   switch (num_dims_) {
     case 1:
       // Compute Stress (uniaxial strain)
       for (std::size_t cell = 0; cell < workset.numCells; ++cell)
         for (std::size_t qp = 0; qp < num_pts_; ++qp)
-          macroStress(cell, qp, 0, 0) = C11 * macroStrain(cell, qp, 0, 0);
+          macroStress_(cell, qp, 0, 0) = C11 * macroStrain_(cell, qp, 0, 0);
       break;
     case 2:
       // Compute Stress (plane strain)
       for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
         for (std::size_t qp = 0; qp < num_pts_; ++qp) {
-          auto e1                     = macroStrain(cell, qp, 0, 0);
-          auto e2                     = macroStrain(cell, qp, 1, 1);
-          auto e3                     = macroStrain(cell, qp, 0, 1);
-          macroStress(cell, qp, 0, 0) = C11 * e1 + C12 * e2;
-          macroStress(cell, qp, 1, 1) = C12 * e1 + C11 * e2;
-          macroStress(cell, qp, 0, 1) = C44 * e3;
-          macroStress(cell, qp, 1, 0) = macroStress(cell, qp, 0, 1);
+          auto e1                      = macroStrain_(cell, qp, 0, 0);
+          auto e2                      = macroStrain_(cell, qp, 1, 1);
+          auto e3                      = macroStrain_(cell, qp, 0, 1);
+          macroStress_(cell, qp, 0, 0) = C11 * e1 + C12 * e2;
+          macroStress_(cell, qp, 1, 1) = C12 * e1 + C11 * e2;
+          macroStress_(cell, qp, 0, 1) = C44 * e3;
+          macroStress_(cell, qp, 1, 0) = macroStress_(cell, qp, 0, 1);
         }
       }
       // Compute Micro Stress
       for (int i = 0; i < numMicroScales; i++) {
-        auto&   sd   = strainDifference[i];
-        auto&   ms   = microStress[i];
+        auto&   sd   = strainDifference_[i];
+        auto&   ms   = microStress_[i];
         ScalarT beta = betaParameter[i];
         for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
           for (std::size_t qp = 0; qp < num_pts_; ++qp) {
@@ -140,8 +147,8 @@ LinearHMCModel<EvalT, Traits>::computeState(
       }
       // Compute Double Stress
       for (int i = 0; i < numMicroScales; i++) {
-        auto&   msg  = microStrainGradient[i];
-        auto&   ds   = doubleStress[i];
+        auto&   msg  = microStrainGradient_[i];
+        auto&   ds   = doubleStress_[i];
         ScalarT beta = lengthScale[i] * lengthScale[i] * betaParameter[i];
         for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
           for (std::size_t qp = 0; qp < num_pts_; ++qp) {
@@ -163,27 +170,27 @@ LinearHMCModel<EvalT, Traits>::computeState(
       // Compute Stress
       for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
         for (std::size_t qp = 0; qp < num_pts_; ++qp) {
-          auto e1                     = macroStrain(cell, qp, 0, 0);
-          auto e2                     = macroStrain(cell, qp, 1, 1);
-          auto e3                     = macroStrain(cell, qp, 2, 2);
-          auto e4                     = macroStrain(cell, qp, 1, 2);
-          auto e5                     = macroStrain(cell, qp, 0, 2);
-          auto e6                     = macroStrain(cell, qp, 0, 1);
-          macroStress(cell, qp, 0, 0) = C11 * e1 + C12 * e2 + C23 * e3;
-          macroStress(cell, qp, 1, 1) = C12 * e1 + C11 * e2 + C23 * e3;
-          macroStress(cell, qp, 2, 2) = C23 * e1 + C23 * e2 + C33 * e3;
-          macroStress(cell, qp, 1, 2) = C44 * e4;
-          macroStress(cell, qp, 0, 2) = C44 * e5;
-          macroStress(cell, qp, 0, 1) = C66 * e6;
-          macroStress(cell, qp, 1, 0) = macroStress(cell, qp, 0, 1);
-          macroStress(cell, qp, 2, 0) = macroStress(cell, qp, 0, 2);
-          macroStress(cell, qp, 2, 1) = macroStress(cell, qp, 1, 2);
+          auto e1                      = macroStrain_(cell, qp, 0, 0);
+          auto e2                      = macroStrain_(cell, qp, 1, 1);
+          auto e3                      = macroStrain_(cell, qp, 2, 2);
+          auto e4                      = macroStrain_(cell, qp, 1, 2);
+          auto e5                      = macroStrain_(cell, qp, 0, 2);
+          auto e6                      = macroStrain_(cell, qp, 0, 1);
+          macroStress_(cell, qp, 0, 0) = C11 * e1 + C12 * e2 + C23 * e3;
+          macroStress_(cell, qp, 1, 1) = C12 * e1 + C11 * e2 + C23 * e3;
+          macroStress_(cell, qp, 2, 2) = C23 * e1 + C23 * e2 + C33 * e3;
+          macroStress_(cell, qp, 1, 2) = C44 * e4;
+          macroStress_(cell, qp, 0, 2) = C44 * e5;
+          macroStress_(cell, qp, 0, 1) = C66 * e6;
+          macroStress_(cell, qp, 1, 0) = macroStress_(cell, qp, 0, 1);
+          macroStress_(cell, qp, 2, 0) = macroStress_(cell, qp, 0, 2);
+          macroStress_(cell, qp, 2, 1) = macroStress_(cell, qp, 1, 2);
         }
       }
       // Compute Micro Stress
       for (int i = 0; i < numMicroScales; i++) {
-        auto&   sd   = strainDifference[i];
-        auto&   ms   = microStress[i];
+        auto&   sd   = strainDifference_[i];
+        auto&   ms   = microStress_[i];
         ScalarT beta = betaParameter[i];
         for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
           for (std::size_t qp = 0; qp < num_pts_; ++qp) {
@@ -210,8 +217,8 @@ LinearHMCModel<EvalT, Traits>::computeState(
       }
       // Compute Double Stress
       for (int i = 0; i < numMicroScales; i++) {
-        auto&   msg  = microStrainGradient[i];
-        auto&   ds   = doubleStress[i];
+        auto&   msg  = microStrainGradient_[i];
+        auto&   ds   = doubleStress_[i];
         ScalarT beta = lengthScale[i] * lengthScale[i] * betaParameter[i];
         for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
           for (std::size_t qp = 0; qp < num_pts_; ++qp) {
@@ -49,21 +49,24 @@ class LinearPiezoModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~LinearPiezoModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   // Kokkos
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
  private:
   ///
@@ -107,6 +110,14 @@ class LinearPiezoModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   std::string stressName;
   std::string edispName;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> strain_;
+  PHX::MDField<const ScalarT> gradp_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> edisp_;
 };
 }  // namespace LCM
 
@@ -133,18 +133,27 @@ LinearPiezoModel<EvalT, Traits>::LinearPiezoModel(
 /******************************************************************************/
 template <typename EvalT, typename Traits>
 void
-LinearPiezoModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+LinearPiezoModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 /******************************************************************************/
 {
-  auto strain = *dep_fields[strainName];
-  auto Gradp  = *dep_fields[efieldName];
+  strain_ = *dep_fields[strainName];
+  gradp_  = *dep_fields[efieldName];
 
-  auto stress = *eval_fields[stressName];
-  auto edisp  = *eval_fields[edispName];
+  stress_ = *eval_fields[stressName];
+  edisp_  = *eval_fields[edispName];
+}
 
+/******************************************************************************/
+template <typename EvalT, typename Traits>
+void
+LinearPiezoModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+/******************************************************************************/
+{
   int numCells = workset.numCells;
 
   if (num_dims_ == 1) {
@@ -156,40 +165,40 @@ LinearPiezoModel<EvalT, Traits>::computeState(
     for (int cell = 0; cell < numCells; ++cell) {
       for (int qp = 0; qp < num_pts_; ++qp) {
         if (test) {
-          const ScalarT &x1 = strain(cell, qp, 0, 0),
-                        &x2 = strain(cell, qp, 1, 1),
-                        &x3 = strain(cell, qp, 2, 2),
-                        &x4 = strain(cell, qp, 1, 2),
-                        &x5 = strain(cell, qp, 0, 2),
-                        &x6 = strain(cell, qp, 0, 1);
-          const ScalarT &E1 = -Gradp(cell, qp, 0), &E2 = -Gradp(cell, qp, 1),
-                        &E3 = -Gradp(cell, qp, 2);
+          const ScalarT &x1 = strain_(cell, qp, 0, 0),
+                        &x2 = strain_(cell, qp, 1, 1),
+                        &x3 = strain_(cell, qp, 2, 2),
+                        &x4 = strain_(cell, qp, 1, 2),
+                        &x5 = strain_(cell, qp, 0, 2),
+                        &x6 = strain_(cell, qp, 0, 1);
+          const ScalarT &E1 = -gradp_(cell, qp, 0), &E2 = -gradp_(cell, qp, 1),
+                        &E3 = -gradp_(cell, qp, 2);
 
-          stress(cell, qp, 0, 0) = C11 * x1 + C12 * x2 + C23 * x3 - e31 * E3;
-          stress(cell, qp, 1, 1) = C12 * x1 + C11 * x2 + C23 * x3 - e31 * E3;
-          stress(cell, qp, 2, 2) = C23 * x1 + C23 * x2 + C33 * x3 - e33 * E3;
-          stress(cell, qp, 1, 2) = C44 * x4 - e15 * E2;
-          stress(cell, qp, 0, 2) = C44 * x5 - e15 * E1;
-          stress(cell, qp, 0, 1) = C66 * x6;
-          stress(cell, qp, 1, 0) = stress(cell, qp, 0, 1);
-          stress(cell, qp, 2, 0) = stress(cell, qp, 0, 2);
-          stress(cell, qp, 2, 1) = stress(cell, qp, 1, 2);
+          stress_(cell, qp, 0, 0) = C11 * x1 + C12 * x2 + C23 * x3 - e31 * E3;
+          stress_(cell, qp, 1, 1) = C12 * x1 + C11 * x2 + C23 * x3 - e31 * E3;
+          stress_(cell, qp, 2, 2) = C23 * x1 + C23 * x2 + C33 * x3 - e33 * E3;
+          stress_(cell, qp, 1, 2) = C44 * x4 - e15 * E2;
+          stress_(cell, qp, 0, 2) = C44 * x5 - e15 * E1;
+          stress_(cell, qp, 0, 1) = C66 * x6;
+          stress_(cell, qp, 1, 0) = stress_(cell, qp, 0, 1);
+          stress_(cell, qp, 2, 0) = stress_(cell, qp, 0, 2);
+          stress_(cell, qp, 2, 1) = stress_(cell, qp, 1, 2);
 
-          edisp(cell, qp, 0) = e15 * x5 + E11 * E1;
-          edisp(cell, qp, 1) = e15 * x4 + E11 * E2;
-          edisp(cell, qp, 2) = e31 * x1 + e31 * x2 + e33 * x3 + E33 * E3;
+          edisp_(cell, qp, 0) = e15 * x5 + E11 * E1;
+          edisp_(cell, qp, 1) = e15 * x4 + E11 * E2;
+          edisp_(cell, qp, 2) = e31 * x1 + e31 * x2 + e33 * x3 + E33 * E3;
 
         } else {
-          x.fill(strain, cell, qp, 0, 0);
-          E.fill(Gradp, cell, qp, 0);
+          x.fill(strain_, cell, qp, 0, 0);
+          E.fill(gradp_, cell, qp, 0);
           E *= -1.0;
 
           X = dotdot(C, x) - dot(E, e);
           D = dotdot(e, x) + dot(eps, E);
 
           for (int i = 0; i < 3; i++)
-            for (int j = 0; j < 3; j++) stress(cell, qp, i, j) = X(i, j);
-          for (int i = 0; i < 3; i++) edisp(cell, qp, i) = D(i);
+            for (int j = 0; j < 3; j++) stress_(cell, qp, i, j) = X(i, j);
+          for (int i = 0; i < 3; i++) edisp_(cell, qp, i) = D(i);
         }
       }
     }
@@ -201,8 +210,8 @@ template <typename EvalT, typename Traits>
 void
 LinearPiezoModel<EvalT, Traits>::computeStateParallel(
     typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
 /******************************************************************************/
 {
   TEUCHOS_TEST_FOR_EXCEPTION(
@@ -44,20 +44,23 @@ class MooneyRivlinModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~MooneyRivlinModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -78,6 +81,13 @@ class MooneyRivlinModel : public LCM::ConstitutiveModel<EvalT, Traits>
   /// Elastic constants
   ///
   RealType c1_, c2_, c_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
 };
 }  // namespace LCM
 
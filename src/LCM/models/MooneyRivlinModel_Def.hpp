@@ -40,18 +40,25 @@ MooneyRivlinModel<EvalT, Traits>::MooneyRivlinModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-MooneyRivlinModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+MooneyRivlinModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto defGrad = *dep_fields["F"];
-  auto J       = *dep_fields["J"];
+  def_grad_ = *dep_fields["F"];
+  J_        = *dep_fields["J"];
   // extract evaluated MDFields
   std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto        stress = *eval_fields[cauchy];
-
+  stress_            = *eval_fields[cauchy];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+MooneyRivlinModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   minitensor::Tensor<ScalarT> F(num_dims_), C(num_dims_);
   minitensor::Tensor<ScalarT> S(num_dims_), sigma(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
@@ -60,15 +67,16 @@ MooneyRivlinModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      F.fill(defGrad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       C = transpose(F) * F;
       S = 2.0 * (c1_ + c2_ * minitensor::I1(C)) * I - 2.0 * c2_ * C +
-          (2.0 * c_ * J(cell, pt) * (J(cell, pt) - 1.0) - d) *
+          (2.0 * c_ * J_(cell, pt) * (J_(cell, pt) - 1.0) - d) *
               minitensor::inverse(C);
-      sigma = (1. / J(cell, pt)) * F * S * minitensor::transpose(F);
+      sigma = (1. / J_(cell, pt)) * F * S * minitensor::transpose(F);
 
       for (int i(0); i < num_dims_; ++i)
-        for (int j(0); j < num_dims_; ++j) stress(cell, pt, i, j) = sigma(i, j);
+        for (int j(0); j < num_dims_; ++j)
+          stress_(cell, pt, i, j) = sigma(i, j);
     }
   }
 }
@@ -56,20 +56,23 @@ class NeohookeanModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~NeohookeanModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -78,6 +81,17 @@ class NeohookeanModel : public LCM::ConstitutiveModel<EvalT, Traits>
   NeohookeanModel(NeohookeanModel const&) = delete;
   NeohookeanModel&
   operator=(NeohookeanModel const&) = delete;
+ private:
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> jac_det_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> energy_;
+  PHX::MDField<ScalarT> tangent_;
 };
 
 }  // namespace LCM
@@ -51,26 +51,36 @@ NeohookeanModel<EvalT, Traits>::NeohookeanModel(
 //
 template <typename EvalT, typename Traits>
 void
-NeohookeanModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+NeohookeanModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   std::string F_string = (*field_name_map_)["F"];
   std::string J_string = (*field_name_map_)["J"];
   std::string cauchy   = (*field_name_map_)["Cauchy_Stress"];
 
   // extract dependent MDFields
-  auto def_grad        = *dep_fields[F_string];
-  auto jac_det         = *dep_fields[J_string];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  def_grad_        = *dep_fields[F_string];
+  jac_det_         = *dep_fields[J_string];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
 
   // extract evaluated MDFields
-  auto stress  = *eval_fields[cauchy];
-  auto energy  = *eval_fields["Energy"];
-  auto tangent = *eval_fields["Material Tangent"];
+  stress_  = *eval_fields[cauchy];
+  energy_  = *eval_fields["Energy"];
+  tangent_ = *eval_fields["Material Tangent"];
+}
 
+//
+//
+//
+template <typename EvalT, typename Traits>
+void
+NeohookeanModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   ScalarT kappa;
   ScalarT mu, mubar;
   ScalarT Jm13, Jm53, Jm23;
@@ -86,11 +96,11 @@ NeohookeanModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      auto const& E = elastic_modulus(cell, pt);
+      auto const& E = elastic_modulus_(cell, pt);
 
-      auto const& nu = poissons_ratio(cell, pt);
+      auto const& nu = poissons_ratio_(cell, pt);
 
-      auto const& J = jac_det(cell, pt);
+      auto const& J = jac_det_(cell, pt);
 
       kappa = E / (3.0 * (1.0 - 2.0 * nu));
 
@@ -102,7 +112,7 @@ NeohookeanModel<EvalT, Traits>::computeState(
 
       Jm53 = Jm23 * Jm23 * Jm13;
 
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
 
       // Mechanical deformation gradient
       auto Fm = minitensor::Tensor<ScalarT>(F);
@@ -128,13 +138,13 @@ NeohookeanModel<EvalT, Traits>::computeState(
 
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
 
       if (compute_energy_ == true) {
-        energy(cell, pt) = 0.5 * kappa * (0.5 * (J * J - 1.0) - std::log(J)) +
-                           0.5 * mu * (Jm23 * minitensor::trace(b) - 3.0);
+        energy_(cell, pt) = 0.5 * kappa * (0.5 * (J * J - 1.0) - std::log(J)) +
+                            0.5 * mu * (Jm23 * minitensor::trace(b) - 3.0);
       }
 
       if (compute_tangent_ == true) {
@@ -151,7 +161,7 @@ NeohookeanModel<EvalT, Traits>::computeState(
           for (int j = 0; j < num_dims_; ++j) {
             for (int k = 0; k < num_dims_; ++k) {
               for (int l = 0; l < num_dims_; ++l) {
-                tangent(cell, pt, i, j, k, l) = dsigmadb(i, j, k, l);
+                tangent_(cell, pt, i, j, k, l) = dsigmadb(i, j, k, l);
               }
             }
           }
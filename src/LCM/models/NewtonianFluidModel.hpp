@@ -52,20 +52,23 @@ class NewtonianFluidModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~NewtonianFluidModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -86,6 +89,16 @@ class NewtonianFluidModel : public LCM::ConstitutiveModel<EvalT, Traits>
   /// shear viscosity
   ///
   ScalarT mu_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> delta_time_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+
+  // Name of the old deformation gradient state variable
+  std::string F_old_string_;
 };
 }  // namespace LCM
 
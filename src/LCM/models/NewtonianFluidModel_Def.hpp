@@ -53,30 +53,38 @@ NewtonianFluidModel<EvalT, Traits>::NewtonianFluidModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-NewtonianFluidModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+NewtonianFluidModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   std::string F_string      = (*field_name_map_)["F"];
   std::string cauchy_string = (*field_name_map_)["Cauchy_Stress"];
+  F_old_string_             = F_string + "_old";
 
   // extract dependent MDFields
-  auto def_grad   = *dep_fields[F_string];
-  auto delta_time = *dep_fields["Delta Time"];
+  def_grad_   = *dep_fields[F_string];
+  delta_time_ = *dep_fields["Delta Time"];
 
   // extract evaluated MDFields
-  auto stress = *eval_fields[cauchy_string];
-
+  stress_ = *eval_fields[cauchy_string];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+NewtonianFluidModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray def_grad_old = (*workset.stateArrayPtr)[F_string + "_old"];
+  Albany::MDArray def_grad_old = (*workset.stateArrayPtr)[F_old_string_];
 
   // pressure is hard coded as 1 for now
   // this is likely not general enough :)
   ScalarT p = 1;
 
   // time increment
-  ScalarT dt = delta_time(0);
+  ScalarT dt = delta_time_(0);
 
   // containers
   minitensor::Tensor<ScalarT> Fnew(num_dims_);
@@ -92,7 +100,7 @@ NewtonianFluidModel<EvalT, Traits>::computeState(
       // should only be the first time step
       if (dt == 0) {
         for (int i = 0; i < num_dims_; ++i)
-          for (int j = 0; j < num_dims_; ++j) stress(cell, pt, i, j) = 0.0;
+          for (int j = 0; j < num_dims_; ++j) stress_(cell, pt, i, j) = 0.0;
       } else {
         // old deformation gradient
         for (int i = 0; i < num_dims_; ++i)
@@ -100,7 +108,7 @@ NewtonianFluidModel<EvalT, Traits>::computeState(
             Fold(i, j) = ScalarT(def_grad_old(cell, pt, i, j));
 
         // current deformation gradient
-        Fnew.fill(def_grad, cell, pt, 0, 0);
+        Fnew.fill(def_grad_, cell, pt, 0, 0);
 
         // incremental deformation gradient
         Finc = Fnew * minitensor::inverse(Fold);
@@ -118,7 +126,7 @@ NewtonianFluidModel<EvalT, Traits>::computeState(
         // update stress state
         for (int i = 0; i < num_dims_; ++i)
           for (int j = 0; j < num_dims_; ++j)
-            stress(cell, pt, i, j) = sigma(i, j);
+            stress_(cell, pt, i, j) = sigma(i, j);
       }
     }
   }
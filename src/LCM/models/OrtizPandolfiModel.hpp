@@ -46,20 +46,23 @@ class OrtizPandolfiModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~OrtizPandolfiModel() {}
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -80,6 +83,18 @@ class OrtizPandolfiModel : public LCM::ConstitutiveModel<EvalT, Traits>
   /// Constants
   ///
   RealType delta_c, sigma_c, beta, stiff_c;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> jump_;
+  PHX::MDField<const ScalarT> basis_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> traction_;
+  PHX::MDField<ScalarT> traction_normal_;
+  PHX::MDField<ScalarT> traction_shear_;
+  PHX::MDField<ScalarT> jump_normal_;
+  PHX::MDField<ScalarT> jump_shear_;
+  PHX::MDField<ScalarT> jump_max_;
 };
 }  // namespace LCM
 
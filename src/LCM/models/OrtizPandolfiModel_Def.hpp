@@ -106,23 +106,30 @@ OrtizPandolfiModel<EvalT, Traits>::OrtizPandolfiModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-OrtizPandolfiModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+OrtizPandolfiModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto mdf_jump  = *dep_fields["Vector Jump"];
-  auto mdf_basis = *dep_fields["Current Basis"];
+  jump_  = *dep_fields["Vector Jump"];
+  basis_ = *dep_fields["Current Basis"];
 
   // extract evaluated MDFields
-  auto mdf_traction        = *eval_fields["Cohesive_Traction"];
-  auto mdf_traction_normal = *eval_fields["Normal_Traction"];
-  auto mdf_traction_shear  = *eval_fields["Shear_Traction"];
-  auto mdf_jump_normal     = *eval_fields["Normal_Jump"];
-  auto mdf_jump_shear      = *eval_fields["Shear_Jump"];
-  auto mdf_jump_max        = *eval_fields["Max_Jump"];
-
+  traction_        = *eval_fields["Cohesive_Traction"];
+  traction_normal_ = *eval_fields["Normal_Traction"];
+  traction_shear_  = *eval_fields["Shear_Traction"];
+  jump_normal_     = *eval_fields["Normal_Jump"];
+  jump_shear_      = *eval_fields["Shear_Jump"];
+  jump_max_        = *eval_fields["Max_Jump"];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+OrtizPandolfiModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get state variable
   Albany::MDArray jump_max_old = (*workset.stateArrayPtr)["Max_Jump_old"];
 
@@ -132,17 +139,17 @@ OrtizPandolfiModel<EvalT, Traits>::computeState(
     for (int pt(0); pt < num_pts_; ++pt) {
       // current basis vector
       minitensor::Vector<ScalarT> g_0(
-          minitensor::Source::ARRAY, 3, mdf_basis, cell, pt, 0, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 0, 0);
 
       minitensor::Vector<ScalarT> g_1(
-          minitensor::Source::ARRAY, 3, mdf_basis, cell, pt, 1, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 1, 0);
 
       minitensor::Vector<ScalarT> n(
-          minitensor::Source::ARRAY, 3, mdf_basis, cell, pt, 2, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 2, 0);
 
       // current jump vector - move PHX::MDField into minitensor::Vector
       minitensor::Vector<ScalarT> jump_pt(
-          minitensor::Source::ARRAY, 3, mdf_jump, cell, pt, 0);
+          minitensor::Source::ARRAY, 3, jump_, cell, pt, 0);
 
       // construct Identity tensor (2nd order) and tensor product of normal
       minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(3));
@@ -247,9 +254,9 @@ OrtizPandolfiModel<EvalT, Traits>::computeState(
       }
 
       // update global traction
-      mdf_traction(cell, pt, 0) = traction_vector(0);
-      mdf_traction(cell, pt, 1) = traction_vector(1);
-      mdf_traction(cell, pt, 2) = traction_vector(2);
+      traction_(cell, pt, 0) = traction_vector(0);
+      traction_(cell, pt, 1) = traction_vector(1);
+      traction_(cell, pt, 2) = traction_vector(2);
 
       // update state variables
 
@@ -261,15 +268,15 @@ OrtizPandolfiModel<EvalT, Traits>::computeState(
       ScalarT traction_s2 = minitensor::dot(vec_traction_s, vec_traction_s);
       ScalarT traction_s  = 0.0;
       if (traction_s2 > 0.0) { traction_s = std::sqrt(traction_s2); }
-      mdf_traction_normal(cell, pt) = traction_n;
-      mdf_traction_shear(cell, pt)  = traction_s;
+      traction_normal_(cell, pt) = traction_n;
+      traction_shear_(cell, pt)  = traction_s;
 
-      // Populate mdf_jump_normal and mdf_jump_shear
-      mdf_jump_normal(cell, pt) = jump_n;
-      mdf_jump_shear(cell, pt)  = jump_s;
+      // Populate jump_normal_ and jump_shear_
+      jump_normal_(cell, pt) = jump_n;
+      jump_shear_(cell, pt)  = jump_s;
 
-      // only true state variable is mdf_jump_max
-      if (jump_eff > jump_m) { mdf_jump_max(cell, pt) = jump_eff; }
+      // only true state variable is jump_max_
+      if (jump_eff > jump_m) { jump_max_(cell, pt) = jump_eff; }
     }
   }
 }
@@ -46,20 +46,23 @@ class RIHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
   ///
   virtual ~RIHMRModel(){};
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -97,6 +100,26 @@ class RIHMRModel : public LCM::ConstitutiveModel<EvalT, Traits>
       ScalarT&              K,
       ScalarT&              Y,
       ScalarT&              Rd);
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> poissons_ratio_;
+  PHX::MDField<const ScalarT> elastic_modulus_;
+  PHX::MDField<const ScalarT> yield_strength_;
+  PHX::MDField<const ScalarT> hardening_modulus_;
+  PHX::MDField<const ScalarT> recovery_modulus_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> logFp_;
+  PHX::MDField<ScalarT> eqps_;
+  PHX::MDField<ScalarT> isoHardening_;
+
+  // Names of the old state variables
+  std::string logFp_old_string_;
+  std::string eqps_old_string_;
+  std::string isoHardening_old_string_;
 };
 }  // namespace LCM
 
@@ -86,19 +86,18 @@ RIHMRModel<EvalT, Traits>::RIHMRModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-RIHMRModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+RIHMRModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad          = *dep_fields["F"];
-  auto J                 = *dep_fields["J"];
-  auto poissons_ratio    = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus   = *dep_fields["Elastic Modulus"];
-  auto yield_strength    = *dep_fields["Yield Strength"];
-  auto hardening_modulus = *dep_fields["Hardening Modulus"];
-  auto recovery_modulus  = *dep_fields["Recovery Modulus"];
+  def_grad_          = *dep_fields["F"];
+  J_                 = *dep_fields["J"];
+  poissons_ratio_    = *dep_fields["Poissons Ratio"];
+  elastic_modulus_   = *dep_fields["Elastic Modulus"];
+  yield_strength_    = *dep_fields["Yield Strength"];
+  hardening_modulus_ = *dep_fields["Hardening Modulus"];
+  recovery_modulus_  = *dep_fields["Recovery Modulus"];
 
   // retrieve appropriate field name strings
   std::string cauchy_string       = (*field_name_map_)["Cauchy_Stress"];
@@ -106,16 +105,28 @@ RIHMRModel<EvalT, Traits>::computeState(
   std::string eqps_string         = (*field_name_map_)["eqps"];
   std::string isoHardening_string = (*field_name_map_)["isotropic_hardening"];
   // extract evaluated MDFields
-  auto stress       = *eval_fields[cauchy_string];
-  auto logFp        = *eval_fields[logFp_string];
-  auto eqps         = *eval_fields[eqps_string];
-  auto isoHardening = *eval_fields[isoHardening_string];
-
+  stress_       = *eval_fields[cauchy_string];
+  logFp_        = *eval_fields[logFp_string];
+  eqps_         = *eval_fields[eqps_string];
+  isoHardening_ = *eval_fields[isoHardening_string];
+
+  logFp_old_string_        = logFp_string + "_old";
+  eqps_old_string_         = eqps_string + "_old";
+  isoHardening_old_string_ = isoHardening_string + "_old";
+}
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+RIHMRModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   // get State Variables
-  Albany::MDArray logFp_old = (*workset.stateArrayPtr)[logFp_string + "_old"];
-  Albany::MDArray eqps_old  = (*workset.stateArrayPtr)[eqps_string + "_old"];
+  Albany::MDArray logFp_old = (*workset.stateArrayPtr)[logFp_old_string_];
+  Albany::MDArray eqps_old  = (*workset.stateArrayPtr)[eqps_old_string_];
   Albany::MDArray isoHardening_old =
-      (*workset.stateArrayPtr)[isoHardening_string + "_old"];
+      (*workset.stateArrayPtr)[isoHardening_old_string_];
 
   // scratch space FCs
   minitensor::Tensor<ScalarT> be(num_dims_);
@@ -162,13 +173,14 @@ RIHMRModel<EvalT, Traits>::computeState(
           minitensor::inverse(Fp),
           minitensor::transpose(minitensor::inverse(Fp)));
 
-      kappa = elastic_modulus(cell, pt) /
-              (3.0 * (1.0 - 2.0 * poissons_ratio(cell, pt)));
-      mu = elastic_modulus(cell, pt) / (2.0 * (1.0 + poissons_ratio(cell, pt)));
-      K  = hardening_modulus(cell, pt);
-      Y  = yield_strength(cell, pt);
-      Rd = recovery_modulus(cell, pt);
-      Jm23 = std::pow(J(cell, pt), -2.0 / 3.0);
+      kappa = elastic_modulus_(cell, pt) /
+              (3.0 * (1.0 - 2.0 * poissons_ratio_(cell, pt)));
+      mu = elastic_modulus_(cell, pt) /
+           (2.0 * (1.0 + poissons_ratio_(cell, pt)));
+      K  = hardening_modulus_(cell, pt);
+      Y  = yield_strength_(cell, pt);
+      Rd = recovery_modulus_(cell, pt);
+      Jm23 = std::pow(J_(cell, pt), -2.0 / 3.0);
 
       // Compute Trial State
       be.clear();
@@ -176,8 +188,8 @@ RIHMRModel<EvalT, Traits>::computeState(
         for (int j = 0; j < num_dims_; ++j)
           for (int p = 0; p < num_dims_; ++p)
             for (int q = 0; q < num_dims_; ++q)
-              be(i, j) += Jm23 * def_grad(cell, pt, i, p) * Cpinv(p, q) *
-                          def_grad(cell, pt, j, q);
+              be(i, j) += Jm23 * def_grad_(cell, pt, i, p) * Cpinv(p, q) *
+                          def_grad_(cell, pt, j, q);
 
       trd3  = minitensor::trace(be) / 3.;
       mubar = trd3 * mu;
@@ -242,10 +254,10 @@ RIHMRModel<EvalT, Traits>::computeState(
         s -= ScalarT(2. * mubar * dgam) * n;
 
         // update isoHardening
-        isoHardening(cell, pt) = isoH;
+        isoHardening_(cell, pt) = isoH;
 
         // update eqps
-        eqps(cell, pt) = eqps_old(cell, pt) + sq23 * dgam;
+        eqps_(cell, pt) = eqps_old(cell, pt) + sq23 * dgam;
 
         // exponential map to get Fp
         A    = dgam * n;
@@ -262,27 +274,27 @@ RIHMRModel<EvalT, Traits>::computeState(
 
       } else {
         // set state variables to old values
-        isoHardening(cell, pt) = isoHardening_old(cell, pt);
+        isoHardening_(cell, pt) = isoHardening_old(cell, pt);
 
-        eqps(cell, pt) = eqps_old(cell, pt);
-        Fp             = Fpold;
+        eqps_(cell, pt) = eqps_old(cell, pt);
+        Fp              = Fpold;
       }
 
       // store logFp as the state variable
       logFp_n = minitensor::log(Fp);
       for (int i = 0; i < num_dims_; ++i)
         for (int j = 0; j < num_dims_; ++j)
-          logFp(cell, pt, i, j) = logFp_n(i, j);
+          logFp_(cell, pt, i, j) = logFp_n(i, j);
 
       // compute pressure
-      p = 0.5 * kappa * (J(cell, pt) - 1 / (J(cell, pt)));
+      p = 0.5 * kappa * (J_(cell, pt) - 1 / (J_(cell, pt)));
 
       // compute stress
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = s(i, j) / J(cell, pt);
+          stress_(cell, pt, i, j) = s(i, j) / J_(cell, pt);
         }
-        stress(cell, pt, i, i) += p;
+        stress_(cell, pt, i, i) += p;
       }
     }
   }
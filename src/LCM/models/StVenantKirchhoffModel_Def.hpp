@@ -39,21 +39,28 @@ StVenantKirchhoffModel<EvalT, Traits>::StVenantKirchhoffModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-StVenantKirchhoffModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+StVenantKirchhoffModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto def_grad        = *dep_fields["F"];
-  auto J               = *dep_fields["J"];
-  auto poissons_ratio  = *dep_fields["Poissons Ratio"];
-  auto elastic_modulus = *dep_fields["Elastic Modulus"];
+  def_grad_        = *dep_fields["F"];
+  poissons_ratio_  = *dep_fields["Poissons Ratio"];
+  elastic_modulus_ = *dep_fields["Elastic Modulus"];
   // extract evaluated MDFields
   std::string cauchy = (*field_name_map_)["Cauchy_Stress"];
-  auto        stress = *eval_fields[cauchy];
-  ScalarT     lambda;
-  ScalarT     mu;
+  stress_            = *eval_fields[cauchy];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+StVenantKirchhoffModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  ScalarT lambda;
+  ScalarT mu;
 
   minitensor::Tensor<ScalarT> F(num_dims_), C(num_dims_), sigma(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
@@ -61,18 +68,19 @@ StVenantKirchhoffModel<EvalT, Traits>::computeState(
 
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
-      lambda = (elastic_modulus(cell, pt) * poissons_ratio(cell, pt)) /
-               (1. + poissons_ratio(cell, pt)) /
-               (1 - 2 * poissons_ratio(cell, pt));
-      mu = elastic_modulus(cell, pt) / (2. * (1. + poissons_ratio(cell, pt)));
-      F.fill(def_grad, cell, pt, 0, 0);
+      lambda = (elastic_modulus_(cell, pt) * poissons_ratio_(cell, pt)) /
+               (1. + poissons_ratio_(cell, pt)) /
+               (1 - 2 * poissons_ratio_(cell, pt));
+      mu =
+          elastic_modulus_(cell, pt) / (2. * (1. + poissons_ratio_(cell, pt)));
+      F.fill(def_grad_, cell, pt, 0, 0);
       C     = F * transpose(F);
       E     = 0.5 * (C - I);
       S     = lambda * minitensor::trace(E) * I + 2.0 * mu * E;
       sigma = (1.0 / minitensor::det(F)) * F * S * minitensor::transpose(F);
       for (int i = 0; i < num_dims_; ++i) {
         for (int j = 0; j < num_dims_; ++j) {
-          stress(cell, pt, i, j) = sigma(i, j);
+          stress_(cell, pt, i, j) = sigma(i, j);
         }
       }
     }
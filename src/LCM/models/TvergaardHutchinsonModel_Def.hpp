@@ -98,33 +98,40 @@ TvergaardHutchinsonModel<EvalT, Traits>::TvergaardHutchinsonModel(
 //------------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-TvergaardHutchinsonModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+TvergaardHutchinsonModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // extract dependent MDFields
-  auto jump  = *dep_fields["Vector Jump"];
-  auto basis = *dep_fields["Current Basis"];
+  jump_  = *dep_fields["Vector Jump"];
+  basis_ = *dep_fields["Current Basis"];
 
   // extract evaluated MDFields
-  auto traction        = *eval_fields["Cohesive_Traction"];
-  auto traction_normal = *eval_fields["Normal_Traction"];
-  auto traction_shear  = *eval_fields["Shear_Traction"];
-  auto jump_normal     = *eval_fields["Normal_Jump"];
-  auto jump_shear      = *eval_fields["Shear_Jump"];
-
+  traction_        = *eval_fields["Cohesive_Traction"];
+  traction_normal_ = *eval_fields["Normal_Traction"];
+  traction_shear_  = *eval_fields["Shear_Traction"];
+  jump_normal_     = *eval_fields["Normal_Jump"];
+  jump_shear_      = *eval_fields["Shear_Jump"];
+}
+//------------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+TvergaardHutchinsonModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
       // current basis vector
       minitensor::Vector<ScalarT> g_0(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 0, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 0, 0);
 
       minitensor::Vector<ScalarT> g_1(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 1, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 1, 0);
 
       minitensor::Vector<ScalarT> n(
-          minitensor::Source::ARRAY, 3, basis, cell, pt, 2, 0);
+          minitensor::Source::ARRAY, 3, basis_, cell, pt, 2, 0);
 
       // construct orthogonal unit basis
       minitensor::Vector<ScalarT> t_0(0.0, 0.0, 0.0), t_1(0.0, 0.0, 0.0);
@@ -146,7 +153,7 @@ TvergaardHutchinsonModel<EvalT, Traits>::computeState(
 
       // global and local jump
       minitensor::Vector<ScalarT> jump_global(
-          minitensor::Source::ARRAY, 3, jump, cell, pt, 0);
+          minitensor::Source::ARRAY, 3, jump_, cell, pt, 0);
       minitensor::Vector<ScalarT> jump_local(3);
       jump_local = minitensor::dot(minitensor::transpose(Q), jump_global);
 
@@ -209,15 +216,15 @@ TvergaardHutchinsonModel<EvalT, Traits>::computeState(
       minitensor::Vector<ScalarT> traction_global(3);
       traction_global = minitensor::dot(Q, traction_local);
 
-      traction(cell, pt, 0) = traction_global(0);
-      traction(cell, pt, 1) = traction_global(1);
-      traction(cell, pt, 2) = traction_global(2);
+      traction_(cell, pt, 0) = traction_global(0);
+      traction_(cell, pt, 1) = traction_global(1);
+      traction_(cell, pt, 2) = traction_global(2);
 
       // update state variables
-      traction_normal(cell, pt) = traction_local(2);
-      traction_shear(cell, pt)  = TractionShear;
-      jump_normal(cell, pt)     = JumpNormal;
-      jump_shear(cell, pt)      = JumpShear;
+      traction_normal_(cell, pt) = traction_local(2);
+      traction_shear_(cell, pt)  = TractionShear;
+      jump_normal_(cell, pt)     = JumpNormal;
+      jump_shear_(cell, pt)      = JumpShear;
     }
   }
 }
@@ -67,21 +67,24 @@ class ViscoElasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
       // empty
   };
 
+  virtual void
+  bindFields(DepFieldMap& dep_fields, FieldMap& eval_fields);
+
   ///
   /// Method to compute the state (e.g. energy, stress, tangent)
   ///
   virtual void
   computeState(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields);
 
   // This capability not implemented yet.
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields)
+      DepFieldMap&              dep_fields,
+      FieldMap&                 eval_fields)
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
@@ -109,6 +112,26 @@ class ViscoElasticModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
   // Gas constant
   RealType R_;
+
+  // Dependent MDFields
+  PHX::MDField<const ScalarT> def_grad_;
+  PHX::MDField<const ScalarT> J_;
+  PHX::MDField<const ScalarT> delta_time_;
+
+  // Evaluated MDFields
+  PHX::MDField<ScalarT> stress_;
+  PHX::MDField<ScalarT> stress_0_;
+  PHX::MDField<ScalarT> H1_;
+  PHX::MDField<ScalarT> H2_;
+  PHX::MDField<ScalarT> H3_;
+  PHX::MDField<ScalarT> time_;
+
+  // Names of the old state variables
+  std::string J_old_string_;
+  std::string stress_0_old_string_;
+  std::string H1_old_string_;
+  std::string H2_old_string_;
+  std::string H3_old_string_;
 };
 }  // namespace LCM
 
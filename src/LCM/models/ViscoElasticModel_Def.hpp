@@ -118,10 +118,9 @@ ViscoElasticModel<EvalT, Traits>::ViscoElasticModel(
 //----------------------------------------------------------------------------
 template <typename EvalT, typename Traits>
 void
-ViscoElasticModel<EvalT, Traits>::computeState(
-    typename Traits::EvalData workset,
-    DepFieldMap               dep_fields,
-    FieldMap                  eval_fields)
+ViscoElasticModel<EvalT, Traits>::bindFields(
+    DepFieldMap& dep_fields,
+    FieldMap&    eval_fields)
 {
   // Get names
   std::string F_string  = (*field_name_map_)["F"];
@@ -132,43 +131,61 @@ ViscoElasticModel<EvalT, Traits>::computeState(
   std::string H2_string = (*field_name_map_)["H_2"];
   std::string H3_string = (*field_name_map_)["H_3"];
 
-  // std::cout << workset.current_time << std::endl;
-  // std::cout << workset.previous_time << std::endl;
-  // ScalarT dt = 1.0e-7;
-
   //
   // extract dependent MDFields
   //
-  auto def_grad   = *dep_fields[F_string];
-  auto J          = *dep_fields[J_string];
-  auto delta_time = *dep_fields["Delta Time"];
+  def_grad_   = *dep_fields[F_string];
+  J_          = *dep_fields[J_string];
+  delta_time_ = *dep_fields["Delta Time"];
 
   //
   // extract evaluated MDFields
   //
-  auto stress = *eval_fields[cauchy];
+  stress_ = *eval_fields[cauchy];
   // S_0
-  auto stress_0 = *eval_fields[S0_string];
+  stress_0_ = *eval_fields[S0_string];
   // H_alpha
-  auto H1 = *eval_fields[H1_string];
-  auto H2 = *eval_fields[H2_string];
-  auto H3 = *eval_fields[H3_string];
+  H1_ = *eval_fields[H1_string];
+  H2_ = *eval_fields[H2_string];
+  H3_ = *eval_fields[H3_string];
   // time
-  auto time = *eval_fields["Time"];
+  time_ = *eval_fields["Time"];
+
+  //
+  // Names of the previous values (state variables)
+  //
+  J_old_string_        = J_string + "_old";
+  stress_0_old_string_ = S0_string + "_old";
+  H1_old_string_       = H1_string + "_old";
+  H2_old_string_       = H2_string + "_old";
+  H3_old_string_       = H3_string + "_old";
+}
+
+//----------------------------------------------------------------------------
+template <typename EvalT, typename Traits>
+void
+ViscoElasticModel<EvalT, Traits>::computeState(
+    typename Traits::EvalData workset,
+    DepFieldMap&              dep_fields,
+    FieldMap&                 eval_fields)
+{
+  // std::cout << workset.current_time << std::endl;
+  // std::cout << workset.previous_time << std::endl;
+  // ScalarT dt = 1.0e-7;
 
   //
   // Extract previous values (state variables)
   //
-  Albany::MDArray J_old        = (*workset.stateArrayPtr)[J_string + "_old"];
-  Albany::MDArray stress_0_old = (*workset.stateArrayPtr)[S0_string + "_old"];
-  Albany::MDArray H1_old       = (*workset.stateArrayPtr)[H1_string + "_old"];
-  Albany::MDArray H2_old       = (*workset.stateArrayPtr)[H2_string + "_old"];
-  Albany::MDArray H3_old       = (*workset.stateArrayPtr)[H3_string + "_old"];
+  Albany::MDArray J_old        = (*workset.stateArrayPtr)[J_old_string_];
+  Albany::MDArray stress_0_old = (*workset.stateArrayPtr)[stress_0_old_string_];
+  Albany::MDArray H1_old       = (*workset.stateArrayPtr)[H1_old_string_];
+  Albany::MDArray H2_old       = (*workset.stateArrayPtr)[H2_old_string_];
+  Albany::MDArray H3_old       = (*workset.stateArrayPtr)[H3_old_string_];
 
   // get dt
-  RealType dt = Sacado::ScalarValue<ScalarT>::eval(delta_time(0));
+  RealType dt = Sacado::ScalarValue<ScalarT>::eval(delta_time_(0));
   // get current time
-  RealType tcurrent = Sacado::ScalarValue<ScalarT>::eval(time(0));
+  RealType tcurrent = Sacado::ScalarValue<ScalarT>::eval(time_(0));
 
   //    std::cout << "dt = " << dt << std::endl;
   //    std::cout << "tcurrent = " << tcurrent << std::endl;
@@ -260,7 +277,7 @@ ViscoElasticModel<EvalT, Traits>::computeState(
   for (int cell(0); cell < workset.numCells; ++cell) {
     for (int pt(0); pt < num_pts_; ++pt) {
       // get Jacobian
-      Jac = J(cell, pt);
+      Jac = J_(cell, pt);
       // get Jacobian old
       Jac_old = J_old(cell, pt);
       // get Jac23 at Gauss point
@@ -270,7 +287,7 @@ ViscoElasticModel<EvalT, Traits>::computeState(
       //
       Jac23_old = std::pow(Jac_old, 2.0 / 3.0);
       // Fill deformation gradient
-      F.fill(def_grad, cell, pt, 0, 0);
+      F.fill(def_grad_, cell, pt, 0, 0);
       //             Fill old values
       for (int i(0); i < num_dims_; ++i) {
         for (int j(0); j < num_dims_; ++j) {
@@ -339,11 +356,11 @@ ViscoElasticModel<EvalT, Traits>::computeState(
       // fill Cauchy stress and instantaneous stress
       for (int i = 0; i < num_dims_; i++) {
         for (int j = 0; j < num_dims_; j++) {
-          stress(cell, pt, i, j)   = sigma(i, j);
-          stress_0(cell, pt, i, j) = S0(i, j);
-          H1(cell, pt, i, j)       = h1(i, j);
-          H2(cell, pt, i, j)       = h2(i, j);
-          H3(cell, pt, i, j)       = h3(i, j);
+          stress_(cell, pt, i, j)   = sigma(i, j);
+          stress_0_(cell, pt, i, j) = S0(i, j);
+          H1_(cell, pt, i, j)       = h1(i, j);
+          H2_(cell, pt, i, j)       = h2(i, j);
+          H3_(cell, pt, i, j)       = h3(i, j);
         }
       }
 
@@ -97,16 +97,39 @@ struct ParallelKernel
       std::string const&                      field_name,
       std::size_t                             num,
       std::vector<Teuchos::RCP<ScalarField>>& state,
-      std::vector<Albany::MDArray*>&          old_state,
-      FieldMap<ScalarT>&                      eval_fields,
-      Workset&                                workset);
+      FieldMap<ScalarT>&                      eval_fields);
 
   void
-  extractEvaluatedFieldArray(
-      std::string const&                      field_name,
-      std::size_t                             num,
-      std::vector<Teuchos::RCP<ScalarField>>& state,
-      FieldMap<ScalarT>&                      eval_fields);
+  extractOldStateArray(
+      std::string const&             field_name,
+      std::size_t                    num,
+      std::vector<Albany::MDArray*>& old_state,
+      Workset&                       workset);
+
+  ///
+  /// Bind the fields used by the kernel. Called once, after the field
+  /// data has been set. Kernels hide this to extract their fields.
+  ///
+  void
+  bindFields(
+      FieldMap<const ScalarT>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields)
+  {
+    return;
+  }
+
+  ///
+  /// Set the per-workset data (old states, time step, ...) before the
+  /// kernel is run over the cells of the workset.
+  ///
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<const ScalarT>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields)
+  {
+    return;
+  }
 
   ConstitutiveModel<EvalT, Traits>& model_;
 
@@ -216,17 +239,22 @@ class ParallelConstitutiveModel : public LCM::ConstitutiveModel<EvalT, Traits>
 
   virtual ~ParallelConstitutiveModel() = default;
 
+  void
+  bindFields(
+      FieldMap<const ScalarT>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields) final;
+
   void
   computeState(
       typename Traits::EvalData workset,
-      FieldMap<const ScalarT>   dep_fields,
-      FieldMap<ScalarT>         eval_fields) final;
+      FieldMap<const ScalarT>&  dep_fields,
+      FieldMap<ScalarT>&        eval_fields) final;
 
   virtual void
   computeStateParallel(
       typename Traits::EvalData workset,
-      FieldMap<const ScalarT>   dep_fields,
-      FieldMap<ScalarT>         eval_fields) override
+      FieldMap<const ScalarT>&  dep_fields,
+      FieldMap<ScalarT>&        eval_fields) override
   {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
   }
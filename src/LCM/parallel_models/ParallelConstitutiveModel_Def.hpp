@@ -25,12 +25,21 @@ inline ParallelConstitutiveModel<EvalT, Traits, Kernel>::
   kernel_ = util::make_unique<EvalKernel>(*this, p, dl);
 }
 
+template <typename EvalT, typename Traits, typename Kernel>
+inline void
+ParallelConstitutiveModel<EvalT, Traits, Kernel>::bindFields(
+    FieldMap<const ScalarT>& dep_fields,
+    FieldMap<ScalarT>&       eval_fields)
+{
+  kernel_->bindFields(dep_fields, eval_fields);
+}
+
 template <typename EvalT, typename Traits, typename Kernel>
 inline void
 ParallelConstitutiveModel<EvalT, Traits, Kernel>::computeState(
     typename Traits::EvalData workset,
-    FieldMap<const ScalarT>   dep_fields,
-    FieldMap<ScalarT>         eval_fields)
+    FieldMap<const ScalarT>&  dep_fields,
+    FieldMap<ScalarT>&        eval_fields)
 {
   util::TimeMonitor& tmonitor =
       util::PerformanceContext::instance().timeMonitor();
@@ -74,43 +83,37 @@ ParallelKernel<EvalT, Traits>::extractEvaluatedFieldArray(
     std::string const&                      field_name,
     std::size_t                             num,
     std::vector<Teuchos::RCP<ScalarField>>& state,
-    std::vector<Albany::MDArray*>&          old_state,
-    FieldMap<ScalarT>&                      eval_fields,
-    Workset&                                workset)
+    FieldMap<ScalarT>&                      eval_fields)
 {
   state.clear();
   state.reserve(num);
 
-  old_state.clear();
-  old_state.reserve(num);
-
   for (std::size_t i = 0; i < num; ++i) {
     std::string const id = Albany::strint(field_name, i + 1, '_');
 
     std::string const name = field_name_map_[id];
 
     state.emplace_back(eval_fields[name]);
-    old_state.emplace_back(&((*workset.stateArrayPtr)[name + "_old"]));
   }
 }
 
 template <typename EvalT, typename Traits>
 inline void
-ParallelKernel<EvalT, Traits>::extractEvaluatedFieldArray(
-    std::string const&                      field_name,
-    std::size_t                             num,
-    std::vector<Teuchos::RCP<ScalarField>>& state,
-    FieldMap<ScalarT>&                      eval_fields)
+ParallelKernel<EvalT, Traits>::extractOldStateArray(
+    std::string const&             field_name,
+    std::size_t                    num,
+    std::vector<Albany::MDArray*>& old_state,
+    Workset&                       workset)
 {
-  state.clear();
-  state.reserve(num);
+  old_state.clear();
+  old_state.reserve(num);
 
   for (std::size_t i = 0; i < num; ++i) {
     std::string const id = Albany::strint(field_name, i + 1, '_');
 
     std::string const name = field_name_map_[id];
 
-    state.emplace_back(eval_fields[name]);
+    old_state.emplace_back(&((*workset.stateArrayPtr)[name + "_old"]));
   }
 }
 
@@ -61,8 +61,7 @@ struct NeohookeanKernel : public ParallelKernel<EvalT, Traits>
   ScalarField tangent;
 
   void
-  init(
-      Workset&                 workset,
+  bindFields(
       FieldMap<const ScalarT>& dep_fields,
       FieldMap<ScalarT>&       eval_fields);
 
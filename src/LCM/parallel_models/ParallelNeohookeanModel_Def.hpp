@@ -50,8 +50,7 @@ NeohookeanKernel<EvalT, Traits>::NeohookeanKernel(
 
 template <typename EvalT, typename Traits>
 void
-NeohookeanKernel<EvalT, Traits>::init(
-    Workset&                 workset,
+NeohookeanKernel<EvalT, Traits>::bindFields(
     FieldMap<const ScalarT>& dep_fields,
     FieldMap<ScalarT>&       eval_fields)
 {
@@ -13,6 +13,7 @@ namespace Albany {
 ///
 MechanicsProblem::MechanicsProblem(
     Teuchos::RCP<Teuchos::ParameterList> const& params,
+    Teuchos::RCP<Teuchos::ParameterList> const& disc_params,
     Teuchos::RCP<ParamLib> const&               param_lib,
     int const                                   num_dims,
     Teuchos::RCP<AAdapt::rc::Manager> const&    rc_mgr,
@@ -38,6 +39,7 @@ MechanicsProblem::MechanicsProblem(
       have_topmod_adaptation_(false),
       have_sizefield_adaptation_(false),
       use_sdbcs_(false),
+      explicit_dynamics_(disc_params->get<bool>("Explicit Dynamics", false)),
       rc_mgr_(rc_mgr)
 {
   std::string& method = params->get("Name", "Mechanics ");
@@ -160,6 +162,12 @@ MechanicsProblem::MechanicsProblem(
 
   this->setNumEquations(num_eq);
 
+  // The Jacobian graph of explicit dynamics is diagonal, and only the lumped
+  // mass of the displacements fits in it
+  ALBANY_ASSERT(
+      explicit_dynamics_ == false || (have_mech_eq_ && num_eq == num_dims_),
+      "Explicit Dynamics supports the displacement equations only");
+
   // Print out a summary of the problem
   *out << "Mechanics problem:" << '\n'
        << "\tSpatial dimension             : " << num_dims_ << '\n'
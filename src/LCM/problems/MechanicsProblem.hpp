@@ -38,6 +38,7 @@ class MechanicsProblem : public AbstractProblem
   ///
   MechanicsProblem(
       Teuchos::RCP<Teuchos::ParameterList> const& params,
+      Teuchos::RCP<Teuchos::ParameterList> const& disc_params,
       Teuchos::RCP<ParamLib> const&               param_lib,
       int const                                   num_dims,
       Teuchos::RCP<AAdapt::rc::Manager> const&    rc_mgr,
@@ -195,6 +196,10 @@ class MechanicsProblem : public AbstractProblem
   /// Boolean marking whether SDBCs are used
   bool use_sdbcs_;
 
+  /// Boolean marking whether the discretization builds the diagonal
+  /// Jacobian graph of explicit dynamics
+  bool explicit_dynamics_;
+
   /// Type of thermal source that is in effect
   SOURCE_TYPE
   thermal_source_;
@@ -23,6 +23,7 @@
 #include "CurrentCoords.hpp"
 #include "MechanicsResidual.hpp"
 #include "MeshSizeField.hpp"
+#include "StableTimeStep.hpp"
 #include "SurfaceBasis.hpp"
 #include "SurfaceScalarGradientOperatorHydroStress.hpp"
 #include "SurfaceScalarGradientOperatorPorePressure.hpp"
@@ -1744,6 +1745,15 @@ MechanicsProblem::constructEvaluators(
           eb_name, "Lump Analytic Mass", false);
       p->set<bool>("Lump Analytic Mass", lump_analytic_mass);
 
+      // Entries off the diagonal graph of explicit dynamics would be
+      // dropped by the scatter without notice
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          explicit_dynamics_ == true &&
+              (use_analytic_mass == false || lump_analytic_mass == false),
+          std::logic_error,
+          "Explicit Dynamics needs 'Use Analytic Mass' and 'Lump Analytic "
+          "Mass' in element block " << eb_name << ".\n");
+
       p->set<Teuchos::RCP<ParamLib>>("Parameter Library", paramLib);
       // Output
       p->set<std::string>("Analytic Mass Name", "Analytic Mass Residual");
@@ -1808,6 +1818,45 @@ MechanicsProblem::constructEvaluators(
           new LCM::MechanicsResidual<EvalT, PHAL::AlbanyTraits>(*p, dl_));
       fm0.template registerEvaluator<EvalT>(ev);
     }  // end if (have_mech_eq_)
+
+    // Optional: critical time step for explicit dynamics
+    bool const compute_stable_dt = material_db_->getElementBlockParam<bool>(
+        eb_name, "Compute Stable Time Step", false);
+
+    if (have_mech_eq_ && compute_stable_dt) {
+      Teuchos::RCP<Teuchos::ParameterList> p =
+          Teuchos::rcp(new Teuchos::ParameterList("Stable Time Step"));
+
+      // Input
+      p->set<std::string>("Current Coordinates Name", "Current Coordinates");
+      p->set<std::string>("Elastic Modulus Name", "Elastic Modulus");
+      p->set<std::string>("Poissons Ratio Name", "Poissons Ratio");
+      p->set<RealType>(
+          "Density",
+          material_db_->getElementBlockParam<RealType>(eb_name, "Density"));
+      p->set<RealType>(
+          "Safety Factor",
+          material_db_->getElementBlockParam<RealType>(
+              eb_name, "Stable Time Step Safety Factor", 1.0));
+
+      // Output
+      p->set<std::string>("Stable Time Step Name", "Stable Time Step");
+      ev = Teuchos::rcp(
+          new LCM::StableTimeStep<EvalT, PHAL::AlbanyTraits>(*p, dl_));
+      fm0.template registerEvaluator<EvalT>(ev);
+
+      p = stateMgr.registerStateVariable(
+          "Stable Time Step",
+          dl_->qp_scalar,
+          dl_->dummy,
+          eb_name,
+          "scalar",
+          0.0,
+          false,
+          true);
+      ev = Teuchos::rcp(new PHAL::SaveStateField<EvalT, PHAL::AlbanyTraits>(*p));
+      fm0.template registerEvaluator<EvalT>(ev);
+    }
   }    // end if(surface_element)
 
   if (have_mech_eq_) {
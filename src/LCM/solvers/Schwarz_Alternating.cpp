@@ -12,6 +12,9 @@
 #include "MiniTensor.h"
 #include "Piro_LOCASolver.hpp"
 #include "Piro_TempusSolver.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+#include <limits>
 
 namespace LCM {
 
@@ -602,6 +605,42 @@ SchwarzAlternating::reportFinals(std::ostream& os) const
   os << std::endl;
 }
 
+//
+// Smallest "Stable Time Step" state over all subdomains and ranks, as last
+// computed by LCM::StableTimeStep, or zero if no element block computes it.
+//
+ST
+SchwarzAlternating::stableTimeStep() const
+{
+  ST local_step = std::numeric_limits<ST>::max();
+
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    auto& state_mgr = apps_[subdomain]->getStateMgr();
+
+    for (auto const& ws_states : state_mgr.getStateArrays().elemStateArrays) {
+      auto const it = ws_states.find("Stable Time Step");
+
+      if (it == ws_states.end()) continue;
+
+      Albany::MDArray const& step = it->second;
+
+      // Zero until the first evaluation
+      for (int i = 0; i < step.size(); ++i) {
+        if (step[i] > 0.0) local_step = std::min(local_step, step[i]);
+      }
+    }
+  }
+
+  ST global_step;
+  Teuchos::reduceAll(
+      *apps_[0]->getComm(),
+      Teuchos::REDUCE_MIN,
+      local_step,
+      Teuchos::ptrFromRef(global_step));
+
+  return global_step < std::numeric_limits<ST>::max() ? global_step : 0.0;
+}
+
 //
 // Schwarz Alternating loop, dynamic
 //
@@ -629,6 +668,15 @@ SchwarzAlternating::SchwarzLoopDynamics() const
 
   // Time-stepping loop
   while (stop < maximum_steps_ && current_time < final_time_) {
+    // Do not step past the stable time step of explicit dynamics
+    ST const stable_step = stableTimeStep();
+
+    if (stable_step > 0.0 && time_step > stable_step) {
+      fos << "INFO: Limiting step from " << time_step << " to stable step ";
+      fos << stable_step << '\n';
+      time_step = stable_step;
+    }
+
     fos << delim << std::endl;
     fos << "Time stop          :" << stop << '\n';
     fos << "Time               :" << current_time << '\n';
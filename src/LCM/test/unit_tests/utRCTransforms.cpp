@@ -0,0 +1,154 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <MiniTensor.h>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <chrono>
+#include <vector>
+#include "AAdapt_RC_Transforms.hpp"
+
+namespace {
+
+typedef minitensor::Tensor<RealType>                   Tensor;
+typedef AAdapt::rc::transforms::Tensor3                Tensor3;
+
+//
+// Deterministic deformation gradients: I + perturbation, det > 0.
+//
+std::vector<Tensor3>
+makeDeformationGradients(int const n, double const amplitude)
+{
+  std::vector<Tensor3> Fs;
+  unsigned int         state = 2718u;
+  while (static_cast<int>(Fs.size()) < n) {
+    Tensor3 F;
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        state = 1103515245u * state + 12345u;
+        double const u =
+            static_cast<double>((state >> 8) % 100000) / 50000.0 - 1.0;
+        F(i, j) = (i == j ? 1.0 : 0.0) + amplitude * u;
+      }
+    }
+    if (minitensor::det(F) > 0.1) Fs.push_back(F);
+  }
+  // Degenerate stretches exercise the clustered-eigenvalue paths.
+  Tensor3 F(minitensor::Filler::ZEROS);
+  for (int i = 0; i < 3; ++i) F(i, i) = 1.0;
+  Fs.push_back(F);
+  F(2, 2) = 1.5;
+  Fs.push_back(F);
+  F(0, 0) = 1.0 + 1.0e-8;
+  Fs.push_back(F);
+  F(0, 1) = 0.3;
+  Fs.push_back(F);
+  return Fs;
+}
+
+//
+// The existing minitensor maps.
+//
+void
+referenceG2g(Tensor3 const& F3, Tensor& r, Tensor& s)
+{
+  Tensor F(3);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) F(i, j) = F3(i, j);
+  std::pair<Tensor, Tensor> RS = minitensor::polar_right(F);
+  r = minitensor::log_rotation(RS.first);
+  s = minitensor::sym(minitensor::log_sym(RS.second));
+}
+
+Tensor
+referenceg2G(Tensor const& r, Tensor const& s)
+{
+  return minitensor::dot(
+      minitensor::exp_skew_symmetric(r), minitensor::sym(minitensor::exp(s)));
+}
+
+template <typename A, typename B>
+double
+maxDifference(A const& a, B const& b)
+{
+  double diff = 0.0;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+  return diff;
+}
+
+TEUCHOS_UNIT_TEST(RCTransforms, AgreeWithMiniTensor)
+{
+  double const tolerance = 1.0e-8;
+
+  for (Tensor3 const& F : makeDeformationGradients(500, 0.4)) {
+    Tensor3 r, s;
+    AAdapt::rc::transforms::right_polar_LieR_LieS_G2g(F, r, s);
+    Tensor r_ref, s_ref;
+    referenceG2g(F, r_ref, s_ref);
+    TEST_COMPARE(maxDifference(r, r_ref), <=, tolerance);
+    TEST_COMPARE(maxDifference(s, s_ref), <=, tolerance);
+
+    // Round trip, and against the reference inverse map.
+    Tensor3 const F_rt =
+        AAdapt::rc::transforms::right_polar_LieR_LieS_g2G(r, s);
+    TEST_COMPARE(maxDifference(F_rt, F), <=, tolerance);
+    TEST_COMPARE(maxDifference(F_rt, referenceg2G(r_ref, s_ref)), <=, tolerance);
+  }
+}
+
+TEUCHOS_UNIT_TEST(RCTransforms, Batched)
+{
+  double const tolerance = 1.0e-8;
+  int const    num_cells = 2000;
+  int const    num_qps   = 8;
+
+  std::vector<Tensor3> const Fs =
+      makeDeformationGradients(num_cells * num_qps, 0.4);
+
+  std::vector<double> data1(num_cells * num_qps * 9);
+  std::vector<double> data2(num_cells * num_qps * 9);
+  Albany::MDArray     mda1(data1.data(), num_cells, num_qps, 3, 3);
+  Albany::MDArray     mda2(data2.data(), num_cells, num_qps, 3, 3);
+  for (int cell = 0; cell < num_cells; ++cell)
+    for (int qp = 0; qp < num_qps; ++qp)
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          mda2(cell, qp, i, j) = Fs[cell * num_qps + qp](i, j);
+
+  auto const start = std::chrono::high_resolution_clock::now();
+  AAdapt::rc::transforms::right_polar_LieR_LieS_G2g(mda1, mda2);
+  AAdapt::rc::transforms::right_polar_LieR_LieS_g2G(mda1, mda2);
+  auto const stop = std::chrono::high_resolution_clock::now();
+
+  auto const ref_start = std::chrono::high_resolution_clock::now();
+  for (int k = 0; k < num_cells * num_qps; ++k) {
+    Tensor r, s;
+    referenceG2g(Fs[k], r, s);
+    referenceg2G(r, s);
+  }
+  auto const ref_stop = std::chrono::high_resolution_clock::now();
+
+  for (int cell = 0; cell < num_cells; ++cell)
+    for (int qp = 0; qp < num_qps; ++qp)
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+          TEST_COMPARE(
+              std::abs(mda1(cell, qp, i, j) - Fs[cell * num_qps + qp](i, j)),
+              <=,
+              tolerance);
+
+  double const time = std::chrono::duration<double>(stop - start).count();
+  double const ref_time =
+      std::chrono::duration<double>(ref_stop - ref_start).count();
+  out << "G2g + g2G on " << num_cells * num_qps << " points: minitensor "
+      << ref_time << " s, closed form " << time << " s, speedup "
+      << ref_time / time << "\n";
+}
+
+}  // namespace
@@ -8,6 +8,7 @@
 
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
+#include <chrono>
 #ifdef ALBANY_EPETRA
 #include <Epetra_MpiComm.h>
 #endif
@@ -1684,4 +1685,94 @@ TEUCHOS_UNIT_TEST(SurfaceElement, Complete)
   }
   std::cout << std::endl;
 }
+TEUCHOS_UNIT_TEST(SurfaceElement, BasisScaling)
+{
+  // The surface basis must be computed in time linear in the number of
+  // cohesive elements per workset. Replicate the unit cohesive element of
+  // the Basis test across worksets of increasing size, check every cell
+  // and report the time per element.
+  const int numQPts     = 4;
+  const int numDim      = 3;
+  const int numVertices = 8;
+  const int numNodes    = 8;
+  const int numRepeats  = 10;
+
+  double const elementCoords[24] = {-0.5, 0.0, -0.5, -0.5, 0.0, 0.5,
+                                    0.5,  0.0, 0.5,  0.5,  0.0, -0.5,
+                                    -0.5, 0.0, -0.5, -0.5, 0.0, 0.5,
+                                    0.5,  0.0, 0.5,  0.5,  0.0, -0.5};
+
+  RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> intrepidBasis =
+      rcp(new Intrepid2::
+              Basis_HGRAD_QUAD_C1_FEM<PHX::Device, RealType, RealType>());
+  RCP<CT> cellType =
+      rcp(new CT(shards::getCellTopologyData<shards::Quadrilateral<4>>()));
+  Intrepid2::DefaultCubatureFactory     cubFactory;
+  RCP<Intrepid2::Cubature<PHX::Device>> cubature =
+      cubFactory.create<PHX::Device, RealType, RealType>(*cellType, 3);
+
+  for (int worksetSize = 10; worksetSize <= 10000; worksetSize *= 10) {
+    const RCP<Albany::Layouts> dl = rcp(new Albany::Layouts(
+        worksetSize, numVertices, numNodes, numQPts, numDim));
+
+    ArrayRCP<ScalarT> coords(worksetSize * numNodes * numDim);
+    for (int cell = 0; cell < worksetSize; ++cell)
+      for (int i = 0; i < numNodes * numDim; ++i)
+        coords[cell * numNodes * numDim + i] = elementCoords[i];
+
+    Teuchos::ParameterList rcPL;
+    rcPL.set<std::string>("Evaluated Field Name", "Reference Coordinates");
+    rcPL.set<ArrayRCP<ScalarT>>("Field Values", coords);
+    rcPL.set<RCP<PHX::DataLayout>>(
+        "Evaluated Field Data Layout", dl->vertices_vector);
+    RCP<LCM::SetField<Residual, Traits>> setFieldRefCoords =
+        rcp(new LCM::SetField<Residual, Traits>(rcPL));
+
+    Teuchos::ParameterList sbPL;
+    sbPL.set<std::string>(
+        "Reference Coordinates Name", "Reference Coordinates");
+    sbPL.set<std::string>("Reference Basis Name", "Reference Basis");
+    sbPL.set<std::string>("Reference Dual Basis Name", "Reference Dual Basis");
+    sbPL.set<std::string>("Reference Normal Name", "Reference Normal");
+    sbPL.set<std::string>("Reference Area Name", "Reference Area");
+    sbPL.set<RCP<Intrepid2::Cubature<PHX::Device>>>("Cubature", cubature);
+    sbPL.set<RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>>>(
+        "Intrepid2 Basis", intrepidBasis);
+    RCP<LCM::SurfaceBasis<Residual, Traits>> sb =
+        rcp(new LCM::SurfaceBasis<Residual, Traits>(sbPL, dl));
+
+    PHX::FieldManager<Traits> fieldManager;
+    fieldManager.registerEvaluator<Residual>(setFieldRefCoords);
+    fieldManager.registerEvaluator<Residual>(sb);
+    for (auto const& tag : sb->evaluatedFields())
+      fieldManager.requireField<Residual>(*tag);
+
+    PHAL::Setup setupData;
+    fieldManager.postRegistrationSetup(setupData);
+
+    PHAL::Workset workset;
+    workset.numCells = worksetSize;
+
+    auto const start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < numRepeats; ++r) {
+      fieldManager.preEvaluate<Residual>(workset);
+      fieldManager.evaluateFields<Residual>(workset);
+      fieldManager.postEvaluate<Residual>(workset);
+    }
+    Kokkos::fence();
+    auto const   stop    = std::chrono::high_resolution_clock::now();
+    double const seconds = std::chrono::duration<double>(stop - start).count();
+
+    PHX::MDField<ScalarT, Cell, QuadPoint> refArea(
+        "Reference Area", dl->qp_scalar);
+    fieldManager.getFieldData<Residual>(refArea);
+    for (size_type cell = 0; cell < worksetSize; ++cell)
+      for (size_type pt = 0; pt < numQPts; ++pt)
+        TEST_COMPARE(fabs(refArea(cell, pt) - 0.25), <=, 1.0e-15);
+
+    out << "SurfaceBasis: " << worksetSize << " cohesive elements, "
+        << 1.0e6 * seconds / (numRepeats * worksetSize)
+        << " microseconds per element\n";
+  }
+}
 }  // namespace
@@ -10,6 +10,10 @@
 #include "PHAL_ScatterResidual.hpp"
 #include "PHAL_AlbanyTraits.hpp"
 
+#include <map>
+#include <utility>
+#include <vector>
+
 namespace PHAL {
 /** \brief Scatters result from the residual fields into the
     global (epetra) data structurs.  This includes the
@@ -60,6 +64,25 @@ private:
   std::string meshPart;
   Teuchos::RCP<const CellTopologyData> cell_topo;
   typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  // The coupling of a side with the whole column of dofs above it only
+  // depends on the mesh, so the local column indices of each side (and
+  // the rows that get a unit diagonal) are computed the first time a
+  // workset is evaluated, and reused afterwards. The discretization rebuilds
+  // its vector spaces whenever the mesh changes, so the overlapped solution
+  // space the indices refer to identifies the version of the mesh.
+  struct ColumnsData {
+    Teuchos::RCP<const Thyra_VectorSpace> ov_vs;  // space of the local ids below
+    std::vector<std::pair<int,int>> sides;  // (elem_LID, side_local_id)
+    std::vector<int>                offsets;  // sides[i] columns are lcols[offsets[i]:offsets[i+1]]
+    Teuchos::Array<LO>              lcols;
+    Teuchos::Array<LO>              diagRows;
+  };
+
+  const ColumnsData& getColumnsData (typename Traits::EvalData workset,
+                                     const std::vector<Albany::SideStruct>& sideSet);
+
+  std::map<int,ColumnsData> wsColumnsData;
 };
 
 // **************************************************************
@@ -4,6 +4,8 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 
@@ -44,6 +46,76 @@ ScatterResidual2D(const Teuchos::ParameterList& p,
   meshPart = p.get<std::string>("Mesh Part");
 }
 
+// **********************************************************************
+template<typename Traits>
+const typename ScatterResidual2D<PHAL::AlbanyTraits::Jacobian, Traits>::ColumnsData&
+ScatterResidual2D<PHAL::AlbanyTraits::Jacobian, Traits>::
+getColumnsData(typename Traits::EvalData workset,
+               const std::vector<Albany::SideStruct>& sideSet)
+{
+  ColumnsData& data = wsColumnsData[workset.wsIndex];
+  const Teuchos::RCP<const Thyra_VectorSpace> ov_vs = workset.disc->getOverlapVectorSpace();
+
+  // Check the cached data still refers to the same mesh and the same sides
+  bool upToDate = data.ov_vs.get()==ov_vs.get() && data.sides.size()==sideSet.size();
+  for (std::size_t iSide = 0; upToDate && iSide < sideSet.size(); ++iSide) {
+    upToDate = data.sides[iSide].first==static_cast<int>(sideSet[iSide].elem_LID) &&
+               data.sides[iSide].second==static_cast<int>(sideSet[iSide].side_local_id);
+  }
+  if (upToDate) {
+    return data;
+  }
+
+  const int neq = workset.wsElNodeEqID.extent(2);
+  const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
+  const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
+  const int numLayers = layeredMeshNumbering.numLayers;
+  const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
+  auto indexer = Albany::createGlobalLocalIndexer(workset.disc->getOverlapNodeVectorSpace());
+
+  data.ov_vs = ov_vs;
+  data.sides.resize(sideSet.size());
+  data.offsets.resize(sideSet.size()+1);
+  data.lcols.clear();
+  data.diagRows.clear();
+  data.offsets[0] = 0;
+
+  for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) {
+    const int elem_LID = sideSet[iSide].elem_LID;
+    const int elem_side = sideSet[iSide].side_local_id;
+    const CellTopologyData_Subcell& side =  this->cell_topo->side[elem_side];
+    const int numSideNodes = side.topology->node_count;
+    const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[elem_LID];
+
+    data.sides[iSide] = std::make_pair(elem_LID,elem_side);
+    const int offset = data.offsets[iSide];
+    data.offsets[iSide+1] = offset + neq*numSideNodes*(numLayers+1);
+    data.lcols.resize(data.offsets[iSide+1]);
+
+    LO base_id, ilayer;
+    for (int i = 0; i < numSideNodes; ++i) {
+      std::size_t node = side.node[i];
+      LO lnodeId = indexer->getLocalElement(elNodeID[node]);
+      layeredMeshNumbering.getIndices(lnodeId, base_id, ilayer);
+      for (int il_col=0; il_col<numLayers+1; il_col++) {
+        LO inode = layeredMeshNumbering.getId(base_id, il_col);
+        for (int eq_col=0; eq_col<neq; eq_col++) {
+          data.lcols[offset + il_col*neq*numSideNodes + neq*i + eq_col] = solDOFManager.getLocalDOF(inode, eq_col);
+        }
+        if(il_col != fieldLevel) {
+          data.diagRows.push_back(solDOFManager.getLocalDOF(inode, this->offset));
+        }
+      }
+    }
+  }
+
+  // Neighboring sides share the column of their common nodes: set each diagonal only once
+  std::sort(data.diagRows.begin(),data.diagRows.end());
+  data.diagRows.erase(std::unique(data.diagRows.begin(),data.diagRows.end()),data.diagRows.end());
+
+  return data;
+}
+
 // **********************************************************************
 template<typename Traits>
 void ScatterResidual2D<PHAL::AlbanyTraits::Jacobian, Traits>::
@@ -51,21 +123,12 @@ evaluateFields(typename Traits::EvalData workset)
 {
   auto nodeID = workset.wsElNodeEqID;
   const bool loadResid = Teuchos::nonnull(workset.f);
-  Teuchos::Array<LO> lcols;
-  const int neq = nodeID.extent(2);
   int numDim = 0;
   if (this->tensorRank==2) {
     numDim = this->valTensor.extent(2);
   }
   double diagonal_value = 1;
 
-  const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-  const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
-  int numLayers = layeredMeshNumbering.numLayers;
-  lcols.reserve(neq*this->numNodes*(numLayers+1));
-
-  const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-
   if (workset.sideSets == Teuchos::null) {
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Side sets not properly specified on the mesh" << std::endl);
   }
@@ -81,10 +144,14 @@ evaluateFields(typename Traits::EvalData workset)
 
   if (it != ssList.end()) {
     const std::vector<Albany::SideStruct>& sideSet = it->second;
+    const ColumnsData& columns = getColumnsData(workset,sideSet);
 
-    auto indexer = Albany::createGlobalLocalIndexer(workset.disc->getOverlapNodeVectorSpace());
-    // Loop over the sides that form the boundary condition
+    // Unit diagonal on the rows of the 2D field away from its level
+    for (const LO lrow : columns.diagRows) {
+      Albany::setLocalRowValues(Jac,lrow,Teuchos::arrayView(&lrow,1), Teuchos::arrayView(&diagonal_value,1));
+    }
 
+    // Loop over the sides that form the boundary condition
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
       // Get the data that corresponds to the side
       const int elem_LID = sideSet[iSide].elem_LID;
@@ -92,25 +159,9 @@ evaluateFields(typename Traits::EvalData workset)
       const CellTopologyData_Subcell& side =  this->cell_topo->side[elem_side];
       int numSideNodes = side.topology->node_count;
 
-      lcols.resize(neq*numSideNodes*(numLayers+1));
-      const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[elem_LID];
-
-      LO base_id, ilayer;
-      for (int i = 0; i < numSideNodes; ++i) {
-        std::size_t node = side.node[i];
-        LO lnodeId = indexer->getLocalElement(elNodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, base_id, ilayer);
-        for (int il_col=0; il_col<numLayers+1; il_col++) {
-          LO inode = layeredMeshNumbering.getId(base_id, il_col);
-          for (unsigned int eq_col=0; eq_col<neq; eq_col++) {
-            lcols[il_col*neq*numSideNodes + neq*i + eq_col] = solDOFManager.getLocalDOF(inode, eq_col);
-          }
-          if(il_col != fieldLevel) {
-            const LO lrow = solDOFManager.getLocalDOF(inode, this->offset); //insert diagonal values
-            Albany::setLocalRowValues(Jac,lrow,Teuchos::arrayView(&lrow,1), Teuchos::arrayView(&diagonal_value,1));
-          }
-        }
-      }
+      const int offset = columns.offsets[iSide];
+      const int numCols = columns.offsets[iSide+1] - offset;
+      Teuchos::ArrayView<const LO> lcols = columns.lcols(offset,numCols);
 
       for (int i = 0; i < numSideNodes; ++i) {
         std::size_t node = side.node[i];
@@ -124,7 +175,7 @@ evaluateFields(typename Traits::EvalData workset)
             f_data[lrow] += valptr.val();
           }
           if (valptr.hasFastAccess()) {
-            Albany::addToLocalRowValues(Jac,lrow,lcols(), Teuchos::arrayView(&(valptr.fastAccessDx(0)),lcols.size()));
+            Albany::addToLocalRowValues(Jac,lrow,lcols, Teuchos::arrayView(&(valptr.fastAccessDx(0)),numCols));
           } // has fast access
         }
       }
@@ -140,33 +140,13 @@ CismSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params,
   if (dirichlet_node_mask_Ptr != NULL) have_dirichlet = true; 
   else have_dirichlet = false; 
 
-  for (int i=0; i<NumNodes; i++){
+  for (int i=0; i<NumNodes; i++)
     globalNodesID[i] = global_node_id_owned_map_Ptr[i]-1;
-    for (int j=0; j<3; j++)
-      xyz[i][j] = xyz_at_nodes_Ptr[i + NumNodes*j];
-    //*out << "i: " << i << ", x: " << xyz[i][0] 
-         //<< ", y: " << xyz[i][1] << ", z: " << xyz[i][2] << std::endl;
-  }
-  if (have_sh) {
-    for (int i=0; i<NumNodes; i++)
-      sh[i] = surf_height_at_nodes_Ptr[i];
-  }
-  if (have_thck) {
-    for (int i=0; i<NumNodes; i++)
-      thck[i] = thick_at_nodes_Ptr[i];
-  }
-  if (have_shGrad) {
-    for (int i=0; i<NumNodes; i++){
-      shGrad[i][0] = dsurf_height_at_nodes_dx_Ptr[i];
-      shGrad[i][1] = dsurf_height_at_nodes_dy_Ptr[i];
-    }
-  }
-  if (have_beta) {
-    for (int i=0; i<NumNodes; i++) {
-      beta[i] = beta_at_nodes_Ptr[i];
-      //*out << "beta[i] " << beta[i] << std::endl;
-    }
-  }
+
+  copyFieldArrays(xyz_at_nodes_Ptr, uvel_at_nodes_Ptr, vvel_at_nodes_Ptr,
+                  beta_at_nodes_Ptr, surf_height_at_nodes_Ptr,
+                  dsurf_height_at_nodes_dx_Ptr, dsurf_height_at_nodes_dy_Ptr,
+                  thick_at_nodes_Ptr, flwa_at_active_elements_Ptr);
 
   for (int i=0; i<NumEles; i++) {
     globalElesID[i] = global_element_id_active_owned_map_Ptr[i]-1;
@@ -180,21 +160,10 @@ CismSTKMeshStruct(const Teuchos::RCP<Teuchos::ParameterList>& params,
   if (have_dirichlet) {
     for (int i=0; i<NumNodes; i++) {
       dirichletNodeMask[i] = dirichlet_node_mask_Ptr[i];
-      uvel[i] = uvel_at_nodes_Ptr[i]; 
-      vvel[i] = vvel_at_nodes_Ptr[i]; 
       //*out << "i: " << i << ", x: " << xyz[i][0] 
       //     << ", y: " << xyz[i][1] << ", z: " << xyz[i][2] << ", dirichlet: " << dirichletNodeMask[i] << std::endl;
-      /*if (abs(uvel[i]) > 0) {
-      *out << "i: " << i << ", x: " << xyz[i][0] 
-           << ", y: " << xyz[i][1] << ", z: " << xyz[i][2] << ", uvel: " << uvel[i] << ", vvel: " << vvel[i] << std::endl;
-      }*/
     }
   }
-
-  if (have_flwa) {
-    for (int i=0; i<NumEles; i++)
-      flwa[i] = flwa_at_active_elements_Ptr[i];
-  }
   if (have_bf) {
     for (int i=0; i<NumBasalFaces; i++) {
       basalFacesID[i] = global_basal_face_active_owned_map_Ptr[i]-1;
@@ -448,11 +417,7 @@ constructMesh(const Teuchos::RCP<const Teuchos_Comm>& comm,
        //Fill temperature field from flowRate
        //For CISM-Albany runs, flowRate will always be passed, not temperature.  
        double *temperature = stk::mesh::field_data(*temperature_field, elem);
-       //This is the inverse of the temperature-flowRate relationship; see LandIce_ViscosityFO_Def.hpp .
-       if (flwa[i] < 1.4e-05)
-         temperature[0] = 6.0e4/log(1.13939568e7/flwa[i])/8.314;
-       else 
-         temperature[0] = 1.39e5/log(5.4651888e22/flwa[i])/8.314;
+       temperature[0] = flowFactorToTemperature(flwa[i]);
      }
      
   }
@@ -621,6 +586,124 @@ constructMesh(const Teuchos::RCP<const Teuchos_Comm>& comm,
   bulkData->modification_end();
 }
 
+void CismSTKMeshStruct::
+updateFieldData(const double * xyz_at_nodes_Ptr,
+                const double * uvel_at_nodes_Ptr,
+                const double * vvel_at_nodes_Ptr,
+                const double * beta_at_nodes_Ptr,
+                const double * surf_height_at_nodes_Ptr,
+                const double * dsurf_height_at_nodes_dx_Ptr,
+                const double * dsurf_height_at_nodes_dy_Ptr,
+                const double * thick_at_nodes_Ptr,
+                const double * flwa_at_active_elements_Ptr)
+{
+  copyFieldArrays(xyz_at_nodes_Ptr, uvel_at_nodes_Ptr, vvel_at_nodes_Ptr,
+                  beta_at_nodes_Ptr, surf_height_at_nodes_Ptr,
+                  dsurf_height_at_nodes_dx_Ptr, dsurf_height_at_nodes_dy_Ptr,
+                  thick_at_nodes_Ptr, flwa_at_active_elements_Ptr);
+
+  typedef AbstractSTKFieldContainer::ScalarFieldType ScalarFieldType;
+  typedef AbstractSTKFieldContainer::VectorFieldType VectorFieldType;
+
+  VectorFieldType* coordinates_field = fieldContainer->getCoordinatesField();
+  ScalarFieldType* surfaceHeight_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "surface_height");
+  ScalarFieldType* thickness_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "ice_thickness");
+  ScalarFieldType* dsurfaceHeight_dx_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "xgrad_surface_height");
+  ScalarFieldType* dsurfaceHeight_dy_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "ygrad_surface_height");
+  ScalarFieldType* flowFactor_field = metaData->get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, "flow_factor");
+  ScalarFieldType* temperature_field = metaData->get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, "temperature");
+  ScalarFieldType* basal_friction_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "basal_friction");
+  VectorFieldType* dirichlet_field = metaData->get_field<VectorFieldType>(stk::topology::NODE_RANK, "dirichlet_field");
+
+  auto elem_vs_indexer = Albany::createGlobalLocalIndexer(elem_vs);
+  auto node_vs_indexer = Albany::createGlobalLocalIndexer(node_vs);
+
+  //Same loop as in constructMesh, but on the entities that already exist.
+  for (LO i=0; i<elem_vs_indexer->getNumLocalElements(); i++) {
+     const GO elem_GID = elem_vs_indexer->getGlobalElement(i);
+     stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEMENT_RANK, 1+elem_GID);
+     for (int j=0; j<8; j++) {
+       stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, eles[i][j]);
+       const LO node_LID = node_vs_indexer->getLocalElement(eles[i][j]-1);
+       double* coord = stk::mesh::field_data(*coordinates_field, node);
+       coord[0] = xyz[node_LID][0];   coord[1] = xyz[node_LID][1];   coord[2] = xyz[node_LID][2];
+       if (have_sh)
+         stk::mesh::field_data(*surfaceHeight_field, node)[0] = sh[node_LID];
+       if (have_thck)
+         stk::mesh::field_data(*thickness_field, node)[0] = thck[node_LID];
+       if (have_shGrad) {
+         stk::mesh::field_data(*dsurfaceHeight_dx_field, node)[0] = shGrad[node_LID][0];
+         stk::mesh::field_data(*dsurfaceHeight_dy_field, node)[0] = shGrad[node_LID][1];
+       }
+       if (have_dirichlet) {
+         double* dirichlet = stk::mesh::field_data(*dirichlet_field,node);
+         dirichlet[0] = uvel[node_LID];
+         dirichlet[1] = vvel[node_LID];
+       }
+       if (have_beta)
+         stk::mesh::field_data(*basal_friction_field, node)[0] = beta[node_LID];
+     }
+     if (have_flwa) {
+       stk::mesh::field_data(*flowFactor_field, elem)[0] = flwa[i];
+       stk::mesh::field_data(*temperature_field, elem)[0] = flowFactorToTemperature(flwa[i]);
+     }
+  }
+}
+
+void CismSTKMeshStruct::
+copyFieldArrays(const double * xyz_at_nodes_Ptr,
+                const double * uvel_at_nodes_Ptr,
+                const double * vvel_at_nodes_Ptr,
+                const double * beta_at_nodes_Ptr,
+                const double * surf_height_at_nodes_Ptr,
+                const double * dsurf_height_at_nodes_dx_Ptr,
+                const double * dsurf_height_at_nodes_dy_Ptr,
+                const double * thick_at_nodes_Ptr,
+                const double * flwa_at_active_elements_Ptr)
+{
+  for (int i=0; i<NumNodes; i++) {
+    for (int j=0; j<3; j++)
+      xyz[i][j] = xyz_at_nodes_Ptr[i + NumNodes*j];
+  }
+  if (have_sh) {
+    for (int i=0; i<NumNodes; i++)
+      sh[i] = surf_height_at_nodes_Ptr[i];
+  }
+  if (have_thck) {
+    for (int i=0; i<NumNodes; i++)
+      thck[i] = thick_at_nodes_Ptr[i];
+  }
+  if (have_shGrad) {
+    for (int i=0; i<NumNodes; i++){
+      shGrad[i][0] = dsurf_height_at_nodes_dx_Ptr[i];
+      shGrad[i][1] = dsurf_height_at_nodes_dy_Ptr[i];
+    }
+  }
+  if (have_beta) {
+    for (int i=0; i<NumNodes; i++)
+      beta[i] = beta_at_nodes_Ptr[i];
+  }
+  if (have_dirichlet) {
+    for (int i=0; i<NumNodes; i++) {
+      uvel[i] = uvel_at_nodes_Ptr[i];
+      vvel[i] = vvel_at_nodes_Ptr[i];
+    }
+  }
+  if (have_flwa) {
+    for (int i=0; i<NumEles; i++)
+      flwa[i] = flwa_at_active_elements_Ptr[i];
+  }
+}
+
+double CismSTKMeshStruct::
+flowFactorToTemperature(const double flowFactor)
+{
+  //This is the inverse of the temperature-flowRate relationship; see LandIce_ViscosityFO_Def.hpp .
+  if (flowFactor < 1.4e-05)
+    return 6.0e4/log(1.13939568e7/flowFactor)/8.314;
+  return 1.39e5/log(5.4651888e22/flowFactor)/8.314;
+}
+
 Teuchos::RCP<const Teuchos::ParameterList>
 CismSTKMeshStruct::getValidDiscretizationParameters() const
 {
@@ -78,6 +78,20 @@ namespace Albany {
                   const unsigned int worksetSize);
 
 
+    //! Overwrite coordinates and input fields on the existing mesh, e.g., when
+    //! CISM advances the geometry but the active extent (elements, faces and
+    //! Dirichlet nodes) is the same the mesh was constructed with.
+    void updateFieldData(
+                  const double * xyz_at_nodes_Ptr, 
+                  const double * uvel_at_nodes_Ptr, 
+                  const double * vvel_at_nodes_Ptr, 
+                  const double * beta_at_nodes_Ptr, 
+                  const double * surf_height_at_nodes_Ptr, 
+                  const double * dsurf_height_at_nodes_dx_Ptr, 
+                  const double * dsurf_height_at_nodes_dy_Ptr, 
+                  const double * thick_at_nodes_Ptr, 
+                  const double * flwa_at_active_elements_Ptr);
+
     //! Flag if solution has a restart values -- used in Init Cond
     bool hasRestartSolution() const {return hasRestartSol; }
 
@@ -143,6 +157,17 @@ namespace Albany {
     bool hasRestartSol;
     double restartTime;
     int debug_output_verbosity; 
+    void copyFieldArrays(
+                  const double * xyz_at_nodes_Ptr, 
+                  const double * uvel_at_nodes_Ptr, 
+                  const double * vvel_at_nodes_Ptr, 
+                  const double * beta_at_nodes_Ptr, 
+                  const double * surf_height_at_nodes_Ptr, 
+                  const double * dsurf_height_at_nodes_dx_Ptr, 
+                  const double * dsurf_height_at_nodes_dy_Ptr, 
+                  const double * thick_at_nodes_Ptr, 
+                  const double * flwa_at_active_elements_Ptr);
+    static double flowFactorToTemperature(const double flowFactor);
     void resizeVec(std::vector<std::vector<double> > &vec , const unsigned int rows , const unsigned int columns); 
     void resizeVec(std::vector<std::vector<int> > &vec , const unsigned int rows , const unsigned int columns); 
     
@@ -24,6 +24,7 @@
 #include "Albany_Utils.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Albany_OrdinarySTKFieldContainer.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
 
 //#include "Teuchos_TestForException.hpp"
 #include <Teuchos_XMLParameterListHelpers.hpp>
@@ -83,7 +84,6 @@ long nWestFacesActive, nEastFacesActive, nSouthFacesActive, nNorthFacesActive;
 long debug_output_verbosity;
 long use_glissade_surf_height_grad;
 int nNodes, nElementsActive;
-//int nElementsActivePrevious = 0;
 double* xyz_at_nodes_Ptr, *surf_height_at_nodes_Ptr, *beta_at_nodes_Ptr, *thick_at_nodes_Ptr;
 double* dsurf_height_at_nodes_dx_Ptr, *dsurf_height_at_nodes_dy_Ptr;
 double *flwa_at_active_elements_Ptr;
@@ -111,7 +111,16 @@ bool first_time_step = true;
 
 Teuchos::RCP<const Thyra_VectorSpace> nodeVS;
 
-//Teuchos::RCP<Tpetra_Vector> previousSolution;
+//Active extent (node/element/face IDs, connectivity and Dirichlet mask) that the
+//current Albany application was built on. If CISM passes the same extent at the
+//next time step, the application, its discretization and the solver are kept and
+//only coordinates and input fields are updated on the existing mesh.
+std::vector<int> activeExtent;
+bool albanyAppReusable = false;
+bool reuseAlbanyApp = false;
+Teuchos::RCP<Albany::CombineAndScatterManager> cas_manager;
+Teuchos::RCP<Thyra_Vector> solutionOverlap;
+
 bool keep_proc = true;
 const GO INVALID = Teuchos::OrdinalTraits<GO>::invalid();
 
@@ -135,6 +144,44 @@ void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id) {
 }
 
 
+void appendActiveExtent(std::vector<int>& extent, const int* ptr, long size) {
+  extent.push_back(ptr != NULL ? size : -1);
+  if (ptr != NULL)
+    extent.insert(extent.end(), ptr, ptr + size);
+}
+
+std::vector<int> computeActiveExtent() {
+  const long nNodesLocal = (ewn-2*nhalo+1)*(nsn-2*nhalo+1)*upn;
+  const long nElemsLocal = nCellsActive*(upn-1);
+  std::vector<int> extent;
+  appendActiveExtent(extent, global_node_id_owned_map_Ptr, nNodesLocal);
+  appendActiveExtent(extent, global_element_id_active_owned_map_Ptr, nElemsLocal);
+  appendActiveExtent(extent, global_element_conn_active_Ptr, 8*nElemsLocal);
+  appendActiveExtent(extent, global_basal_face_id_active_owned_map_Ptr, nCellsActive);
+  appendActiveExtent(extent, global_basal_face_conn_active_Ptr, 5*nCellsActive);
+  appendActiveExtent(extent, global_top_face_id_active_owned_map_Ptr, nCellsActive);
+  appendActiveExtent(extent, global_top_face_conn_active_Ptr, 5*nCellsActive);
+  appendActiveExtent(extent, global_west_face_id_active_owned_map_Ptr, nWestFacesActive);
+  appendActiveExtent(extent, global_west_face_conn_active_Ptr, 5*nWestFacesActive);
+  appendActiveExtent(extent, global_east_face_id_active_owned_map_Ptr, nEastFacesActive);
+  appendActiveExtent(extent, global_east_face_conn_active_Ptr, 5*nEastFacesActive);
+  appendActiveExtent(extent, global_south_face_id_active_owned_map_Ptr, nSouthFacesActive);
+  appendActiveExtent(extent, global_south_face_conn_active_Ptr, 5*nSouthFacesActive);
+  appendActiveExtent(extent, global_north_face_id_active_owned_map_Ptr, nNorthFacesActive);
+  appendActiveExtent(extent, global_north_face_conn_active_Ptr, 5*nNorthFacesActive);
+  appendActiveExtent(extent, dirichlet_node_mask_Ptr, nNodesLocal);
+  return extent;
+}
+
+//The application can be kept only if the active extent is unchanged on all the procs.
+bool activeExtentUnchanged(const std::vector<int>& extent) {
+  int localSame = (albanyAppReusable && extent == activeExtent) ? 1 : 0;
+  int globalSame;
+  MPI_Allreduce(&localSame, &globalSame, 1, MPI_INT, MPI_MIN, comm);
+  return globalSame == 1;
+}
+
+
 extern "C" void ali_driver_();
 
 //What is exec_mode??
@@ -275,6 +322,31 @@ void ali_driver_init(int /* argc */, int /* exec_mode */, AliToGlimmer * ftg_ptr
     uvel_at_nodes_Ptr = ftg_ptr ->getDoubleVar("uvel_at_nodes", "velocity");
     vvel_at_nodes_Ptr = ftg_ptr ->getDoubleVar("vvel_at_nodes", "velocity");
 
+    // ---------------------------------------------
+    // If the active ice extent has not changed since the last step, keep the Albany
+    // application (discretization, graphs, field managers and solver) and only update
+    // coordinates and input fields in place.
+    // ---------------------------------------------
+    std::vector<int> extent = computeActiveExtent();
+    reuseAlbanyApp = activeExtentUnchanged(extent);
+    if (reuseAlbanyApp) {
+      if (debug_output_verbosity != 0 & mpiCommT->getRank() == 0)
+        std::cout << "In ali_driver: active extent unchanged, updating fields of the existing Albany mesh..." << std::endl;
+      if (keep_proc) {
+        meshStruct->updateFieldData(xyz_at_nodes_Ptr, uvel_at_nodes_Ptr, vvel_at_nodes_Ptr,
+                                    beta_at_nodes_Ptr, surf_height_at_nodes_Ptr,
+                                    dsurf_height_at_nodes_dx_Ptr, dsurf_height_at_nodes_dy_Ptr,
+                                    thick_at_nodes_Ptr, flwa_at_active_elements_Ptr);
+      }
+      return;
+    }
+    activeExtent.swap(extent);
+    meshStruct = Teuchos::null;
+    albanyApp = Teuchos::null;
+    solver = Teuchos::null;
+    cas_manager = Teuchos::null;
+    solutionOverlap = Teuchos::null;
+
 //If requesting to do solve only on procs with > 0 elements, create reduced comm
 #ifdef REDUCED_COMM
     if (debug_output_verbosity != 0 & mpiCommT->getRank() == 0)
@@ -327,6 +399,8 @@ void ali_driver_init(int /* argc */, int /* exec_mode */, AliToGlimmer * ftg_ptr
     }
 
     parameterList = Teuchos::rcp(&slvrfctry->getParameters(),false);
+    //When the application is kept across time steps, start each solve from the previous solution.
+    parameterList->set("Overwrite Nominal Values With Final Point", true);
     discParams = Teuchos::sublist(parameterList, "Discretization", true);
     discParams->set<bool>("Output DTK Field to Exodus", true);
     Albany::AbstractFieldContainer::FieldContainerRequirements req;
@@ -648,19 +722,21 @@ void ali_driver_run(AliToGlimmer * ftg_ptr, double& cur_time_yr, double time_inc
        }
     }
 
-    albanyApp->createDiscretization();
-    albanyApp->finalSetUp(parameterList);
-
-    //IK, 10/30/14: Check that # of elements from previous time step hasn't changed.
-    //If it has not, use previous solution as initial guess for current time step.
-    //Otherwise do not set initial solution.  It's possible this can be improved so some part of the previous solution is used
-    //defined on the current mesh (if it receded, which likely it will in dynamic ice sheet simulations...).
-    //if (nElementsActivePrevious != nElementsActive) previousSolution = Teuchos::null;
-    //albanyApp->finalSetUp(parameterList, previousSolution);
-
-    //if (!first_time_step)
-    //  std::cout << "previousSolution: " << *previousSolution << std::endl;
-    solver = slvrfctry->createAndGetAlbanyApp(albanyApp, reducedMpiCommT, reducedMpiCommT, Teuchos::null, false);
+    if (!reuseAlbanyApp) {
+      albanyApp->createDiscretization();
+      albanyApp->finalSetUp(parameterList);
+      solver = slvrfctry->createAndGetAlbanyApp(albanyApp, reducedMpiCommT, reducedMpiCommT, Teuchos::null, false);
+    }
+    else {
+      //Coordinates and mesh fields were updated in place by ali_driver_init; only the
+      //distributed parameter copy of the Dirichlet field needs to be refreshed.
+      //The solver warm-starts from the solution of the previous step.
+      auto distParamLib = albanyApp->getDistributedParameterLibrary();
+      if (distParamLib->has("dirichlet_field")) {
+        albanyApp->getDiscretization()->getField(*distParamLib->get("dirichlet_field")->vector(), "dirichlet_field");
+        distParamLib->get("dirichlet_field")->scatter();
+      }
+    }
 
     Teuchos::ParameterList solveParams;
     solveParams.set("Compute Sensitivities", false);
@@ -671,8 +747,10 @@ void ali_driver_run(AliToGlimmer * ftg_ptr, double& cur_time_yr, double time_inc
     auto disc = albanyApp->getDiscretization();
     auto ownedVS = disc->getVectorSpace();
     auto overlapVS = disc->getOverlapVectorSpace();
-    auto cas_manager = Albany::createCombineAndScatterManager(ownedVS,overlapVS);
-    auto solutionOverlap = Thyra::createMember(overlapVS);
+    if (!reuseAlbanyApp || cas_manager.is_null()) {
+      cas_manager = Albany::createCombineAndScatterManager(ownedVS,overlapVS);
+      solutionOverlap = Thyra::createMember(overlapVS);
+    }
     cas_manager->scatter(*disc->getSolutionField(),*solutionOverlap,Albany::CombineMode::INSERT);
     auto solutionOverlap_constView = Albany::getLocalData(Teuchos::rcp_dynamic_cast<const Thyra_Vector>(solutionOverlap)); 
 
@@ -684,10 +762,6 @@ void ali_driver_run(AliToGlimmer * ftg_ptr, double& cur_time_yr, double time_inc
     Albany::writeMatrixMarket(albanyApp->getDiscretization()->getSolutionField(), "solution");  
 #endif
 
-   //set previousSolution (used as initial guess for next time step) to final Albany solution.
-   //previousSolution = Teuchos::rcp(new Tpetra_Vector(*albanyApp->getDiscretization()->getSolutionFieldT()));
-   //nElementsActivePrevious = nElementsActive;
-
    //std::cout << "Final solution: " << *albanyApp->getDiscretization()->getSolutionField() << std::endl;
     // ---------------------------------------------------------------------------------------------------
     // Compute sensitivies / responses and perform regression tests
@@ -852,11 +926,17 @@ void ali_driver_run(AliToGlimmer * ftg_ptr, double& cur_time_yr, double time_inc
     }
 
 
+    //The application built at the first time step may have used homotopy continuation,
+    //so it is only kept from the second time step on (see the solver switch above).
+    albanyAppReusable = !first_time_step;
     first_time_step = false;
-    meshStruct = Teuchos::null;
-    albanyApp = Teuchos::null;
-    solver = Teuchos::null;
     if (cur_time_yr == final_time) {
+      meshStruct = Teuchos::null;
+      albanyApp = Teuchos::null;
+      solver = Teuchos::null;
+      cas_manager = Teuchos::null;
+      solutionOverlap = Teuchos::null;
+      albanyAppReusable = false;
       mpiCommT = Teuchos::null;
       reducedMpiCommT = Teuchos::null;
       parameterList = Teuchos::null;
@@ -192,6 +192,7 @@ LandIce::LaplacianSampling::getValidProblemParameters () const
   validPL->set<Teuchos::Array<std::string> > ("Required Fields", Teuchos::Array<std::string>(), "");
   validPL->sublist("LandIce Laplacian Regularization", false, "Parameters needed to compute the Laplacian Regularization");
   validPL->set<std::string> ("Side Name", "", "Name of the lateral side set");
+  validPL->sublist("Batched Sampling", false, "If present, draw many samples with a single operator setup");
 
   return validPL;
 }
@@ -0,0 +1,224 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "LandIce_BatchedLaplacianSampler.hpp"
+
+#include "Albany_ThyraUtils.hpp"
+
+#include "Thyra_LinearOpWithSolveBase.hpp"
+#include "Thyra_MultiVectorStdOps.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace LandIce {
+
+namespace {
+
+// SplitMix64 finalizer: a cheap, well mixed hash of a 64 bits key
+std::uint64_t mix64 (std::uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+// Uniform in (0,1), never exactly 0
+double toUniform (const std::uint64_t bits) {
+  return (static_cast<double>(bits >> 11) + 0.5) / 9007199254740992.0;
+}
+
+} // anonymous namespace
+
+BatchedLaplacianSampler::
+BatchedLaplacianSampler (const Teuchos::RCP<Albany::Application>& app_,
+                         const Teuchos::RCP<Thyra_ModelEvaluator>& model_with_solve,
+                         const Teuchos::ParameterList& sampling_params)
+ : app   (app_)
+ , model (model_with_solve)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (app.is_null() || model.is_null(), std::logic_error,
+                              "Error! Invalid inputs to BatchedLaplacianSampler.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (!model->createOutArgs().supports(Thyra_ModelEvaluator::OUT_ARG_W), std::logic_error,
+                              "Error! The model does not support a linear solver (OUT_ARG_W).\n");
+
+  noise_name    = sampling_params.get<std::string>("Noise Field Name","weighted_normal_sample");
+  num_samples   = sampling_params.get<int>("Number Of Samples");
+  block_size    = sampling_params.get<int>("Block Size",32);
+  seed          = sampling_params.get<int>("Random Seed",0);
+  write_samples = sampling_params.get<bool>("Write Samples",true);
+  keep_samples  = sampling_params.get<bool>("Keep Samples",false);
+
+  TEUCHOS_TEST_FOR_EXCEPTION (num_samples<1, std::logic_error,
+                              "Error! 'Number Of Samples' must be positive.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (block_size<1, std::logic_error,
+                              "Error! 'Block Size' must be positive.\n");
+}
+
+Teuchos::ArrayView<const std::string>
+BatchedLaplacianSampler::get_g_names (int) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+                              "Error! BatchedLaplacianSampler has no responses.\n");
+  return Teuchos::ArrayView<const std::string>(Teuchos::null);
+}
+
+Thyra_InArgs BatchedLaplacianSampler::createInArgsImpl () const
+{
+  Thyra::ModelEvaluatorBase::InArgsSetup<ST> ias;
+  ias.setModelEvalDescription(this->description());
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_x, true);
+
+  return static_cast<Thyra_InArgs>(ias);
+}
+
+Thyra_OutArgs BatchedLaplacianSampler::createOutArgsImpl () const
+{
+  Thyra::ModelEvaluatorBase::OutArgsSetup<ST> oas;
+  oas.setModelEvalDescription(this->description());
+  oas.setSupports(Thyra_ModelEvaluator::OUT_ARG_f, true);
+
+  return static_cast<Thyra_OutArgs>(oas);
+}
+
+void BatchedLaplacianSampler::setNoiseState (const double value) const
+{
+  auto& elem_state_arrays = app->getStateMgr().getStateArrays().elemStateArrays;
+  for (auto& ws_states : elem_state_arrays) {
+    Albany::MDArray& noise = ws_states.at(noise_name);
+    for (int i=0; i<noise.size(); ++i) {
+      noise[i] = value;
+    }
+  }
+}
+
+double BatchedLaplacianSampler::whiteNoise (const int sample, const GO gid) const
+{
+  // Box-Muller on two uniforms hashed from (seed, sample, gid)
+  const std::uint64_t key = mix64(mix64(static_cast<std::uint64_t>(seed)) ^ static_cast<std::uint64_t>(sample))
+                          ^ (static_cast<std::uint64_t>(gid) * 0x9e3779b97f4a7c15ULL);
+  const double u1 = toUniform(mix64(key));
+  const double u2 = toUniform(mix64(key ^ 0xd1b54a32d192ed03ULL));
+  return std::sqrt(-2.0*std::log(u1)) * std::cos(2.0*M_PI*u2);
+}
+
+void BatchedLaplacianSampler::
+evalModelImpl (const Thyra_InArgs& /* in_args */, const Thyra_OutArgs& /* out_args */) const
+{
+  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  const auto x_space = model->get_x_space();
+  const auto x0 = Thyra::createMember(x_space);
+  Thyra::assign(x0.ptr(), 0.0);
+
+  Thyra_InArgs in_args = model->createInArgs();
+  in_args.setArgs(model->getNominalValues());
+  in_args.set_x(x0);
+
+  // The residual at x=0 is f(w) = f0 - D w, where f0 only carries the
+  // Dirichlet data. Two evaluations give D, and the one at w=0 also
+  // assembles the operator and sets up the linear solver, once for all samples.
+  const auto f0 = Thyra::createMember(model->get_f_space());
+  const auto d  = Thyra::createMember(model->get_f_space());
+  const auto W  = model->create_W();
+  {
+    TEUCHOS_FUNC_TIME_MONITOR("LandIce: Batched Sampling Setup");
+
+    // Save the noise loaded from the mesh, to restore it at the end
+    std::vector<std::vector<double>> noise_backup;
+    for (auto& ws_states : app->getStateMgr().getStateArrays().elemStateArrays) {
+      auto it = ws_states.find(noise_name);
+      TEUCHOS_TEST_FOR_EXCEPTION (it==ws_states.end(), std::logic_error,
+                                  "Error! Noise state '" << noise_name << "' not found.\n");
+      const Albany::MDArray& noise = it->second;
+      noise_backup.emplace_back(noise.contiguous_data(), noise.contiguous_data()+noise.size());
+    }
+
+    Thyra_OutArgs out_args = model->createOutArgs();
+    setNoiseState(1.0);
+    out_args.set_f(d);
+    model->evalModel(in_args, out_args);
+
+    setNoiseState(0.0);
+    out_args.set_f(f0);
+    out_args.set_W(W);
+    model->evalModel(in_args, out_args);
+
+    // d = f0 - f(1) = diag(D). Dirichlet rows have no forcing and get d=0.
+    Thyra::scale(-1.0, d.ptr());
+    Thyra::Vp_V(d.ptr(), *f0);
+
+    auto& elem_state_arrays = app->getStateMgr().getStateArrays().elemStateArrays;
+    for (size_t ws=0; ws<elem_state_arrays.size(); ++ws) {
+      Albany::MDArray& noise = elem_state_arrays[ws].at(noise_name);
+      std::copy(noise_backup[ws].begin(), noise_backup[ws].end(), noise.contiguous_data());
+    }
+  }
+
+  const auto d_data  = Albany::getLocalData(d.getConst());
+  const auto f0_data = Albany::getLocalData(f0.getConst());
+  const Teuchos::Array<GO> gids = Albany::getGlobalElements(x_space);
+  const int num_local_dofs = gids.size();
+
+  std::vector<double> sqrt_d(num_local_dofs);
+  for (int lid=0; lid<num_local_dofs; ++lid) {
+    sqrt_d[lid] = std::sqrt(std::max(d_data[lid],0.0));
+  }
+
+  if (keep_samples) {
+    samples = Thyra::createMembers(x_space, num_samples);
+  } else {
+    samples = Teuchos::null;
+  }
+
+  const auto disc = app->getDiscretization();
+  for (int first=0; first<num_samples; first+=block_size) {
+    const int nb = std::min(block_size, num_samples-first);
+
+    const auto B = Thyra::createMembers(x_space, nb);
+    const auto X = Thyra::createMembers(x_space, nb);
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("LandIce: Batched Sampling Right-Hand Sides");
+      auto B_data = Albany::getNonconstLocalData(B);
+      for (int k=0; k<nb; ++k) {
+        for (int lid=0; lid<num_local_dofs; ++lid) {
+          B_data[k][lid] = sqrt_d[lid]*whiteNoise(first+k, gids[lid]) - f0_data[lid];
+        }
+      }
+    }
+    Thyra::assign(X.ptr(), 0.0);
+
+    Thyra::SolveStatus<ST> status;
+    {
+      TEUCHOS_FUNC_TIME_MONITOR("LandIce: Batched Sampling Solve");
+      status = W->solve(Thyra::NOTRANS, *B, X.ptr());
+    }
+    *out << "Batched sampling: samples " << first << " to " << first+nb-1
+         << ", linear solve status: " << Thyra::toString(status.solveStatus) << "\n";
+    TEUCHOS_TEST_FOR_EXCEPTION (status.solveStatus==Thyra::SOLVE_STATUS_UNCONVERGED, std::runtime_error,
+                                "Error! The linear solve for samples " << first << " to " << first+nb-1
+                                << " did not converge.\n" << status.message << "\n");
+
+    if (write_samples) {
+      TEUCHOS_FUNC_TIME_MONITOR("LandIce: Batched Sampling Output");
+      for (int k=0; k<nb; ++k) {
+        // One output step per sample, labeled by the sample index
+        disc->writeSolution(*X->col(k), static_cast<double>(first+k));
+      }
+    }
+    if (keep_samples) {
+      Thyra::assign(samples->subView(Teuchos::Range1D(first,first+nb-1)).ptr(), *X);
+    }
+  }
+
+  *out << "Batched sampling: " << num_samples << " samples computed with one operator setup.\n";
+}
+
+} // namespace LandIce
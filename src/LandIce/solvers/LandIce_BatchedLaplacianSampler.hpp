@@ -0,0 +1,99 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef LANDICE_BATCHED_LAPLACIAN_SAMPLER_HPP
+#define LANDICE_BATCHED_LAPLACIAN_SAMPLER_HPP 1
+
+#include "Albany_Application.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+
+namespace LandIce {
+
+/*! \brief Draws many samples of the Laplacian prior with one operator setup.
+ *
+ *  The LandIce Laplacian Sampling problem is linear in the sample x, and its
+ *  forcing enters through the lumped (diagonal) mass matrix D:
+ *
+ *    A x = D w,   w = weighted_normal_sample.
+ *
+ *  Instead of one Albany run per noise field w, this driver assembles A and
+ *  builds the linear solver (hence the preconditioner) once, recovers D from
+ *  two residual evaluations, and then solves for blocks of right-hand sides
+ *
+ *    b = D^{1/2} n,   n ~ N(0,I),
+ *
+ *  i.e., w = D^{-1/2} n, with one multivector solve per block. The white noise
+ *  of a dof only depends on the seed, the sample index and the dof gid, so the
+ *  samples do not depend on the number of ranks. All the samples are written
+ *  to the Exodus output file of the problem, as consecutive time steps.
+ *
+ *  Selected by the "Batched Sampling" sublist of the Laplacian Sampling
+ *  problem.
+ */
+class BatchedLaplacianSampler : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
+{
+public:
+
+  BatchedLaplacianSampler (const Teuchos::RCP<Albany::Application>& app,
+                           const Teuchos::RCP<Thyra_ModelEvaluator>& model_with_solve,
+                           const Teuchos::ParameterList& sampling_params);
+
+  ~BatchedLaplacianSampler () = default;
+
+  /** \name Overridden from Thyra::ModelEvaluator<ST> . */
+  //@{
+  Teuchos::RCP<const Thyra_VectorSpace> get_x_space () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_f_space () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_p_space (int) const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_g_space (int) const { return Teuchos::null; }
+
+  Teuchos::RCP<const Teuchos::Array<std::string>> get_p_names (int) const { return Teuchos::null; }
+  Teuchos::ArrayView<const std::string> get_g_names (int) const;
+
+  Thyra_InArgs getNominalValues () const { return createInArgsImpl(); }
+  Thyra_InArgs getLowerBounds () const { return Thyra_InArgs(); }
+  Thyra_InArgs getUpperBounds () const { return Thyra_InArgs(); }
+  Thyra_InArgs createInArgs () const { return createInArgsImpl(); }
+
+  Teuchos::RCP<Thyra_LinearOp> create_W_op () const { return Teuchos::null; }
+  Teuchos::RCP<Thyra_Preconditioner> create_W_prec () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_LOWS_Factory> get_W_factory () const { return Teuchos::null; }
+  //@}
+
+  //! The samples of the last evaluation, one per column (if "Keep Samples" is true)
+  Teuchos::RCP<const Thyra_MultiVector> getSamples () const { return samples; }
+
+private:
+
+  Thyra_InArgs createInArgsImpl () const;
+  Thyra_OutArgs createOutArgsImpl () const;
+
+  void evalModelImpl (const Thyra_InArgs& in_args, const Thyra_OutArgs& out_args) const;
+
+  // Sets the noise state to a constant value on all nodes
+  void setNoiseState (const double value) const;
+
+  // Standard normal value for the given sample and dof, independent of the partition
+  double whiteNoise (const int sample, const GO gid) const;
+
+  Teuchos::RCP<Albany::Application> app;
+  Teuchos::RCP<Thyra_ModelEvaluator> model;
+
+  std::string noise_name;
+  int         num_samples;
+  int         block_size;
+  int         seed;
+  bool        write_samples;
+  bool        keep_samples;
+
+  mutable Teuchos::RCP<Thyra_MultiVector> samples;
+};
+
+} // namespace LandIce
+
+#endif // LANDICE_BATCHED_LAPLACIAN_SAMPLER_HPP
@@ -0,0 +1,460 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "LandIce_StaggeredHydrologySolver.hpp"
+
+#include "Albany_SolverFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+
+#include "Piro_NOXSolver.hpp"
+#include "Piro_StratimikosUtils.hpp"
+#ifdef ALBANY_TEMPUS
+#include "Piro_TempusSolver.hpp"
+#endif
+#include "Thyra_VectorStdOps.hpp"
+#include "Thyra_MultiVectorStdOps.hpp"
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+#include <stk_mesh/base/GetEntities.hpp>
+
+#include <iomanip>
+
+namespace LandIce {
+
+StaggeredHydrologySolver::
+StaggeredHydrologySolver (const Teuchos::RCP<Teuchos::ParameterList>& app_params,
+                          const Teuchos::RCP<const Teuchos_Comm>& comm)
+ : hydrology_time (0.0)
+ , num_iters (0)
+ , converged (false)
+{
+  Teuchos::ParameterList& coupling_params = app_params->sublist("Staggered Coupling");
+
+  names[VELOCITY]  = "Velocity";
+  names[HYDROLOGY] = "Hydrology";
+
+  const std::string input_files[NUM_SUBPROBLEMS] = {
+    coupling_params.get<std::string>("Velocity Input File"),
+    coupling_params.get<std::string>("Hydrology Input File")
+  };
+
+  const std::string basal_side_name = coupling_params.get<std::string>("Basal Side Name","basalside");
+  const std::string coupling_scheme = coupling_params.get<std::string>("Coupling Scheme","Gauss-Seidel");
+  TEUCHOS_TEST_FOR_EXCEPTION (coupling_scheme!="Gauss-Seidel" && coupling_scheme!="Jacobi", std::logic_error,
+                              "Error! Invalid 'Coupling Scheme' (" << coupling_scheme << "). "
+                              "Valid choices are 'Gauss-Seidel' and 'Jacobi'.\n");
+  lag_velocity = (coupling_scheme=="Jacobi");
+
+  omega     = coupling_params.get<double>("Relaxation Parameter",1.0);
+  min_iters = coupling_params.get<int>("Minimum Iterations",1);
+  max_iters = coupling_params.get<int>("Maximum Iterations",20);
+  rel_tol   = coupling_params.get<double>("Relative Tolerance",1.0e-6);
+  abs_tol   = coupling_params.get<double>("Absolute Tolerance",1.0e-10);
+
+  TEUCHOS_TEST_FOR_EXCEPTION (omega<=0.0 || omega>1.0, std::logic_error,
+                              "Error! 'Relaxation Parameter' must be in (0,1].\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (min_iters<1 || max_iters<min_iters, std::logic_error,
+                              "Error! Invalid 'Minimum Iterations'/'Maximum Iterations'.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (rel_tol<0.0 || abs_tol<0.0, std::logic_error,
+                              "Error! Tolerances must be non-negative.\n");
+
+  hydrology_substeps = coupling_params.get<int>("Hydrology Sub-steps",1);
+  TEUCHOS_TEST_FOR_EXCEPTION (hydrology_substeps<1, std::logic_error,
+                              "Error! 'Hydrology Sub-steps' must be positive.\n");
+
+  const std::string velocity_reuse = coupling_params.get<std::string>("Velocity Preconditioner Reuse","None");
+
+  // Each subproblem is a full Albany problem with its own solver. They are kept
+  // alive across iterations, so the Jacobian graphs are built once.
+  for (int i=0; i<NUM_SUBPROBLEMS; ++i) {
+    Albany::SolverFactory solver_factory(input_files[i], comm);
+
+    Teuchos::ParameterList& params = solver_factory.getParameters();
+    const std::string solution_method = params.sublist("Problem").get<std::string>("Solution Method","Steady");
+    const bool transient = (i==HYDROLOGY && solution_method=="Transient Tempus");
+    TEUCHOS_TEST_FOR_EXCEPTION (solution_method!="Steady" && !transient, std::logic_error,
+                                "Error! The " << names[i] << " problem (" << input_files[i] << ") must be "
+                                << (i==HYDROLOGY ? "'Steady' or 'Transient Tempus'" : "'Steady'") << ".\n");
+    TEUCHOS_TEST_FOR_EXCEPTION (!params.sublist("Piro").isSublist(transient ? "Tempus" : "NOX"), std::logic_error,
+                                "Error! The " << names[i] << " problem (" << input_files[i] << ") "
+                                "must be solved with " << (transient ? "Tempus" : "NOX") << ".\n");
+
+    if (i==HYDROLOGY) {
+      transient_hydrology = transient;
+    } else {
+      setPreconditionerReuse(params.sublist("Piro"), velocity_reuse);
+    }
+
+    // Warm start: each sub-solve starts from the solution of the previous iteration
+    params.set("Overwrite Nominal Values With Final Point", true);
+
+    solvers[i] = solver_factory.createAndGetAlbanyApp(apps[i], comm, comm);
+  }
+
+  if (transient_hydrology) {
+#ifdef ALBANY_TEMPUS
+    coupling_dt = coupling_params.get<double>("Coupling Time Step");
+    TEUCHOS_TEST_FOR_EXCEPTION (coupling_dt<=0.0, std::logic_error,
+                                "Error! 'Coupling Time Step' must be positive.\n");
+#else
+    TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+                                "Error! A transient hydrology requires Albany to be built with Tempus.\n");
+#endif
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION (hydrology_substeps>1, std::logic_error,
+                                "Error! 'Hydrology Sub-steps' requires a 'Transient Tempus' hydrology problem.\n");
+    coupling_dt = 0.0;
+  }
+
+  // The basal velocity goes from the basal side of the velocity mesh to the
+  // hydrology mesh, and the effective pressure goes the other way around.
+  const auto velocity_disc  = getSTKDisc(apps[VELOCITY]->getDiscretization(), basal_side_name);
+  const auto hydrology_disc = getSTKDisc(apps[HYDROLOGY]->getDiscretization());
+
+  velocity_transfer.src_disc = velocity_disc;
+  velocity_transfer.dst_disc = hydrology_disc;
+  velocity_transfer.src_name = coupling_params.get<std::string>("Basal Velocity Name","ice_velocity");
+  velocity_transfer.dst_name = coupling_params.get<std::string>("Hydrology Basal Velocity Name","basal_velocity");
+  setupTransfer(velocity_transfer);
+
+  const std::string pressure_name = coupling_params.get<std::string>("Effective Pressure Name","effective_pressure");
+  pressure_transfer.src_disc = hydrology_disc;
+  pressure_transfer.dst_disc = velocity_disc;
+  pressure_transfer.src_name = pressure_name;
+  pressure_transfer.dst_name = pressure_name;
+  setupTransfer(pressure_transfer);
+
+  const Teuchos::ParameterList& problem_params = app_params->sublist("Problem");
+  TEUCHOS_TEST_FOR_EXCEPTION (problem_params.isSublist("Parameters") || problem_params.isSublist("Response Functions"),
+                              std::logic_error,
+                              "Error! Parameters and responses are not supported by the staggered coupling. "
+                              "Specify them in the input files of the subproblems.\n");
+}
+
+Teuchos::ArrayView<const std::string>
+StaggeredHydrologySolver::get_g_names (int) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+                              "Error! StaggeredHydrologySolver has no responses.\n");
+  return Teuchos::ArrayView<const std::string>(Teuchos::null);
+}
+
+Thyra_InArgs StaggeredHydrologySolver::createInArgsImpl () const
+{
+  Thyra::ModelEvaluatorBase::InArgsSetup<ST> ias;
+  ias.setModelEvalDescription(this->description());
+  ias.setSupports(Thyra_ModelEvaluator::IN_ARG_x, true);
+
+  return static_cast<Thyra_InArgs>(ias);
+}
+
+Thyra_OutArgs StaggeredHydrologySolver::createOutArgsImpl () const
+{
+  Thyra::ModelEvaluatorBase::OutArgsSetup<ST> oas;
+  oas.setModelEvalDescription(this->description());
+  oas.setSupports(Thyra_ModelEvaluator::OUT_ARG_f, true);
+
+  return static_cast<Thyra_OutArgs>(oas);
+}
+
+void StaggeredHydrologySolver::
+evalModelImpl (const Thyra_InArgs& /* in_args */, const Thyra_OutArgs& /* out_args */) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("LandIce: Staggered Hydrology Solve");
+
+  Teuchos::RCP<Teuchos::FancyOStream> out = Teuchos::VerboseObjectBase::getDefaultOStream();
+
+  converged = false;
+  convergence_history.clear();
+  for (int i=0; i<NUM_SUBPROBLEMS; ++i) {
+    prev_x[i] = Teuchos::null;
+  }
+  if (transient_hydrology) {
+    hydrology_time = 0.0;
+    hydrology_x = apps[HYDROLOGY]->getAdaptSolMgr()->getInitialSolution()->col(0)->clone_v();
+  }
+
+  *out << "\nStaggered velocity-hydrology coupling ("
+       << (lag_velocity ? "Jacobi" : "Gauss-Seidel") << ", relaxation " << omega << ")\n";
+  if (transient_hydrology) {
+    *out << "Hydrology coupling time step " << coupling_dt << ", in " << hydrology_substeps << " sub-steps\n";
+  }
+  *out << std::setw(6) << "Iter"
+       << std::setw(16) << "|dx| velocity" << std::setw(16) << "|dx| hydrology"
+       << std::setw(16) << "|dx|" << std::setw(16) << "|dx|/|x|" << "\n";
+
+  for (num_iters=1; num_iters<=max_iters; ++num_iters) {
+    ST norm_x2  = 0.0;
+    ST norm_dx2 = 0.0;
+    ST norm_dx[NUM_SUBPROBLEMS];
+
+    // With Jacobi the hydrology sees the velocity of the previous iteration
+    if (lag_velocity && num_iters>1) {
+      transferField(velocity_transfer, 1.0);
+    }
+
+    for (int i=0; i<NUM_SUBPROBLEMS; ++i) {
+      if (i==HYDROLOGY && !lag_velocity) {
+        transferField(velocity_transfer, 1.0);
+      }
+
+      if (!solveSubproblem(i)) {
+        *out << "The " << names[i] << " solve failed at staggered iteration " << num_iters << ".\n";
+        TEUCHOS_TEST_FOR_EXCEPTION (true, std::runtime_error,
+                                    "Error! The " << names[i] << " solve failed in the staggered coupling.\n");
+      }
+
+      const auto x = getSolution(i);
+      if (prev_x[i].is_null()) {
+        norm_dx[i] = Thyra::norm(*x);
+      } else {
+        Thyra::Vp_StV(prev_x[i].ptr(), -1.0, *x);
+        norm_dx[i] = Thyra::norm(*prev_x[i]);
+      }
+      prev_x[i] = x;
+
+      const ST norm_xi = Thyra::norm(*x);
+      norm_x2  += norm_xi*norm_xi;
+      norm_dx2 += norm_dx[i]*norm_dx[i];
+    }
+
+    transferField(pressure_transfer, omega);
+
+    const ST abs_err = std::sqrt(norm_dx2);
+    const ST rel_err = norm_x2>0.0 ? abs_err/std::sqrt(norm_x2) : abs_err;
+    convergence_history.push_back(rel_err);
+
+    *out << std::setw(6) << num_iters << std::scientific << std::setprecision(6)
+         << std::setw(16) << norm_dx[VELOCITY] << std::setw(16) << norm_dx[HYDROLOGY]
+         << std::setw(16) << abs_err << std::setw(16) << rel_err << "\n";
+    out->unsetf(std::ios_base::floatfield);
+
+    // The first iteration has no previous iterate to compare with
+    if (num_iters>1 && num_iters>=min_iters && (abs_err<=abs_tol || rel_err<=rel_tol)) {
+      converged = true;
+      break;
+    }
+  }
+
+  if (converged) {
+    *out << "Staggered coupling converged in " << num_iters << " iterations.\n";
+  } else {
+    num_iters = max_iters;
+    *out << "WARNING: staggered coupling did not converge in " << max_iters << " iterations.\n";
+  }
+}
+
+bool StaggeredHydrologySolver::solveSubproblem (const int i) const
+{
+  if (i==HYDROLOGY && transient_hydrology) {
+    return advanceHydrology();
+  }
+
+  auto& solver = *solvers[i];
+  solver.evalModel(solver.createInArgs(), solver.createOutArgs());
+
+  auto& piro_solver = dynamic_cast<Piro::NOXSolver<ST>&>(solver);
+  const auto& nox_solver  = *piro_solver.getSolver()->getNOXSolver();
+  return const_cast<NOX::Solver::Generic&>(nox_solver).getStatus() != NOX::StatusTest::Failed;
+}
+
+bool StaggeredHydrologySolver::advanceHydrology () const
+{
+#ifdef ALBANY_TEMPUS
+  auto& solver = *solvers[HYDROLOGY];
+  auto& tempus_solver = dynamic_cast<Piro::TempusSolver<ST,LO,Tpetra_GO,KokkosNode>&>(solver);
+
+  // Each sub-step is a separate Tempus integration, restarted from the
+  // hydrology state at the end of the previous one.
+  const ST dt = coupling_dt/hydrology_substeps;
+  for (int step=0; step<hydrology_substeps; ++step) {
+    tempus_solver.setStartTime(hydrology_time);
+    tempus_solver.setFinalTime(hydrology_time+dt);
+    tempus_solver.setInitTimeStep(dt);
+    tempus_solver.setInitialState(hydrology_time, hydrology_x);
+
+    solver.evalModel(solver.createInArgs(), solver.createOutArgs());
+    if (tempus_solver.getTempusIntegratorStatus()==Tempus::Status::FAILED) {
+      return false;
+    }
+
+    hydrology_x = tempus_solver.getSolutionHistory()->getCurrentState()->getX()->clone_v();
+    hydrology_time += dt;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+Teuchos::RCP<Thyra_Vector> StaggeredHydrologySolver::getSolution (const int i) const
+{
+  if (i==HYDROLOGY && transient_hydrology) {
+    return hydrology_x->clone_v();
+  }
+
+  auto& piro_solver = dynamic_cast<Piro::NOXSolver<ST>&>(*solvers[i]);
+  return piro_solver.getSolver()->get_current_x()->clone_v();
+}
+
+void StaggeredHydrologySolver::
+setPreconditionerReuse (Teuchos::ParameterList& piro_params, const std::string& reuse) const
+{
+  std::string reuse_type;
+  if (reuse=="None") {
+    reuse_type = "none";
+  } else if (reuse=="Tentative Prolongator") {
+    reuse_type = "tP";
+  } else if (reuse=="Prolongator") {
+    reuse_type = "RP";
+  } else if (reuse=="Full") {
+    reuse_type = "full";
+  } else {
+    TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error,
+                                "Error! Invalid 'Velocity Preconditioner Reuse' (" << reuse << "). Valid choices are "
+                                "'None', 'Tentative Prolongator', 'Prolongator' and 'Full'.\n");
+  }
+
+  const auto strat_params = Piro::extractStratimikosParams(Teuchos::rcpFromRef(piro_params));
+  const bool use_muelu = Teuchos::nonnull(strat_params) &&
+                         strat_params->get<std::string>("Preconditioner Type","None")=="MueLu";
+  if (!use_muelu) {
+    TEUCHOS_TEST_FOR_EXCEPTION (reuse!="None", std::logic_error,
+                                "Error! 'Velocity Preconditioner Reuse' requires MueLu as preconditioner "
+                                "of the velocity problem.\n");
+    return;
+  }
+
+  strat_params->sublist("Preconditioner Types").sublist("MueLu").set("reuse: type",reuse_type);
+}
+
+Teuchos::RCP<Albany::STKDiscretization>
+StaggeredHydrologySolver::getSTKDisc (const Teuchos::RCP<Albany::AbstractDiscretization>& disc,
+                                      const std::string& side_set) const
+{
+  Teuchos::RCP<Albany::AbstractDiscretization> d = disc;
+  if (side_set!="") {
+    const auto& ss_discs = disc->getSideSetDiscretizations();
+    TEUCHOS_TEST_FOR_EXCEPTION (ss_discs.find(side_set)==ss_discs.end(), std::logic_error,
+                                "Error! Side set '" << side_set << "' has no discretization in the velocity problem.\n");
+    d = ss_discs.at(side_set);
+  }
+
+  const auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(d);
+  TEUCHOS_TEST_FOR_EXCEPTION (stk_disc.is_null(), std::logic_error,
+                              "Error! The staggered coupling requires STK discretizations.\n");
+  return stk_disc;
+}
+
+void StaggeredHydrologySolver::setupTransfer (FieldTransfer& transfer) const
+{
+  const auto src_mesh = transfer.src_disc->getSTKMeshStruct();
+  const auto dst_mesh = transfer.dst_disc->getSTKMeshStruct();
+
+  const stk::mesh::FieldBase* src_field = src_mesh->metaData->get_field(stk::topology::NODE_RANK, transfer.src_name);
+  const stk::mesh::FieldBase* dst_field = dst_mesh->metaData->get_field(stk::topology::NODE_RANK, transfer.dst_name);
+  TEUCHOS_TEST_FOR_EXCEPTION (src_field==nullptr, std::logic_error,
+                              "Error! Nodal field '" << transfer.src_name << "' not found. Make sure it is an "
+                              "'Output' in the 'Required Fields Info' of its problem.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (dst_field==nullptr, std::logic_error,
+                              "Error! Nodal field '" << transfer.dst_name << "' not found. Make sure it is an "
+                              "'Input' in the 'Required Fields Info' of its problem.\n");
+
+  transfer.num_comps = src_field->max_size(stk::topology::NODE_RANK);
+  TEUCHOS_TEST_FOR_EXCEPTION (static_cast<int>(dst_field->max_size(stk::topology::NODE_RANK))!=transfer.num_comps,
+                              std::logic_error,
+                              "Error! Fields '" << transfer.src_name << "' and '" << transfer.dst_name << "' "
+                              "have a different number of components.\n");
+
+  // The meshes are not adapted, so the node lists and the importer are built once
+  const auto& src_meta = *src_mesh->metaData;
+  const auto& dst_meta = *dst_mesh->metaData;
+  stk::mesh::get_selected_entities(stk::mesh::Selector(src_meta.locally_owned_part()),
+                                   src_mesh->bulkData->buckets(stk::topology::NODE_RANK),
+                                   transfer.src_nodes);
+  stk::mesh::get_selected_entities(stk::mesh::Selector(dst_meta.locally_owned_part()) | dst_meta.globally_shared_part(),
+                                   dst_mesh->bulkData->buckets(stk::topology::NODE_RANK),
+                                   transfer.dst_nodes);
+
+  Teuchos::Array<GO> src_gids(transfer.src_nodes.size());
+  for (size_t inode=0; inode<transfer.src_nodes.size(); ++inode) {
+    src_gids[inode] = src_mesh->bulkData->identifier(transfer.src_nodes[inode]) - 1;
+  }
+  Teuchos::Array<GO> dst_gids(transfer.dst_nodes.size());
+  for (size_t inode=0; inode<transfer.dst_nodes.size(); ++inode) {
+    dst_gids[inode] = dst_mesh->bulkData->identifier(transfer.dst_nodes[inode]) - 1;
+  }
+
+  const auto comm = apps[VELOCITY]->getComm();
+  transfer.src_vs = Albany::createVectorSpace(comm, src_gids());
+  transfer.dst_vs = Albany::createVectorSpace(comm, dst_gids());
+  transfer.cas_manager = Albany::createCombineAndScatterManager(transfer.src_vs, transfer.dst_vs);
+}
+
+void StaggeredHydrologySolver::transferField (const FieldTransfer& transfer, const ST omega_in) const
+{
+  TEUCHOS_FUNC_TIME_MONITOR("LandIce: Staggered Hydrology Field Transfer");
+
+  const auto src_mesh = transfer.src_disc->getSTKMeshStruct();
+  const auto dst_mesh = transfer.dst_disc->getSTKMeshStruct();
+  const stk::mesh::FieldBase& src_field = *src_mesh->metaData->get_field(stk::topology::NODE_RANK, transfer.src_name);
+  const stk::mesh::FieldBase& dst_field = *dst_mesh->metaData->get_field(stk::topology::NODE_RANK, transfer.dst_name);
+  const int num_comps = transfer.num_comps;
+
+  // Gather the owned source values and import them on the destination nodes
+  const auto src = Thyra::createMembers(transfer.src_vs, num_comps);
+  const auto dst = Thyra::createMembers(transfer.dst_vs, num_comps);
+  {
+    auto src_data = Albany::getNonconstLocalData(src);
+    for (size_t inode=0; inode<transfer.src_nodes.size(); ++inode) {
+      const double* values = reinterpret_cast<const double*>(stk::mesh::field_data(src_field, transfer.src_nodes[inode]));
+      for (int icomp=0; icomp<num_comps; ++icomp) {
+        src_data[icomp][inode] = values[icomp];
+      }
+    }
+  }
+  transfer.cas_manager->scatter(*src, *dst, Albany::CombineMode::INSERT);
+
+  const auto dst_data = Albany::getLocalData(dst.getConst());
+  for (size_t inode=0; inode<transfer.dst_nodes.size(); ++inode) {
+    double* values = reinterpret_cast<double*>(stk::mesh::field_data(dst_field, transfer.dst_nodes[inode]));
+    for (int icomp=0; icomp<num_comps; ++icomp) {
+      values[icomp] = omega_in*dst_data[icomp][inode] + (1.0-omega_in)*values[icomp];
+    }
+  }
+
+  // Input nodal states are copied to (cell,node[,comp]) arrays when the worksets
+  // are built, and are loaded from there. Refresh them from the updated field.
+  auto& elem_state_arrays = transfer.dst_disc->getStateArrays().elemStateArrays;
+  const auto& ws_elem_node_gids = transfer.dst_disc->getWsElNodeID();
+  const auto& bulk = *dst_mesh->bulkData;
+  for (size_t ws=0; ws<elem_state_arrays.size(); ++ws) {
+    auto it = elem_state_arrays[ws].find(transfer.dst_name);
+    if (it==elem_state_arrays[ws].end()) {
+      continue;
+    }
+    Albany::MDArray& array = it->second;
+    const int num_cells = ws_elem_node_gids[ws].size();
+    for (int cell=0; cell<num_cells; ++cell) {
+      const int num_nodes = ws_elem_node_gids[ws][cell].size();
+      for (int node=0; node<num_nodes; ++node) {
+        const stk::mesh::Entity e = bulk.get_entity(stk::topology::NODE_RANK, ws_elem_node_gids[ws][cell][node]+1);
+        const double* values = reinterpret_cast<const double*>(stk::mesh::field_data(dst_field, e));
+        if (array.rank()==2) {
+          array(cell,node) = values[0];
+        } else {
+          for (int icomp=0; icomp<num_comps; ++icomp) {
+            array(cell,node,icomp) = values[icomp];
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace LandIce
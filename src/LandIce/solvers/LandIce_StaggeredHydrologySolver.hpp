@@ -0,0 +1,164 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef LANDICE_STAGGERED_HYDROLOGY_SOLVER_HPP
+#define LANDICE_STAGGERED_HYDROLOGY_SOLVER_HPP 1
+
+#include "Albany_Application.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Albany_ThyraTypes.hpp"
+
+#include "Thyra_ResponseOnlyModelEvaluatorBase.hpp"
+
+namespace LandIce {
+
+/*! \brief Staggered (fixed-point) coupling of ice velocity and basal hydrology.
+ *
+ *  Instead of solving StokesFO and Hydrology as one monolithic system, the two
+ *  problems are set up from their own input files and solved in turn:
+ *
+ *    1) the velocity problem, with the effective pressure as an input field
+ *       on its basal side set;
+ *    2) the hydrology problem, on the basal mesh, with the basal velocity as
+ *       an input field.
+ *
+ *  After each sub-solve the coupling field is copied node by node to the
+ *  other problem, which requires the hydrology mesh to have the same node
+ *  numbering as the basal side mesh of the velocity problem. With the
+ *  "Gauss-Seidel" scheme the hydrology sees the velocity of the current
+ *  iteration; with "Jacobi" it sees the one of the previous iteration (the
+ *  velocity is lagged). The effective pressure can be under-relaxed.
+ *
+ *  The hydrology problem can be steady, or transient ("Transient Tempus"). In
+ *  the latter case each coupling iteration advances it by "Coupling Time Step",
+ *  in "Hydrology Sub-steps" equal Tempus steps, and the coupling is a pseudo
+ *  time march towards the coupled steady state.
+ *
+ *  The iteration stops when the change of both solutions between two
+ *  iterations is below the absolute or the relative tolerance. Both sub-solves
+ *  start from the solution of the previous iteration, and the sub-solvers
+ *  (hence the velocity Jacobian graph) are kept alive. How much of the velocity
+ *  MueLu hierarchy is reused when the preconditioner is recomputed is set by
+ *  "Velocity Preconditioner Reuse": None, Tentative Prolongator, Prolongator
+ *  or Full (MueLu 'reuse: type' none, tP, RP and full, respectively).
+ *
+ *  Selected with "Solution Method: LandIce Staggered Hydrology" in the Problem
+ *  sublist, and configured by the top level "Staggered Coupling" sublist.
+ */
+class StaggeredHydrologySolver : public Thyra::ResponseOnlyModelEvaluatorBase<ST>
+{
+public:
+
+  StaggeredHydrologySolver (const Teuchos::RCP<Teuchos::ParameterList>& app_params,
+                            const Teuchos::RCP<const Teuchos_Comm>& comm);
+
+  ~StaggeredHydrologySolver () = default;
+
+  /** \name Overridden from Thyra::ModelEvaluator<ST> . */
+  //@{
+  Teuchos::RCP<const Thyra_VectorSpace> get_x_space () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_f_space () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_p_space (int) const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_VectorSpace> get_g_space (int) const { return Teuchos::null; }
+
+  Teuchos::RCP<const Teuchos::Array<std::string>> get_p_names (int) const { return Teuchos::null; }
+  Teuchos::ArrayView<const std::string> get_g_names (int) const;
+
+  Thyra_InArgs getNominalValues () const { return createInArgsImpl(); }
+  Thyra_InArgs getLowerBounds () const { return Thyra_InArgs(); }
+  Thyra_InArgs getUpperBounds () const { return Thyra_InArgs(); }
+  Thyra_InArgs createInArgs () const { return createInArgsImpl(); }
+
+  Teuchos::RCP<Thyra_LinearOp> create_W_op () const { return Teuchos::null; }
+  Teuchos::RCP<Thyra_Preconditioner> create_W_prec () const { return Teuchos::null; }
+  Teuchos::RCP<const Thyra_LOWS_Factory> get_W_factory () const { return Teuchos::null; }
+  //@}
+
+  Teuchos::RCP<Albany::Application> getVelocityApp () const { return apps[VELOCITY]; }
+  Teuchos::RCP<Albany::Application> getHydrologyApp () const { return apps[HYDROLOGY]; }
+
+  int getNumIterations () const { return num_iters; }
+  bool hasConverged () const { return converged; }
+
+  // The relative change of the coupled solution at each iteration of the last solve
+  const std::vector<ST>& getConvergenceHistory () const { return convergence_history; }
+
+private:
+
+  enum Subproblem { VELOCITY = 0, HYDROLOGY = 1, NUM_SUBPROBLEMS = 2 };
+
+  // Copies a nodal field between two meshes sharing the node numbering
+  struct FieldTransfer {
+    Teuchos::RCP<Albany::STKDiscretization>       src_disc;
+    Teuchos::RCP<Albany::STKDiscretization>       dst_disc;
+    std::string                                   src_name;
+    std::string                                   dst_name;
+    int                                           num_comps;
+    std::vector<stk::mesh::Entity>                src_nodes;  // owned nodes, in the order of src_vs
+    std::vector<stk::mesh::Entity>                dst_nodes;  // local nodes, in the order of dst_vs
+    Teuchos::RCP<const Thyra_VectorSpace>         src_vs;
+    Teuchos::RCP<const Thyra_VectorSpace>         dst_vs;
+    Teuchos::RCP<const Albany::CombineAndScatterManager> cas_manager;
+  };
+
+  Thyra_InArgs createInArgsImpl () const;
+  Thyra_OutArgs createOutArgsImpl () const;
+
+  void evalModelImpl (const Thyra_InArgs& in_args, const Thyra_OutArgs& out_args) const;
+
+  // Returns false if the nonlinear solver failed
+  bool solveSubproblem (const int i) const;
+
+  // Advances the transient hydrology by one coupling time step, in sub-steps
+  bool advanceHydrology () const;
+
+  // The solution of the last solve of subproblem i
+  Teuchos::RCP<Thyra_Vector> getSolution (const int i) const;
+
+  // Sets the MueLu reuse type of the velocity preconditioner
+  void setPreconditionerReuse (Teuchos::ParameterList& piro_params, const std::string& reuse) const;
+
+  void setupTransfer (FieldTransfer& transfer) const;
+
+  // dst = omega*src + (1-omega)*dst
+  void transferField (const FieldTransfer& transfer, const ST omega) const;
+
+  Teuchos::RCP<Albany::STKDiscretization>
+  getSTKDisc (const Teuchos::RCP<Albany::AbstractDiscretization>& disc,
+              const std::string& side_set = "") const;
+
+  Teuchos::RCP<Albany::Application>                       apps[NUM_SUBPROBLEMS];
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solvers[NUM_SUBPROBLEMS];
+  std::string                                             names[NUM_SUBPROBLEMS];
+
+  FieldTransfer velocity_transfer;
+  FieldTransfer pressure_transfer;
+
+  bool  lag_velocity;
+  ST    omega;
+  int   min_iters;
+  int   max_iters;
+  ST    rel_tol;
+  ST    abs_tol;
+
+  // Time stepping of a transient hydrology
+  bool  transient_hydrology;
+  int   hydrology_substeps;
+  ST    coupling_dt;
+
+  mutable Teuchos::RCP<Thyra_Vector> hydrology_x;
+  mutable ST                         hydrology_time;
+
+  mutable Teuchos::RCP<Thyra_Vector> prev_x[NUM_SUBPROBLEMS];
+  mutable std::vector<ST> convergence_history;
+  mutable int  num_iters;
+  mutable bool converged;
+};
+
+} // namespace LandIce
+
+#endif // LANDICE_STAGGERED_HYDROLOGY_SOLVER_HPP
@@ -370,6 +370,9 @@ int main(int argc, char *argv[])
   options.output_fraction = true;
   options.output_minmax = true;
   stackedTimer->report(std::cout, Teuchos::DefaultComm<int>::getComm(), options);
+  if (!cmd.timers_filename.empty()) {
+    Albany::writeTimerStatistics(cmd.timers_filename, Albany::getDefaultComm());
+  }
 
 #ifdef ALBANY_APF
   Albany::APFMeshStruct::finalize_libraries();
@@ -10,6 +10,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "Albany_SacadoTypes.hpp"
 #include "Albany_ThyraTypes.hpp"
@@ -115,6 +116,13 @@ struct Workset
   bool                                              transpose_dist_param_deriv;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double>>> local_Vp;
 
+  // Assembled distributed parameter derivative. If dist_param_deriv_op is set,
+  // the scatters sum df/dp into it (rows: overlapped solution dofs, columns:
+  // overlapped parameter dofs) instead of computing df/dp*Vp. If
+  // dist_param_deriv_pattern is set, they only record its local sparsity.
+  Teuchos::RCP<Thyra_LinearOp>                      dist_param_deriv_op;
+  Teuchos::RCP<std::vector<std::set<LO>>>           dist_param_deriv_pattern;
+
   std::vector<PHX::index_size_type> Jacobian_deriv_dims;
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
@@ -144,6 +152,10 @@ struct Workset
   int spatial_dimension_{0};
 
   Albany::StateArray* stateArrayPtr;
+  // State arrays of this workset indexed by the handles assigned by the
+  // StateManager, which owns the table (see
+  // StateManager::getStateArrayHandles)
+  const std::vector<Albany::MDArray*>* stateArrayHandles{nullptr};
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Albany::EigendataStruct> eigenDataPtr;
   Teuchos::RCP<Epetra_MultiVector>      auxDataPtr;
@@ -215,6 +227,20 @@ struct Workset
     };
   };
 
+  // State array of this workset given its handle, or null if the workset
+  // does not store it. Evaluators whose state has no handle (e.g., built
+  // outside of the StateManager) pass -1 and fall back to the lookup by name.
+  Albany::MDArray*
+  findStateArray(const int handle, const std::string& stateName) const
+  {
+    if (stateArrayHandles != nullptr && handle >= 0 &&
+        handle < static_cast<int>(stateArrayHandles->size()) &&
+        (*stateArrayHandles)[handle] != nullptr)
+      return (*stateArrayHandles)[handle];
+    auto it = stateArrayPtr->find(stateName);
+    return it == stateArrayPtr->end() ? nullptr : &it->second;
+  }
+
   void
   print(std::ostream& os)
   {
@@ -8,6 +8,7 @@
 
 #if defined(ALBANY_STK)
 #include "AAdapt_CopyRemesh.hpp"
+#include "AAdapt_CostRebalance.hpp"
 #if defined(ALBANY_LCM) && defined(ALBANY_BGL)
 #include "AAdapt_Erosion.hpp"
 #include "AAdapt_TopologyModification.hpp"
@@ -39,7 +40,7 @@ AdaptiveSolutionManager::AdaptiveSolutionManager(
     Teuchos::RCP<Teuchos::ParameterList> const& appParams,
     Teuchos::RCP<Thyra_Vector const> const&     initial_guess,
     Teuchos::RCP<ParamLib> const&               param_lib,
-    Albany::StateManager const&                 stateMgr,
+    Albany::StateManager&                       stateMgr,
     Teuchos::RCP<rc::Manager> const&            rc_mgr,
     Teuchos::RCP<Teuchos_Comm const> const&     comm)
     : num_time_deriv(appParams->sublist("Discretization")
@@ -114,12 +115,10 @@ AdaptiveSolutionManager::AdaptiveSolutionManager(
   if (Teuchos::nonnull(initial_guess)) {
     current_soln->col(0)->assign(*initial_guess);
   } else {
-    cas_manager->scatter(
-        current_soln->col(0),
-        overlapped_soln->col(0),
-        Albany::CombineMode::INSERT);
     InitialConditions(
+        current_soln->col(0),
         overlapped_soln->col(0),
+        cas_manager,
         wsElNodeEqID,
         wsEBNames,
         coords,
@@ -127,47 +126,31 @@ AdaptiveSolutionManager::AdaptiveSolutionManager(
         numDim,
         pbParams->sublist("Initial Condition"),
         disc_->hasRestartSolution());
-    cas_manager->combine(
-        overlapped_soln->col(0),
-        current_soln->col(0),
-        Albany::CombineMode::INSERT);
 
     if (num_time_deriv > 0) {
-      cas_manager->scatter(
-          current_soln->col(1),
-          overlapped_soln->col(1),
-          Albany::CombineMode::INSERT);
       InitialConditions(
+          current_soln->col(1),
           overlapped_soln->col(1),
+          cas_manager,
           wsElNodeEqID,
           wsEBNames,
           coords,
           neq,
           numDim,
           pbParams->sublist("Initial Condition Dot"));
-      cas_manager->combine(
-          overlapped_soln->col(1),
-          current_soln->col(1),
-          Albany::CombineMode::INSERT);
     }
 
     if (num_time_deriv > 1) {
-      cas_manager->scatter(
-          current_soln->col(2),
-          overlapped_soln->col(2),
-          Albany::CombineMode::INSERT);
       InitialConditions(
+          current_soln->col(2),
           overlapped_soln->col(2),
+          cas_manager,
           wsElNodeEqID,
           wsEBNames,
           coords,
           neq,
           numDim,
           pbParams->sublist("Initial Condition DotDot"));
-      cas_manager->combine(
-          overlapped_soln->col(1),
-          current_soln->col(1),
-          Albany::CombineMode::INSERT);
     }
   }
 #if defined(ALBANY_SCOREC)
@@ -190,6 +173,9 @@ AdaptiveSolutionManager::buildAdapter(const Teuchos::RCP<rc::Manager>& rc_mgr)
   if (method == "Copy Remesh") {
     adapter_ =
         Teuchos::rcp(new CopyRemesh(adaptParams_, paramLib_, stateMgr_, comm_));
+  } else if (method == "Cost Rebalance") {
+    adapter_ = Teuchos::rcp(
+        new CostRebalance(adaptParams_, paramLib_, stateMgr_, comm_));
   } else
 #if defined(ALBANY_LCM) && defined(ALBANY_BGL)
       if (method == "Topmod") {
@@ -259,6 +245,8 @@ AdaptiveSolutionManager::adaptProblem()
   // resize problem if the mesh adapts
   if (adapter_->adaptMesh()) {
     resizeMeshDataArrays(disc_);
+    // The adapter rebuilt the state arrays along with the mesh
+    stateMgr_.updateStateArrayHandles();
 
     Teuchos::RCP<Thyra::ModelEvaluatorDelegatorBase<ST>> base =
         Teuchos::rcp_dynamic_cast<Thyra::ModelEvaluatorDelegatorBase<ST>>(
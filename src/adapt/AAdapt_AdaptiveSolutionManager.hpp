@@ -30,7 +30,7 @@ public:
         const Teuchos::RCP<Teuchos::ParameterList>& appParams,
         const Teuchos::RCP<const Thyra_Vector>& initial_guess,
         const Teuchos::RCP<ParamLib>& param_lib,
-        const Albany::StateManager& StateMgr,
+        Albany::StateManager& StateMgr,
         const Teuchos::RCP<rc::Manager>& rc_mgr,
         const Teuchos::RCP<const Teuchos_Comm>& comm);
 
@@ -87,7 +87,7 @@ private:
     const Teuchos::RCP<Teuchos::ParameterList> appParams_;
     const Teuchos::RCP<Albany::AbstractDiscretization> disc_;
     const Teuchos::RCP<ParamLib>& paramLib_;
-    const Albany::StateManager& stateMgr_;
+    Albany::StateManager& stateMgr_;
     const Teuchos::RCP<const Teuchos_Comm> comm_;
 
     //! Output stream, defaults to printing just Proc 0
@@ -32,6 +32,8 @@ class AnalyticFunction {
   public:
     virtual ~AnalyticFunction() {}
     virtual void compute(double* x, const double* X) = 0;
+    //! Whether compute can be called concurrently (it does not modify any state)
+    virtual bool isThreadSafe() const { return true; }
 };
 
 // Factory method to build functions based on a string name
@@ -118,6 +120,7 @@ class ConstantFunctionPerturbed : public AnalyticFunction {
     ConstantFunctionPerturbed(int neq_, int numDim_, int worksetID,
                               Teuchos::Array<double> const_data_, Teuchos::Array<double> pert_mag_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -134,6 +137,7 @@ class ConstantFunctionGaussianPerturbed : public AnalyticFunction {
     ConstantFunctionGaussianPerturbed(int neq_, int numDim_, int worksetID,
                                       Teuchos::Array<double> const_data_, Teuchos::Array<double> pert_mag_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -322,6 +326,7 @@ class AerasHydrostaticBaroclinicInstabilities : public AnalyticFunction {
   public:
     AerasHydrostaticBaroclinicInstabilities(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
@@ -393,6 +398,7 @@ class AerasXZHydrostaticCloud : public AnalyticFunction {
   public:
     AerasXZHydrostaticCloud(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     const int numDim; // size of coordinate vector X
     const int neq;    // size of solution vector x
@@ -563,6 +569,7 @@ class AerasTC4Init : public AnalyticFunction {
   public:
     AerasTC4Init(int neq_, int spatialDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
 
   private:
     int spatialDim; // size of coordinate vector X
@@ -623,6 +630,7 @@ class ExpressionParser : public AnalyticFunction {
   public:
     ExpressionParser(int neq_, int spatialDim_, std::string expressionX_, std::string expressionY_, std::string expressionZ_);
     void compute(double* x, const double* X);
+    bool isThreadSafe() const { return false; }
   private:
     int spatialDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -0,0 +1,167 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "AAdapt_CostRebalance.hpp"
+
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+
+namespace AAdapt {
+
+//----------------------------------------------------------------------------
+CostRebalance::
+CostRebalance(Teuchos::RCP<Teuchos::ParameterList> const & params,
+              Teuchos::RCP<ParamLib>               const & param_lib,
+              Albany::StateManager                 const & state_mgr,
+              Teuchos::RCP<Teuchos_Comm const>     const & comm)
+ : AbstractAdapter(params, param_lib, state_mgr, comm)
+ , remesh_file_index_(1)
+{
+#ifndef ALBANY_ZOLTAN
+  TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+      "Error! The 'Cost Rebalance' adaptation method requires Zoltan.\n");
+#endif
+
+  discretization_ = state_mgr_.getDiscretization();
+
+  stk_discretization_ =
+    static_cast<Albany::STKDiscretization*>(discretization_.get());
+
+  stk_mesh_struct_ = Teuchos::rcp_dynamic_cast<Albany::GenericSTKMeshStruct>(
+    stk_discretization_->getSTKMeshStruct());
+  TEUCHOS_TEST_FOR_EXCEPTION(stk_mesh_struct_.is_null(), std::logic_error,
+      "Error! The 'Cost Rebalance' adaptation method requires a generic STK mesh.\n");
+
+  // Albany::Application registers the cost state with the same name
+  cost_name_ = adapt_params_->get<std::string>("Cost Field Name", "evaluation_cost");
+  imbalance_threshold_ = adapt_params_->get<double>("Imbalance Threshold", 1.2);
+
+  // Save the initial output file name
+  base_exo_filename_ = stk_mesh_struct_->exoOutFile;
+}
+
+//----------------------------------------------------------------------------
+bool CostRebalance::queryAdaptationCriteria(int iter) {
+
+  if(teuchos_comm_->getSize() == 1) {
+    return false;
+  }
+
+  Teuchos::Array<int> remesh_iter =
+    adapt_params_->get<Teuchos::Array<int> >("Remesh Step Number", Teuchos::Array<int>());
+
+  for(int i = 0; i < remesh_iter.size(); i++) {
+    if(iter == remesh_iter[i]) {
+      return true;
+    }
+  }
+
+  const double imbalance = measureImbalance();
+
+  *output_stream_ << "Cost Rebalance: measured imbalance = " << imbalance
+                  << " (threshold = " << imbalance_threshold_ << ")\n";
+
+  return imbalance > imbalance_threshold_;
+}
+
+//----------------------------------------------------------------------------
+double CostRebalance::measureImbalance() const {
+
+  double local_cost = 0.0;
+  for (const auto& ws_states : state_mgr_.getStateArrays().elemStateArrays) {
+    const auto it = ws_states.find(cost_name_);
+    if (it == ws_states.end()) {
+      continue;
+    }
+    const Albany::MDArray& cost = it->second;
+    for (int i = 0; i < cost.size(); ++i) {
+      local_cost += cost[i];
+    }
+  }
+
+  double max_cost, total_cost;
+  Teuchos::reduceAll(*teuchos_comm_, Teuchos::REDUCE_MAX, local_cost, Teuchos::ptrFromRef(max_cost));
+  Teuchos::reduceAll(*teuchos_comm_, Teuchos::REDUCE_SUM, local_cost, Teuchos::ptrFromRef(total_cost));
+
+  if (total_cost <= 0.0) {
+    return 1.0;
+  }
+
+  return max_cost * teuchos_comm_->getSize() / total_cost;
+}
+
+//----------------------------------------------------------------------------
+void CostRebalance::resetCost() const {
+
+  for (auto& ws_states : state_mgr_.getStateArrays().elemStateArrays) {
+    auto it = ws_states.find(cost_name_);
+    if (it == ws_states.end()) {
+      continue;
+    }
+    Albany::MDArray& cost = it->second;
+    for (int i = 0; i < cost.size(); ++i) {
+      cost[i] = 0.0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool CostRebalance::adaptMesh(){
+
+  TEUCHOS_FUNC_TIME_MONITOR("AAdapt: Cost Rebalance");
+
+  *output_stream_ << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+  *output_stream_ << "Adapting mesh using CostRebalance method       \n";
+  *output_stream_ << "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  // The element sets of the ranks change: write to a new exodus file,
+  // named as in CopyRemesh
+  std::ostringstream ss;
+  std::string str = base_exo_filename_;
+  ss << "_" << remesh_file_index_ << ".";
+  str.replace(str.find('.'), 1, ss.str());
+
+  *output_stream_ << "Rebalancing: renaming output file to - " << str << std::endl;
+
+  stk_discretization_->reNameExodusOutput(str);
+
+  remesh_file_index_++;
+
+  // Zoltan weights each element with its accumulated cost. The cost field
+  // migrates with the elements, so the imbalance is also checked after.
+  Teuchos::RCP<Teuchos::ParameterList> rebalance_params =
+    Teuchos::rcp(new Teuchos::ParameterList(*adapt_params_));
+  rebalance_params->set<std::string>("Rebalance Weight Field", cost_name_);
+
+  stk_mesh_struct_->rebalanceAdaptedMeshT(rebalance_params, teuchos_comm_);
+
+  // Throw away all the Albany data structures and re-build them
+  // from the mesh
+  stk_discretization_->updateMesh();
+
+  resetCost();
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+Teuchos::RCP<const Teuchos::ParameterList>
+CostRebalance::getValidAdapterParameters() const {
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+    this->getGenericAdapterParams("ValidCostRebalanceParameters");
+
+  Teuchos::Array<int> defaultArgs;
+
+  validPL->set<Teuchos::Array<int> >("Remesh Step Number", defaultArgs, "Iteration steps at which to rebalance regardless of the imbalance");
+  validPL->set<std::string>("Cost Field Name", "evaluation_cost", "Element state accumulating the measured evaluation time");
+  validPL->set<double>("Imbalance Threshold", 1.2, "Rebalance when the max rank cost over the mean rank cost exceeds this");
+  validPL->sublist("Rebalance Options", false, "Zoltan parameters used for the rebalance");
+
+  return validPL;
+}
+//----------------------------------------------------------------------------
+
+} // namespace AAdapt
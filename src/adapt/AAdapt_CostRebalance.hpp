@@ -0,0 +1,96 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AADAPT_COST_REBALANCE_HPP
+#define AADAPT_COST_REBALANCE_HPP
+
+#include <Teuchos_RCP.hpp>
+#include <Teuchos_ParameterList.hpp>
+
+#include "AAdapt_AbstractAdapter.hpp"
+#include "Albany_GenericSTKMeshStruct.hpp"
+#include "Albany_STKDiscretization.hpp"
+
+namespace AAdapt {
+
+///
+/// Repartitions the mesh with Zoltan, weighting each element by its measured
+/// evaluation cost.
+///
+/// With this method, Albany::Application times the residual and Jacobian
+/// evaluation of each workset, and accumulates the time, split evenly among
+/// the cells of the workset, in the element state "Cost Field Name". The mesh
+/// is rebalanced when the measured imbalance (max over ranks of the local
+/// cost, divided by the mean) exceeds "Imbalance Threshold", or at the steps
+/// listed in "Remesh Step Number". The cost is reset after each rebalance.
+///
+class CostRebalance : public AbstractAdapter {
+public:
+
+  ///
+  /// Constructor(s) and Destructor
+  ///
+  CostRebalance() = delete;
+
+  CostRebalance (Teuchos::RCP<Teuchos::ParameterList> const & params,
+                 Teuchos::RCP<ParamLib>               const & param_lib,
+                 Albany::StateManager                 const & state_mgr,
+                 Teuchos::RCP<Teuchos_Comm const>     const & comm);
+
+  CostRebalance(CostRebalance const &) = delete;
+
+  ~CostRebalance() = default;
+
+  /// Disallow assignment
+  CostRebalance& operator=(CostRebalance const &) = delete;
+
+  ///
+  /// Check adaptation criteria to determine if the mesh needs
+  /// adapting
+  ///
+  virtual bool queryAdaptationCriteria(int iteration);
+
+  ///
+  /// Max over ranks of the local cost, divided by the mean local cost.
+  /// Returns 1 if no cost has been measured yet.
+  ///
+  double measureImbalance() const;
+
+  ///
+  /// Apply adaptation method to mesh and problem. Returns true if
+  /// adaptation is performed successfully.
+  ///
+  virtual bool adaptMesh();
+
+  ///
+  /// Each adapter must generate it's list of valid parameters
+  ///
+  Teuchos::RCP<Teuchos::ParameterList const>
+  getValidAdapterParameters() const;
+
+private:
+
+  ///
+  /// Zero the cost state, so that it only measures the new partition
+  ///
+  void resetCost() const;
+
+  Teuchos::RCP<Albany::AbstractDiscretization> discretization_;
+
+  Albany::STKDiscretization* stk_discretization_;
+
+  Teuchos::RCP<Albany::GenericSTKMeshStruct> stk_mesh_struct_;
+
+  std::string cost_name_;
+  double imbalance_threshold_;
+
+  int remesh_file_index_;
+  std::string base_exo_filename_;
+};
+
+} // namespace AAdapt
+
+#endif // AADAPT_COST_REBALANCE_HPP
@@ -12,6 +12,9 @@
 #include "AAdapt_AnalyticFunction.hpp"
 #include "Albany_Utils.hpp"
 #include "Albany_ThyraUtils.hpp"
+#include "Albany_GlobalLocalIndexer.hpp"
+
+#include <Kokkos_Core.hpp>
 
 namespace AAdapt {
 
@@ -41,15 +44,95 @@ getValidInitialConditionParameters(const Teuchos::ArrayRCP<std::string>& wsEBNam
   return validPL;
 }
 
+namespace {
+
+// A node, through the first (workset, element, local node) it appears at.
+struct NodeRef {
+  int ws;
+  int el;
+  int ln;
+};
+
+// The nodes owned by this rank, each listed once, and the map from overlapped
+// dof LIDs to owned dof LIDs (-1 if not owned).
+std::vector<NodeRef>
+getOwnedNodes (const Albany::Conn& wsElNodeEqID,
+               const Teuchos::RCP<const Albany::CombineAndScatterManager>& cas_manager,
+               Teuchos::Array<LO>& ov2owned)
+{
+  auto ov_indexer    = Albany::createGlobalLocalIndexer(cas_manager->getOverlappedVectorSpace());
+  auto owned_indexer = Albany::createGlobalLocalIndexer(cas_manager->getOwnedVectorSpace());
+  const LO num_ov_dofs = ov_indexer->getNumLocalElements();
+  ov2owned.resize(num_ov_dofs);
+  for (LO lid = 0; lid < num_ov_dofs; ++lid) {
+    ov2owned[lid] = owned_indexer->getLocalElement(ov_indexer->getGlobalElement(lid));
+  }
+
+  std::vector<NodeRef> nodes;
+  std::vector<bool> seen(num_ov_dofs, false);
+  for (int ws = 0; ws < wsElNodeEqID.size(); ws++) {
+    for (int el = 0; el < static_cast<int>(wsElNodeEqID[ws].extent(0)); el++) {
+      for (int ln = 0; ln < static_cast<int>(wsElNodeEqID[ws].extent(1)); ln++) {
+        const LO lid = wsElNodeEqID[ws](el,ln,0);
+        if (seen[lid]) continue;
+        seen[lid] = true;
+        if (ov2owned[lid] >= 0) nodes.push_back(NodeRef{ws, el, ln});
+      }
+    }
+  }
+  return nodes;
+}
+
+// Evaluate f once per node. x is read from and written back to soln_data, since
+// some functions only set some of the equations. Thread safe functions are
+// evaluated in parallel.
+void evaluateAtNodes (AAdapt::AnalyticFunction& f,
+                      const std::vector<NodeRef>& nodes,
+                      const Albany::Conn& wsElNodeEqID,
+                      const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >& coords,
+                      const Teuchos::Array<LO>& ov2owned,
+                      const int neq,
+                      const Teuchos::ArrayRCP<ST>& soln_data)
+{
+  const int num_nodes = nodes.size();
+  std::vector<double> values(num_nodes*neq);
+  for (int k = 0; k < num_nodes; ++k) {
+    const NodeRef& nd = nodes[k];
+    for (int i = 0; i < neq; ++i) {
+      values[k*neq + i] = soln_data[ov2owned[wsElNodeEqID[nd.ws](nd.el,nd.ln,i)]];
+    }
+  }
+
+  auto eval = [&] (const int k) {
+    const NodeRef& nd = nodes[k];
+    f.compute(&values[k*neq], coords[nd.ws][nd.el][nd.ln]);
+  };
+  if (f.isThreadSafe()) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, num_nodes), eval);
+  } else {
+    for (int k = 0; k < num_nodes; ++k) eval(k);
+  }
+
+  for (int k = 0; k < num_nodes; ++k) {
+    const NodeRef& nd = nodes[k];
+    for (int i = 0; i < neq; ++i) {
+      soln_data[ov2owned[wsElNodeEqID[nd.ws](nd.el,nd.ln,i)]] = values[k*neq + i];
+    }
+  }
+}
+
+} // namespace
+
 void InitialConditions (const Teuchos::RCP<Thyra_Vector>& soln,
+                       const Teuchos::RCP<Thyra_Vector>& overlapped_soln,
+                       const Teuchos::RCP<const Albany::CombineAndScatterManager>& cas_manager,
                        const Albany::Conn& wsElNodeEqID,
                        const Teuchos::ArrayRCP<std::string>& wsEBNames,
                        const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords,
                        const int neq, const int numDim,
                        Teuchos::ParameterList& icParams, const bool hasRestartSolution)
 {
-  auto soln_data = Albany::getNonconstLocalData(soln);
-
   // Called three times, with x, xdot, and xdotdot. Different param lists are sent in.
   icParams.validateParameters(*AAdapt::getValidInitialConditionParameters(wsEBNames), 0);
 
@@ -60,6 +143,7 @@ void InitialConditions (const Teuchos::RCP<Thyra_Vector>& soln,
   else                     name = icParams.get("Function","Restart");
 
   if (name=="Restart") {
+    cas_manager->scatter(soln, overlapped_soln, Albany::CombineMode::INSERT);
     return;
   }
   // Handle element block specific constant data
@@ -91,18 +175,16 @@ void InitialConditions (const Teuchos::RCP<Thyra_Vector>& soln,
  * conditions.
  */
 
-    // Use a Tpetra_Vector to hold the lumped mass matrix (has entries only on the diagonal). Zero-ed out.
-    Teuchos::RCP<Thyra_Vector> lumpedMMT = Thyra::createMember(soln->space());
-    lumpedMMT->assign(0.0);
+    // Accumulate the load vector and the lumped mass matrix (has entries only on the diagonal) on the
+    // overlapped distribution, then sum them on the owned one.
+    Teuchos::RCP<Thyra_Vector> overlappedLoad = Thyra::createMember(overlapped_soln->space());
+    Teuchos::RCP<Thyra_Vector> overlappedLumpedMM = Thyra::createMember(overlapped_soln->space());
+    overlappedLoad->assign(0.0);
+    overlappedLumpedMM->assign(0.0);
 
-    //get non-const view of lumpedMMT
-    auto lumpedMMT_data = Albany::getNonconstLocalData(lumpedMMT);
+    auto load_data = Albany::getNonconstLocalData(overlappedLoad);
+    auto lumpedMM_data = Albany::getNonconstLocalData(overlappedLumpedMM);
 
-    // Make sure soln is zeroed - we are accumulating into it
-    for(int i = 0; i < soln_data.size(); ++i) {
-      soln_data[i] = 0.0;
-    }
-  
     // Loop over all worksets, elements, all local nodes: compute soln as a function of coord and wsEBName
     std::vector<double> x; 
     x.resize(neq);
@@ -148,88 +230,73 @@ void InitialConditions (const Teuchos::RCP<Thyra_Vector>& soln,
         for (unsigned ln=0; ln < wsElNodeEqID[ws].extent(1); ln++) { // loop over node local to the element
           for (int i=0; i<neq; i++){
 
-             soln_data[wsElNodeEqID[ws](el,ln,i)] += x[i];
-//             (*soln)[wsElNodeEqID[ws](el,ln,i)] += X[i]; // Test with coord values
-             lumpedMMT_data[wsElNodeEqID[ws](el,ln,i)] += 1.0;
+             load_data[wsElNodeEqID[ws](el,ln,i)] += x[i];
+             lumpedMM_data[wsElNodeEqID[ws](el,ln,i)] += 1.0;
           }
     } } }
 
+    Teuchos::RCP<Thyra_Vector> lumpedMM = Thyra::createMember(soln->space());
+    lumpedMM->assign(0.0);
+    soln->assign(0.0);
+    cas_manager->combine(overlappedLoad, soln, Albany::CombineMode::ADD);
+    cas_manager->combine(overlappedLumpedMM, lumpedMM, Albany::CombineMode::ADD);
+
 //  Apply the inverted lumped mass matrix to get the final nodal projection
 
-    for(int i = 0; i < soln_data.size(); ++i) {
-      soln_data[i] /= lumpedMMT_data[i];
+    {
+      auto soln_data = Albany::getNonconstLocalData(soln);
+      auto lumpedMM_owned_data = Albany::getLocalData(lumpedMM.getConst());
+      for(int i = 0; i < soln_data.size(); ++i) {
+        soln_data[i] /= lumpedMM_owned_data[i];
+      }
     }
 
+    cas_manager->scatter(soln, overlapped_soln, Albany::CombineMode::INSERT);
     return;
   }
 
-  if(name == "Coordinates") {
-    // Place the coordinate locations of the nodes into the solution vector for an initial guess
+  // The remaining functions are evaluated once per owned node
+  {
+    Teuchos::Array<LO> ov2owned;
+    const std::vector<NodeRef> nodes = getOwnedNodes(wsElNodeEqID, cas_manager, ov2owned);
+    auto soln_data = Albany::getNonconstLocalData(soln);
 
-    int numDOFsPerDim = neq / numDim;
+    if(name == "Coordinates") {
+      // Place the coordinate locations of the nodes into the solution vector for an initial guess
 
-    for(int ws = 0; ws < wsElNodeEqID.size(); ws++) {
-      for(unsigned el = 0; el < wsElNodeEqID[ws].extent(0); el++) {
-        for(unsigned ln = 0; ln < wsElNodeEqID[ws].extent(1); ln++) {
+      int numDOFsPerDim = neq / numDim;
 
-          const double* X = coords[ws][el][ln];
-          for(int j = 0; j < numDOFsPerDim; j++)
-            for(int i = 0; i < numDim; i++)
-             soln_data[wsElNodeEqID[ws](el,ln,j * numDim + i)] = X[i];
-        }
+      for (const NodeRef& nd : nodes) {
+        const double* X = coords[nd.ws][nd.el][nd.ln];
+        for(int j = 0; j < numDOFsPerDim; j++)
+          for(int i = 0; i < numDim; i++)
+            soln_data[ov2owned[wsElNodeEqID[nd.ws](nd.el,nd.ln,j * numDim + i)]] = X[i];
       }
-    }
-  } else if(name == "Expression Parser") {
+    } else if(name == "Expression Parser") {
 
-    std::string defaultExpression = "value = 0.0";
+      std::string defaultExpression = "value = 0.0";
 
-    std::string expressionX = icParams.get("Function Expression for DOF X", defaultExpression);
-    std::string expressionY = icParams.get("Function Expression for DOF Y", defaultExpression);
-    std::string expressionZ = icParams.get("Function Expression for DOF Z", defaultExpression);
+      std::string expressionX = icParams.get("Function Expression for DOF X", defaultExpression);
+      std::string expressionY = icParams.get("Function Expression for DOF Y", defaultExpression);
+      std::string expressionZ = icParams.get("Function Expression for DOF Z", defaultExpression);
 
-    Teuchos::RCP<AAdapt::AnalyticFunction> initFunc = Teuchos::rcp(new AAdapt::ExpressionParser(neq, numDim, expressionX, expressionY, expressionZ));
+      Teuchos::RCP<AAdapt::AnalyticFunction> initFunc = Teuchos::rcp(new AAdapt::ExpressionParser(neq, numDim, expressionX, expressionY, expressionZ));
 
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (unsigned el=0; el < wsElNodeEqID[ws].extent(0); el++) {
-        for (unsigned ln=0; ln < wsElNodeEqID[ws].extent(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) {
-            x[i] = soln_data[wsElNodeEqID[ws](el,ln,i)];
-          }
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) {
-            soln_data[wsElNodeEqID[ws](el,ln,i)] = x[i];
-          }
-        }
-      }
-    }
-  } else {
-    Teuchos::Array<double> defaultData(neq);
-    Teuchos::Array<double> data = icParams.get("Function Data", defaultData);
+      evaluateAtNodes(*initFunc, nodes, wsElNodeEqID, coords, ov2owned, neq, soln_data);
+    } else {
+      Teuchos::Array<double> defaultData(neq);
+      Teuchos::Array<double> data = icParams.get("Function Data", defaultData);
   
-    // Call factory method from library of initial condition functions
-    Teuchos::RCP<AAdapt::AnalyticFunction> initFunc
-      = createAnalyticFunction(name, neq, numDim, data);
+      // Call factory method from library of initial condition functions
+      Teuchos::RCP<AAdapt::AnalyticFunction> initFunc
+        = createAnalyticFunction(name, neq, numDim, data);
   
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (unsigned el=0; el < wsElNodeEqID[ws].extent(0); el++) {
-        for (unsigned ln=0; ln < wsElNodeEqID[ws].extent(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) {
-            x[i] = soln_data[wsElNodeEqID[ws](el,ln,i)];
-          }
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) {
-            soln_data[wsElNodeEqID[ws](el,ln,i)] = x[i];
-          }
-        }
-      }
+      evaluateAtNodes(*initFunc, nodes, wsElNodeEqID, coords, ov2owned, neq, soln_data);
     }
   }
+
+  // Single halo exchange to fill the ghosted dofs
+  cas_manager->scatter(soln, overlapped_soln, Albany::CombineMode::INSERT);
 }
 
 } // namespace AAdapt
@@ -9,13 +9,18 @@
 
 #include "Albany_DataTypes.hpp"
 #include "Albany_DiscretizationUtils.hpp"
+#include "Albany_CombineAndScatterManager.hpp"
 
 #include <string>
 #include "Teuchos_ParameterList.hpp"
 
 namespace AAdapt {
 
-void InitialConditions (const Teuchos::RCP<Thyra_Vector>& solnT,
+//! Set the initial condition on the owned dofs of soln and scatter it to
+//! overlapped_soln. Analytic functions are evaluated once per owned node.
+void InitialConditions (const Teuchos::RCP<Thyra_Vector>& soln,
+                       const Teuchos::RCP<Thyra_Vector>& overlapped_soln,
+                       const Teuchos::RCP<const Albany::CombineAndScatterManager>& cas_manager,
                        const Albany::Conn& wsElNodeEqID,
                        const Teuchos::ArrayRCP<std::string>& wsEBNames,
                        const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > > coords,
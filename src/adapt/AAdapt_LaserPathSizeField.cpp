@@ -0,0 +1,120 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+
+#include "AAdapt_LaserPathSizeField.hpp"
+#include "Albany_PUMIMeshStruct.hpp"
+
+#include <vector>
+
+namespace {
+const char* const size_field_name = "laser_path_size";
+}
+
+AAdapt::LaserPathSizeField::LaserPathSizeField(const Teuchos::RCP<Albany::APFDiscretization>& disc) :
+  MeshAdaptMethod(disc),
+  path_index_stale(false),
+  laser_time(0.0) {
+}
+
+void
+AAdapt::LaserPathSizeField::adaptMesh(
+    const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_)
+{
+
+  laserIsoFunc.field = mesh_struct->getMesh()->findField(size_field_name);
+  ma::Input *in = ma::configure(mesh_struct->getMesh(), &laserIsoFunc);
+
+  in->maximumIterations = adapt_params_->get<int>("Max Number of Mesh Adapt Iterations", 1);
+  in->shouldSnap = false;
+
+  setCommonMeshAdaptOptions(adapt_params_, in);
+
+  ma::adapt(in);
+
+}
+
+void
+AAdapt::LaserPathSizeField::setParams(
+    const Teuchos::RCP<Teuchos::ParameterList>& p) {
+
+  path_params.beam_radius = p->get<double>("Laser Beam Radius", 0.1);
+  TEUCHOS_TEST_FOR_EXCEPTION(path_params.beam_radius <= 0, std::logic_error,
+      "Non-positive Laser Beam Radius\n");
+  laser_time_step = p->get<double>("Laser Time Step", 1.0);
+  laser_height = p->get<double>("Laser Height", 0.0);
+  path_size = p->get<double>("Laser Path Element Size", 0.02);
+  background_size = p->get<double>("Target Element Size", 0.1);
+  if (laser.is_null()) {
+    laser = Teuchos::rcp(new AMP::Laser());
+    laser_time = p->get<double>("Laser Start Time", 0.0);
+  }
+}
+
+apf::Vector3
+AAdapt::LaserPathSizeField::getLaserPoint(double time)
+{
+  AMP::LaserCenter center;
+  center.t = time;
+  RealType x, y, power_fraction;
+  int power;
+  laser->getLaserPosition(time, center, x, y, power, power_fraction);
+  return apf::Vector3(x, y, laser_height);
+}
+
+/* The background size, and the path size within a beam radius of the
+   laser: the path updates then carry the path size along. */
+apf::Field*
+AAdapt::LaserPathSizeField::createSizeField(apf::Vector3 const& laser_point)
+{
+  apf::Mesh2* mesh = mesh_struct->getMesh();
+  apf::Field* size_field = apf::createFieldOn(mesh, size_field_name, apf::SCALAR);
+  apf::MeshIterator* it = mesh->begin(0);
+  apf::MeshEntity* v;
+  while ((v = mesh->iterate(it)))
+    apf::setScalar(size_field, v, 0, background_size);
+  mesh->end(it);
+
+  std::vector<Albany::PathVertexIndex::Vertex> near;
+  path_index->collectNearSegment(laser_point, laser_point,
+      path_params.beam_radius, near);
+  for (auto const& vertex : near)
+    if ((vertex.point - laser_point).getLength() < path_params.beam_radius)
+      apf::setScalar(size_field, vertex.entity, 0, path_size);
+  return size_field;
+}
+
+void
+AAdapt::LaserPathSizeField::preProcessOriginalMesh()
+{
+  apf::Mesh2* mesh = mesh_struct->getMesh();
+
+  // The vertices change in the adaptation and in the reordering after it
+  if (path_index.is_null()) {
+    path_index = Teuchos::rcp(
+        new Albany::PathVertexIndex(mesh, path_params.beam_radius));
+  } else if (path_index_stale) {
+    path_index->rebuild();
+  }
+  path_index_stale = false;
+
+  apf::Vector3 const old_point = getLaserPoint(laser_time);
+  apf::Vector3 const new_point = getLaserPoint(laser_time + laser_time_step);
+
+  apf::Field* size_field = mesh->findField(size_field_name);
+  if (size_field == NULL)
+    size_field = createSizeField(old_point);
+
+  Albany::addPredictedLaserSizeField(mesh, size_field, *path_index,
+      old_point, new_point, path_params);
+  laser_time += laser_time_step;
+}
+
+void
+AAdapt::LaserPathSizeField::postProcessFinalMesh()
+{
+  path_index_stale = true;
+}
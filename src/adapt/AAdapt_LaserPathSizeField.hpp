@@ -0,0 +1,72 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AADAPT_LASERPATHSIZEFIELD_HPP
+#define AADAPT_LASERPATHSIZEFIELD_HPP
+
+#include "AAdapt_MeshAdaptMethod.hpp"
+
+#include "Laser.hpp"
+#include "PathSizeField.hpp"
+
+namespace AAdapt {
+
+/*! \brief Refines the mesh ahead of the AMP laser
+ *
+ *  Keeps a vertex size field on the mesh, fine within a beam radius of the
+ *  laser and coarse elsewhere. Each adaptation advances the laser by one
+ *  laser time step along the path of LaserCenter.txt, and copies the size
+ *  at the old laser position along the swept segment before adapting. The
+ *  vertex index used for that is kept across adaptations and rebuilt once
+ *  the mesh has been adapted.
+ */
+class LaserPathSizeField : public MeshAdaptMethod {
+
+  public:
+    LaserPathSizeField(const Teuchos::RCP<Albany::APFDiscretization>& disc);
+
+    void adaptMesh(const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_);
+
+    void setParams(const Teuchos::RCP<Teuchos::ParameterList>& p);
+
+    void preProcessOriginalMesh();
+    void preProcessShrunkenMesh() {}
+    void postProcessShrunkenMesh() {}
+    void postProcessFinalMesh();
+
+    class LaserIsoFunc : public ma::IsotropicFunction
+    {
+      public:
+        apf::Field* field;
+        virtual ~LaserIsoFunc(){}
+    /** \brief get the desired element size at this vertex */
+        virtual double getValue(ma::Entity* v){
+            return apf::getScalar(field,v,0);
+        }
+    } laserIsoFunc;
+
+  private:
+
+    apf::Vector3 getLaserPoint(double time);
+    apf::Field* createSizeField(apf::Vector3 const& laser_point);
+
+    Teuchos::RCP<AMP::Laser> laser;
+    Teuchos::RCP<Albany::PathVertexIndex> path_index;
+    // the mesh has been adapted since path_index was built
+    bool path_index_stale;
+
+    Albany::PathSizeParameters path_params;
+    double laser_time;
+    double laser_time_step;
+    double laser_height;
+    double path_size;
+    double background_size;
+
+};
+
+}
+
+#endif
@@ -25,6 +25,9 @@
 #ifdef ALBANY_OMEGA_H
 #include "AAdapt_MeshAdapt_Omega_h.hpp"
 #endif
+#ifdef ALBANY_AMP
+#include "AAdapt_LaserPathSizeField.hpp"
+#endif
 
 #include "AAdapt_RC_Manager.hpp"
 
@@ -106,6 +109,10 @@ MeshAdapt(const Teuchos::RCP<Teuchos::ParameterList>& params_,
 #ifdef ALBANY_OMEGA_H
   else if (method == "RPI Omega_h")
     szField = Teuchos::rcp(new Omega_h_Method(pumi_discretization));
+#endif
+#ifdef ALBANY_AMP
+  else if (method == "RPI Laser Path Size")
+    szField = Teuchos::rcp(new LaserPathSizeField(pumi_discretization));
 #endif
   else
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
@@ -528,6 +535,13 @@ MeshAdapt::getValidAdapterParameters() const
   validPL->set<bool>("Write Adapted SMB Files", false, "Write .smb mesh files after adaptation");
   validPL->set<std::string>("Extruded Size Method", "SPR", "Error estimator for extruded meshes");
 
+  /* LaserPathSizeField options */
+  validPL->set<double>("Laser Beam Radius", 0.1, "Radius of the refined region around the laser path");
+  validPL->set<double>("Laser Path Element Size", 0.02, "Element size around the laser path");
+  validPL->set<double>("Laser Time Step", 1.0, "Laser time advanced by each adaptation");
+  validPL->set<double>("Laser Start Time", 0.0, "Laser time at the first adaptation");
+  validPL->set<double>("Laser Height", 0.0, "Coordinate of the laser normal to the scan plane");
+
   /* Omega_h_Method options */
   validPL->set<double>("Maximum Size", 1.0, "Max element size, prevents infinity when error is zero");
   validPL->set<int>("Metric Smooth Steps", 0, "Metric smoothing, number of iterations");
@@ -16,6 +16,7 @@
 #include "AAdapt_RC_Writer.hpp"
 #include "AAdapt_RC_Projector_impl.hpp"
 #include "AAdapt_RC_Manager.hpp"
+#include "AAdapt_RC_Transforms.hpp"
 
 #include "Albany_ThyraUtils.hpp"
 #include "Albany_ThyraTypes.hpp"
@@ -133,6 +134,14 @@ void transformStateArray (const Direction::Enum dir,
     }
   } break;
   case Transformation::right_polar_LieR_LieS: {
+    if (mda1.dimension(2) == 3) {
+      // Closed-form maps, in parallel over (cell, qp).
+      if (dir == Direction::G2g)
+        transforms::right_polar_LieR_LieS_G2g(mda1, mda2);
+      else
+        transforms::right_polar_LieR_LieS_g2G(mda1, mda2);
+      break;
+    }
     loop(mda1, cell, 0) loop(mda1, qp, 1) {
       if (dir == Direction::G2g) {
         // Copy mda2 (provisional) -> local.
@@ -0,0 +1,265 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <cmath>
+
+#include <Kokkos_Core.hpp>
+
+#include "AAdapt_RC_Transforms.hpp"
+
+namespace AAdapt {
+namespace rc {
+namespace transforms {
+
+namespace {
+typedef minitensor::Vector<RealType, 3> Vector3;
+
+// Relative eigenvalue gap below which two eigenvalues are treated as a
+// cluster. Inside a cluster, f is linearized about the cluster mean, so the
+// error is O(f'' gap^2); outside, the eigenvector error is O(eps/gap).
+const RealType cluster_tol = 1e-5;
+
+Tensor3 sym_part (const Tensor3& A) {
+  Tensor3 S;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      S(i,j) = 0.5*(A(i,j) + A(j,i));
+  return S;
+}
+
+// Unit eigenvector of the symmetric A for the simple eigenvalue lambda: the
+// largest cross product of two rows of A - lambda I.
+Vector3 eigenvector (const Tensor3& A, const RealType lambda) {
+  Vector3 rows[3];
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      rows[i](j) = A(i,j) - (i == j ? lambda : 0);
+  Vector3 best = minitensor::cross(rows[0], rows[1]);
+  RealType best_norm = minitensor::norm(best);
+  for (int k = 0; k < 2; ++k) {
+    const Vector3 c = minitensor::cross(rows[k], rows[2]);
+    const RealType c_norm = minitensor::norm(c);
+    if (c_norm > best_norm) { best = c; best_norm = c_norm; }
+  }
+  if (best_norm == 0) {
+    best(0) = 1; best(1) = 0; best(2) = 0;
+    return best;
+  }
+  return best / best_norm;
+}
+
+// Spectral data of a symmetric 3x3 tensor, enough to evaluate any isotropic
+// function f(A) = sum_i f(lambda_i) v_i v_i^T.
+class SymmetricSpectrum {
+public:
+  explicit SymmetricSpectrum (const Tensor3& A) : A_(sym_part(A)) {
+    const RealType q = minitensor::trace(A_)/3;
+    const RealType p1 = A_(0,1)*A_(0,1) + A_(0,2)*A_(0,2) + A_(1,2)*A_(1,2);
+    const RealType p2 = ((A_(0,0) - q)*(A_(0,0) - q) +
+                         (A_(1,1) - q)*(A_(1,1) - q) +
+                         (A_(2,2) - q)*(A_(2,2) - q) + 2*p1);
+    mean_ = q;
+    if (p2 == 0) {
+      kind_ = triple;
+      return;
+    }
+
+    // Trigonometric solution of the characteristic cubic,
+    // lambda_0 >= lambda_1 >= lambda_2.
+    const RealType p = std::sqrt(p2/6);
+    Tensor3 B;
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        B(i,j) = (A_(i,j) - (i == j ? q : 0))/p;
+    RealType r = minitensor::det(B)/2;
+    r = std::max<RealType>(-1, std::min<RealType>(1, r));
+    const RealType phi = std::acos(r)/3;
+    lambda_[0] = q + 2*p*std::cos(phi);
+    lambda_[2] = q + 2*p*std::cos(phi + 2*M_PI/3);
+    lambda_[1] = 3*q - lambda_[0] - lambda_[2];
+
+    const RealType tol = cluster_tol*std::max(std::abs(lambda_[0]),
+                                              std::abs(lambda_[2]));
+    const bool c01 = lambda_[0] - lambda_[1] <= tol;
+    const bool c12 = lambda_[1] - lambda_[2] <= tol;
+    if (c01 && c12) {
+      kind_ = triple;
+    } else if (c01) {
+      kind_ = double_high;
+      mean_ = 0.5*(lambda_[0] + lambda_[1]);
+      v_[1] = eigenvector(A_, lambda_[2]);
+    } else if (c12) {
+      kind_ = double_low;
+      mean_ = 0.5*(lambda_[1] + lambda_[2]);
+      v_[0] = eigenvector(A_, lambda_[0]);
+    } else {
+      kind_ = simple;
+      v_[0] = eigenvector(A_, lambda_[0]);
+      v_[1] = eigenvector(A_, lambda_[2]);
+    }
+  }
+
+  // f(A), given f and its derivative df.
+  template <typename F, typename DF>
+  Tensor3 apply (const F& f, const DF& df) const {
+    const Tensor3 I = minitensor::eye<RealType, 3>(3);
+    switch (kind_) {
+    case triple:
+      return f(mean_)*I + df(mean_)*(A_ - mean_*I);
+    case double_high:
+    case double_low: {
+      // One simple eigenvalue; linearize f on the clustered subspace.
+      const RealType ls = kind_ == double_high ? lambda_[2] : lambda_[0];
+      const Vector3& vs = kind_ == double_high ? v_[1] : v_[0];
+      const Tensor3 Ps = minitensor::dyad(vs, vs);
+      const Tensor3 P = I - Ps;
+      return (f(ls)*Ps + f(mean_)*P +
+              df(mean_)*sym_part(A_ - ls*Ps - mean_*P));
+    }
+    default: {
+      const RealType f1 = f(lambda_[1]);
+      return (f1*I +
+              (f(lambda_[0]) - f1)*minitensor::dyad(v_[0], v_[0]) +
+              (f(lambda_[2]) - f1)*minitensor::dyad(v_[1], v_[1]));
+    }
+    }
+  }
+
+private:
+  enum Kind { simple, double_high, double_low, triple };
+  Tensor3 A_;
+  Kind kind_;
+  RealType lambda_[3], mean_;
+  // The eigenvectors that are needed: for simple, those of lambda_0 and
+  // lambda_2; otherwise, only that of the simple eigenvalue.
+  Vector3 v_[2];
+};
+
+Tensor3 skew (const Vector3& w) {
+  Tensor3 W;
+  W(0,0) = 0;     W(0,1) = -w(2); W(0,2) = w(1);
+  W(1,0) = w(2);  W(1,1) = 0;     W(1,2) = -w(0);
+  W(2,0) = -w(1); W(2,1) = w(0);  W(2,2) = 0;
+  return W;
+}
+
+// log of a rotation through its unit quaternion (Shepperd's method), which is
+// well conditioned for all angles in [0, pi].
+Tensor3 log_rotation (const Tensor3& R) {
+  const RealType tr = minitensor::trace(R);
+  RealType w, x, y, z;
+  if (tr >= R(0,0) && tr >= R(1,1) && tr >= R(2,2)) {
+    w = 0.5*std::sqrt(std::max<RealType>(0, 1 + tr));
+    const RealType d = 0.25/w;
+    x = (R(2,1) - R(1,2))*d; y = (R(0,2) - R(2,0))*d; z = (R(1,0) - R(0,1))*d;
+  } else if (R(0,0) >= R(1,1) && R(0,0) >= R(2,2)) {
+    x = 0.5*std::sqrt(std::max<RealType>(0, 1 + R(0,0) - R(1,1) - R(2,2)));
+    const RealType d = 0.25/x;
+    w = (R(2,1) - R(1,2))*d; y = (R(0,1) + R(1,0))*d; z = (R(0,2) + R(2,0))*d;
+  } else if (R(1,1) >= R(2,2)) {
+    y = 0.5*std::sqrt(std::max<RealType>(0, 1 - R(0,0) + R(1,1) - R(2,2)));
+    const RealType d = 0.25/y;
+    w = (R(0,2) - R(2,0))*d; x = (R(0,1) + R(1,0))*d; z = (R(1,2) + R(2,1))*d;
+  } else {
+    z = 0.5*std::sqrt(std::max<RealType>(0, 1 - R(0,0) - R(1,1) + R(2,2)));
+    const RealType d = 0.25/z;
+    w = (R(1,0) - R(0,1))*d; x = (R(0,2) + R(2,0))*d; y = (R(1,2) + R(2,1))*d;
+  }
+  if (w < 0) { w = -w; x = -x; y = -y; z = -z; }
+  // angle = 2 atan2(|v|, w) and log(R) = skew(angle v/|v|).
+  const RealType sv = std::sqrt(x*x + y*y + z*z);
+  const RealType t = sv/w;
+  const RealType factor = (t < 1e-4 ? (2/w)*(1 - t*t/3) :
+                           2*std::atan2(sv, w)/sv);
+  Vector3 v;
+  v(0) = factor*x; v(1) = factor*y; v(2) = factor*z;
+  return skew(v);
+}
+
+// Rodrigues formula.
+Tensor3 exp_skew_symmetric (const Tensor3& r) {
+  Vector3 v;
+  v(0) = 0.5*(r(2,1) - r(1,2));
+  v(1) = 0.5*(r(0,2) - r(2,0));
+  v(2) = 0.5*(r(1,0) - r(0,1));
+  const RealType theta = minitensor::norm(v);
+  RealType a, b;
+  if (theta < 1e-4) {
+    a = 1 - theta*theta/6;
+    b = 0.5 - theta*theta/24;
+  } else {
+    a = std::sin(theta)/theta;
+    b = (1 - std::cos(theta))/(theta*theta);
+  }
+  const Tensor3 W = skew(v);
+  return minitensor::eye<RealType, 3>(3) + a*W + b*minitensor::dot(W, W);
+}
+
+void load (const Albany::MDArray& mda, const int cell, const int qp,
+           Tensor3& A) {
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      A(i,j) = mda(cell, qp, i, j);
+}
+
+// shards::Array::operator() is const and returns a non-const reference.
+void store (const Tensor3& A, const int cell, const int qp,
+            const Albany::MDArray& mda) {
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      mda(cell, qp, i, j) = A(i,j);
+}
+
+typedef Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace> HostPolicy;
+} // namespace
+
+void right_polar_LieR_LieS_G2g (const Tensor3& F, Tensor3& r, Tensor3& s) {
+  // C = F^T F = V diag(mu) V^T, U = C^(1/2), R = F U^-1, log(U) = log(C)/2.
+  const SymmetricSpectrum C(minitensor::t_dot(F, F));
+  const Tensor3 Uinv = C.apply(
+    [] (const RealType mu) { return 1/std::sqrt(mu); },
+    [] (const RealType mu) { return -0.5/(mu*std::sqrt(mu)); });
+  s = C.apply(
+    [] (const RealType mu) { return 0.5*std::log(mu); },
+    [] (const RealType mu) { return 0.5/mu; });
+  r = log_rotation(minitensor::dot(F, Uinv));
+}
+
+Tensor3 right_polar_LieR_LieS_g2G (const Tensor3& r, const Tensor3& s) {
+  const auto exp = [] (const RealType lambda) { return std::exp(lambda); };
+  const Tensor3 S = SymmetricSpectrum(s).apply(exp, exp);
+  return minitensor::dot(exp_skew_symmetric(r), S);
+}
+
+void right_polar_LieR_LieS_G2g (Albany::MDArray& mda1, Albany::MDArray& mda2) {
+  const int nqp = mda1.dimension(1);
+  const int n = mda1.dimension(0)*nqp;
+  Kokkos::parallel_for(HostPolicy(0, n), [=] (const int k) {
+    const int cell = k / nqp, qp = k % nqp;
+    Tensor3 F, r, s;
+    load(mda2, cell, qp, F);
+    right_polar_LieR_LieS_G2g(F, r, s);
+    store(r, cell, qp, mda1);
+    store(s, cell, qp, mda2);
+  });
+}
+
+void right_polar_LieR_LieS_g2G (Albany::MDArray& mda1,
+                                const Albany::MDArray& mda2) {
+  const int nqp = mda1.dimension(1);
+  const int n = mda1.dimension(0)*nqp;
+  Kokkos::parallel_for(HostPolicy(0, n), [=] (const int k) {
+    const int cell = k / nqp, qp = k % nqp;
+    Tensor3 r, s;
+    load(mda1, cell, qp, r);
+    load(mda2, cell, qp, s);
+    store(right_polar_LieR_LieS_g2G(r, s), cell, qp, mda1);
+  });
+}
+
+} // namespace transforms
+} // namespace rc
+} // namespace AAdapt
@@ -0,0 +1,52 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AADAPT_RC_TRANSFORMS_HPP
+#define AADAPT_RC_TRANSFORMS_HPP
+
+#include <MiniTensor.h>
+
+#include "Albany_StateInfoStruct.hpp"
+
+namespace AAdapt {
+namespace rc {
+
+/*! \brief Closed-form 3x3 tensor maps for Transformation::right_polar_LieR_LieS.
+ *
+ *  The general-dimension path in rc::Manager uses runtime-sized
+ *  minitensor::Tensor and the iterative polar_right, log_rotation, log_sym,
+ *  exp_skew_symmetric and exp. In 3D, the same maps are computed here without
+ *  iteration or allocation: the symmetric functions use the closed-form
+ *  eigenvalues of a 3x3 symmetric tensor and the rotations use a quaternion
+ *  (log) and the Rodrigues formula (exp).
+ */
+namespace transforms {
+
+typedef minitensor::Tensor<RealType, 3> Tensor3;
+
+//! F = R U -> (log(R), log(U)).
+void
+right_polar_LieR_LieS_G2g(const Tensor3& F, Tensor3& r, Tensor3& s);
+
+//! (log(R), log(U)) -> R U.
+Tensor3
+right_polar_LieR_LieS_g2G(const Tensor3& r, const Tensor3& s);
+
+//! Batched right_polar_LieR_LieS_G2g over all (cell, qp). On input, mda2
+//! holds F; on output, mda1 holds log(R) and mda2 holds log(U).
+void
+right_polar_LieR_LieS_G2g(Albany::MDArray& mda1, Albany::MDArray& mda2);
+
+//! Batched right_polar_LieR_LieS_g2G over all (cell, qp). On output, mda1
+//! holds R U.
+void
+right_polar_LieR_LieS_g2G(Albany::MDArray& mda1, const Albany::MDArray& mda2);
+
+} // namespace transforms
+} // namespace rc
+} // namespace AAdapt
+
+#endif // AADAPT_RC_TRANSFORMS_HPP
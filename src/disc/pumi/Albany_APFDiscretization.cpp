@@ -163,6 +163,9 @@ setCoordinates(const Teuchos::ArrayRCP<const double>& c)
       apf::setComponents(f, overlapNodes[i].entity, overlapNodes[i].node, buf);
     }
   }
+
+  // Refresh the coordinates and null space given to the preconditioner
+  setupMLCoords();
 }
 
 void APFDiscretization::
@@ -179,7 +182,10 @@ void APFDiscretization::setupMLCoords()
 
   // get mesh dimension and part handle
   const int mesh_dim = getNumDim();
-  coordMV = Thyra::createMembers(m_node_vs,mesh_dim);
+  if (coordMV.is_null() || coordMV->domain()->dim() != mesh_dim ||
+      !sameAs(coordMV->range(), m_node_vs)) {
+    coordMV = Thyra::createMembers(m_node_vs,mesh_dim);
+  }
 
   apf::Field* f = meshStruct->getMesh()->getCoordinateField();
 
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <iostream>
+#include <unordered_map>
 
 #include "Albany_ExtrudedSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -240,8 +241,6 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
   this->SetupFieldData(comm, neq_, req, sis, worksetSize);
 
   LayeredMeshOrdering LAYER  = LayeredMeshOrdering::LAYER;
-  LayeredMeshOrdering COLUMN = LayeredMeshOrdering::COLUMN;
-
   bool useGlimmerSpacing = params->get("Use Glimmer Spacing", false);
 
   stk::mesh::BulkData& bulkData2D = *basalMeshStruct->bulkData;
@@ -326,6 +325,10 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
       Teuchos::rcp(new LayeredMeshNumbering<LO>(lVertexColumnShift,Ordering,layerThicknessRatio)):
       Teuchos::rcp(new LayeredMeshNumbering<LO>(vertexLayerShift,Ordering,layerThicknessRatio));
 
+  this->layeredCellsNumbering = (Ordering==LAYER) ?
+      Teuchos::rcp(new LayeredMeshNumbering<LO>(lElemColumnShift,Ordering,layerThicknessRatio)):
+      Teuchos::rcp(new LayeredMeshNumbering<LO>(elemLayerShift,Ordering,layerThicknessRatio));
+
   std::vector<double> ltr(layerThicknessRatio.size());
   for(size_t i=0; i< ltr.size(); ++i) {
     ltr[i]=layerThicknessRatio[i];
@@ -363,11 +366,36 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
   VectorFieldType* coordinates_field = fieldContainer->getCoordinatesField();
   stk::mesh::FieldBase const* coordinates_field2d = metaData2D.coordinate_field();
 
-  std::vector<GO> prismMpasIds(NumBaseElemeNodes), prismGlobalIds(2 * NumBaseElemeNodes);
+  int numBasalSidePoints;
+  int basalSideLID, upperSideLID;
+
+  switch (ElemShape) {
+  case Tetrahedron:
+    numSubelemOnPrism = 3;
+    numBasalSidePoints = 3;
+    basalSideLID = 3;  //depends on how the tetrahedron is located in the Prism, see tetraFaceIdOnPrismFaceId below.
+    upperSideLID = 1;
+    break;
+  case Wedge:
+    numSubelemOnPrism = 1;
+    numBasalSidePoints = 3;
+    basalSideLID = 3;  //depends on how the tetrahedron is located in the Prism.
+    upperSideLID = 4;
+    break;
+  case Hexahedron:
+    numSubelemOnPrism = 1;
+    numBasalSidePoints = 4;
+    basalSideLID = 4;  //depends on how the tetrahedron is located in the Prism.
+    upperSideLID = 5;
+    break;
+  }
+
+  std::vector<GO> prismMpasIds(NumBaseElemeNodes), prismLocalIds(2 * NumBaseElemeNodes);
 
   double *thick_val, *sHeight_val;
 
   int num_nodes = (numLayers + 1) * nodes2D.size();
+  layeredNodes3D.resize(num_nodes);
   *out << "[ExtrudedSTKMesh] Adding nodes... ";
   out->getOStream()->flush();
   for (int i = 0; i < num_nodes; i++) {
@@ -383,6 +411,7 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
       node = bulkData->declare_entity(stk::topology::NODE_RANK, nodeId, singlePartVecTop);
     else
       node = bulkData->declare_entity(stk::topology::NODE_RANK, nodeId, nodePartVec);
+    layeredNodes3D[layered_mesh_numbering->getId(ib,il)] = node;
 
     std::vector<int> sharing_procs;
     bulkData2D.comm_shared_procs( bulkData2D.entity_key(node2d), sharing_procs );
@@ -403,41 +432,57 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
   *out << "done!\n";
   out->getOStream()->flush();
 
+  // The basal connectivity is the same for all the layers: store it once, using
+  // local basal node ids, so that the 3D connectivity follows from the layered numbering.
+  std::unordered_map<stk::mesh::EntityId,int> nodes2DLIDs, cells2DLIDs;
+  for (size_t i = 0; i < nodes2D.size(); ++i)
+    nodes2DLIDs[bulkData2D.identifier(nodes2D[i])] = i;
+  for (size_t i = 0; i < cells2D.size(); ++i)
+    cells2DLIDs[bulkData2D.identifier(cells2D[i])] = i;
+
+  std::vector<int> cellsNodes2DLIDs(cells2D.size() * NumBaseElemeNodes);
+  std::vector<GO>  cellsMpasIds(cells2D.size() * NumBaseElemeNodes);
+  for (size_t ib = 0; ib < cells2D.size(); ++ib) {
+    stk::mesh::Entity const* rel = bulkData2D.begin_nodes(cells2D[ib]);
+    for (int j = 0; j < NumBaseElemeNodes; j++) {
+      stk::mesh::EntityId node2dId = bulkData2D.identifier(rel[j]);
+      cellsNodes2DLIDs[ib * NumBaseElemeNodes + j] = nodes2DLIDs.at(node2dId);
+      cellsMpasIds[ib * NumBaseElemeNodes + j] = vertexLayerShift * (node2dId - 1);
+    }
+  }
+
   GO tetrasLocalIdsOnPrism[3][4];
   singlePartVec[0] = partVec[ebNo];
 
   *out << "[ExtrudedSTKMesh] Adding elements... ";
   out->getOStream()->flush();
   GO num_cells = cells2D.size() * numLayers;
+  layeredCells3D.resize(num_cells * numSubelemOnPrism);
   for (int i = 0; i < num_cells; i++) {
 
     int ib = (Ordering == LAYER) * (i % lElemColumnShift) + (Ordering == COLUMN) * (i / elemLayerShift);
     int il = (Ordering == LAYER) * (i / lElemColumnShift) + (Ordering == COLUMN) * (i % elemLayerShift);
-    int shift = il * vertexColumnShift;
+    int cellLID = layeredCellsNumbering->getId(ib, il);
 
-    //TODO: this could be done only in the first layer and then copied into the other layers
-    stk::mesh::Entity const* rel = bulkData2D.begin_nodes(cells2D[ib]);
     for (int j = 0; j < NumBaseElemeNodes; j++) {
-      stk::mesh::EntityId node2dId = bulkData2D.identifier(rel[j]) - 1;
-      stk::mesh::EntityId mpasLowerId = vertexLayerShift * node2dId;
-      stk::mesh::EntityId lowerId = shift + vertexLayerShift * node2dId;
-      prismMpasIds[j] = mpasLowerId;
-      prismGlobalIds[j] = lowerId;
-      prismGlobalIds[j + NumBaseElemeNodes] = lowerId + vertexColumnShift;
+      const int node2dLID = cellsNodes2DLIDs[ib * NumBaseElemeNodes + j];
+      prismMpasIds[j] = cellsMpasIds[ib * NumBaseElemeNodes + j];
+      prismLocalIds[j] = layered_mesh_numbering->getId(node2dLID, il);
+      prismLocalIds[j + NumBaseElemeNodes] = layered_mesh_numbering->getId(node2dLID, il + 1);
     }
 
     switch (ElemShape)
     {
       case Tetrahedron:
       {
-        tetrasFromPrismStructured(&prismMpasIds[0], &prismGlobalIds[0], tetrasLocalIdsOnPrism);
+        tetrasFromPrismStructured(&prismMpasIds[0], &prismLocalIds[0], tetrasLocalIdsOnPrism);
 
         stk::mesh::EntityId prismId = il * elemColumnShift + elemLayerShift * (bulkData2D.identifier(cells2D[ib]) - 1);
         for (int iTetra = 0; iTetra < 3; iTetra++) {
           stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, 3 * prismId + iTetra + 1, singlePartVec);
+          layeredCells3D[3 * cellLID + iTetra] = elem;
           for (int j = 0; j < 4; j++) {
-            stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, tetrasLocalIdsOnPrism[iTetra][j] + 1);
-            bulkData->declare_relation(elem, node, j);
+            bulkData->declare_relation(elem, layeredNodes3D[tetrasLocalIdsOnPrism[iTetra][j]], j);
           }
           int* p_rank = (int*) stk::mesh::field_data(*proc_rank_field, elem);
           p_rank[0] = comm->getRank();
@@ -449,9 +494,9 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
       {
         stk::mesh::EntityId prismId = il * elemColumnShift + elemLayerShift * (bulkData2D.identifier(cells2D[ib]) - 1);
         stk::mesh::Entity elem = bulkData->declare_entity(stk::topology::ELEMENT_RANK, prismId + 1, singlePartVec);
+        layeredCells3D[cellLID] = elem;
         for (int j = 0; j < 2 * NumBaseElemeNodes; j++) {
-          stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, prismGlobalIds[j] + 1);
-          bulkData->declare_relation(elem, node, j);
+          bulkData->declare_relation(elem, layeredNodes3D[prismLocalIds[j]], j);
         }
         int* p_rank = (int*) stk::mesh::field_data(*proc_rank_field, elem);
         p_rank[0] = comm->getRank();
@@ -462,30 +507,6 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
   *out << "done!\n";
   out->getOStream()->flush();
 
-  int numSubelemOnPrism, numBasalSidePoints;
-  int basalSideLID, upperSideLID;
-
-  switch (ElemShape) {
-  case Tetrahedron:
-    numSubelemOnPrism = 3;
-    numBasalSidePoints = 3;
-    basalSideLID = 3;  //depends on how the tetrahedron is located in the Prism, see tetraFaceIdOnPrismFaceId below.
-    upperSideLID = 1;
-    break;
-  case Wedge:
-    numSubelemOnPrism = 1;
-    numBasalSidePoints = 3;
-    basalSideLID = 3;  //depends on how the tetrahedron is located in the Prism.
-    upperSideLID = 4;
-    break;
-  case Hexahedron:
-    numSubelemOnPrism = 1;
-    numBasalSidePoints = 4;
-    basalSideLID = 4;  //depends on how the tetrahedron is located in the Prism.
-    upperSideLID = 5;
-    break;
-  }
-
   // First, we store the lower and upper faces of prisms, which corresponds to triangles of the basal mesh
   // Note: this ensures the side_id on basal sides equals the corresponding cell_id on the basal mesh
   //       which is useful in side_discretization handling.
@@ -494,10 +515,10 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
 
   *out << "[ExtrudedSTKMesh] Adding basalside sides... ";
   out->getOStream()->flush();
-  for (const auto& elem2d : cells2D) {
-    stk::mesh::EntityId elem2d_id = bulkData2D.identifier(elem2d) - 1;
+  for (size_t ib = 0; ib < cells2D.size(); ++ib) {
+    stk::mesh::EntityId elem2d_id = bulkData2D.identifier(cells2D[ib]) - 1;
     stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), elem2d_id + 1, singlePartVec);
-    stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEMENT_RANK, elem2d_id * numSubelemOnPrism * elemLayerShift + 1);
+    stk::mesh::Entity elem = getCell3D(ib, 0, 0);
     bulkData->declare_relation(elem, side, basalSideLID);
 
     stk::mesh::Entity const* rel_elemNodes = bulkData->begin_nodes(elem);
@@ -516,10 +537,10 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
 
   *out << "[ExtrudedSTKMesh] Adding upperside sides... ";
   out->getOStream()->flush();
-  for (const auto& elem2d : cells2D) {
-    stk::mesh::EntityId elem2d_id = bulkData2D.identifier(elem2d) - 1;
+  for (size_t ib = 0; ib < cells2D.size(); ++ib) {
+    stk::mesh::EntityId elem2d_id = bulkData2D.identifier(cells2D[ib]) - 1;
     stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), elem2d_id + upperBasalOffset + 1, singlePartVec);
-    stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEMENT_RANK, elem2d_id * numSubelemOnPrism * elemLayerShift + (numLayers - 1) * numSubelemOnPrism * elemColumnShift + 1 + (numSubelemOnPrism - 1));
+    stk::mesh::Entity elem = getCell3D(ib, numLayers - 1, numSubelemOnPrism - 1);
     bulkData->declare_relation(elem, side, upperSideLID);
 
     stk::mesh::Entity const* rel_elemNodes = bulkData->begin_nodes(elem);
@@ -572,14 +593,12 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
     stk::mesh::Entity elem2d = rel[0];
     stk::mesh::EntityId sideLID = ordinals[0]; //bulkData2D.identifier(rel[0]);
 
-    stk::mesh::EntityId basalElemId = bulkData2D.identifier(elem2d) - 1;
+    const int basalElemLID = cells2DLIDs.at(bulkData2D.identifier(elem2d));
     stk::mesh::EntityId side2dId = bulkData2D.identifier(side2d) - 1;
     switch (ElemShape) {
       case Tetrahedron: {
-        rel = bulkData2D.begin_nodes(elem2d);
         for (int j = 0; j < NumBaseElemeNodes; j++) {
-          stk::mesh::EntityId node2dId = bulkData2D.identifier(rel[j]) - 1;
-          prismMpasIds[j] = vertexLayerShift * node2dId;
+          prismMpasIds[j] = cellsMpasIds[basalElemLID * NumBaseElemeNodes + j];
         }
 
         stk::mesh::EntityId sideId = 2 * sideColumnShift * il +  2 * side2dId * sideLayerShift + upperBasalOffset + 1;
@@ -588,10 +607,8 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
 
         int minIndex;
         int pType = prismType(&prismMpasIds[0], minIndex);
-        stk::mesh::EntityId tetraId = 3 * il * elemColumnShift + 3 * elemLayerShift * basalElemId;
-
-        stk::mesh::Entity elem0 = bulkData->get_entity(stk::topology::ELEMENT_RANK, tetraId + tetraAdjacentToPrismLateralFace[minIndex][pType][sideLID][0] + 1);
-        stk::mesh::Entity elem1 = bulkData->get_entity(stk::topology::ELEMENT_RANK, tetraId + tetraAdjacentToPrismLateralFace[minIndex][pType][sideLID][1] + 1);
+        stk::mesh::Entity elem0 = getCell3D(basalElemLID, il, tetraAdjacentToPrismLateralFace[minIndex][pType][sideLID][0]);
+        stk::mesh::Entity elem1 = getCell3D(basalElemLID, il, tetraAdjacentToPrismLateralFace[minIndex][pType][sideLID][1]);
 
         bulkData->declare_relation(elem0, side0, tetraFaceIdOnPrismFaceId[minIndex][sideLID]);
         bulkData->declare_relation(elem1, side1, tetraFaceIdOnPrismFaceId[minIndex][sideLID]);
@@ -614,8 +631,7 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
         stk::mesh::EntityId sideId = sideColumnShift * il + side2dId * sideLayerShift + upperBasalOffset + 1;
         stk::mesh::Entity side = bulkData->declare_entity(metaData->side_rank(), sideId, singlePartVec);
 
-        stk::mesh::EntityId prismId = il * elemColumnShift + elemLayerShift * basalElemId;
-        stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId + 1);
+        stk::mesh::Entity elem = getCell3D(basalElemLID, il, 0);
         bulkData->declare_relation(elem, side, sideLID);
 
         stk::mesh::Entity const* rel_elemNodes = bulkData->begin_nodes(elem);
@@ -683,8 +699,12 @@ void Albany::ExtrudedSTKMeshStruct::setFieldAndBulkData(
   out->getOStream()->flush();
 
   // Extrude fields
-  extrudeBasalFields (nodes2D,cells2D,maxGlobalElements2dId,maxGlobalVertices2dId);
-  interpolateBasalLayeredFields (nodes2D,cells2D,levelsNormalizedThickness,maxGlobalElements2dId,maxGlobalVertices2dId);
+  extrudeBasalFields (nodes2D,cells2D);
+  interpolateBasalLayeredFields (nodes2D,cells2D,levelsNormalizedThickness);
+
+  // The 3D entities are not needed anymore
+  std::vector<stk::mesh::Entity>().swap(layeredNodes3D);
+  std::vector<stk::mesh::Entity>().swap(layeredCells3D);
 
   // Loading required input fields from file
   this->loadRequiredInputFields (req,comm);
@@ -847,8 +867,7 @@ void Albany::ExtrudedSTKMeshStruct::buildCellSideNodeNumerationMap (const std::s
 
 void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::vector<stk::mesh::Entity>& nodes2d,
                                                                    const std::vector<stk::mesh::Entity>& cells2d,
-                                                                   const std::vector<double>& levelsNormalizedThickness,
-                                                                   GO maxGlobalCells2dId, GO maxGlobalNodes2dId)
+                                                                   const std::vector<double>& levelsNormalizedThickness)
 {
   Teuchos::Array<std::string> node_fields_names, cell_fields_names;
   Teuchos::Array<int> node_fields_ranks, cell_fields_ranks;
@@ -886,7 +905,6 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
   const int numNodes2d = nodes2d.size();
   const int numCells2d = cells2d.size();
 
-  stk::mesh::BulkData& bulkData2d = *basalMeshStruct->bulkData;
   stk::mesh::MetaData& metaData2d = *basalMeshStruct->metaData;
 
   int numNodeFields = node_fields_names.size();
@@ -897,8 +915,6 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
   int il0,il1;
   double h0;
 
-  LayeredMeshOrdering COLUMN = LayeredMeshOrdering::COLUMN;
-
   std::string ranks[4] = {"ERROR!","Scalar","Vector","Tensor"};
   std::vector<double> fieldLayersCoords;
 
@@ -921,7 +937,6 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
     for (int inode=0; inode<numNodes2d; ++inode)
     {
       const stk::mesh::Entity& node2d = nodes2d[inode];
-      stk::mesh::EntityId node2dId = bulkData2d.identifier(node2d) - 1;
 
       // Extracting 2d data only once
       switch (node_fields_ranks[ifield])
@@ -949,8 +964,7 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
       for (int il=0; il<=numLayers; ++il)
       {
         // Retrieve 3D node
-        int node3dId = Ordering==COLUMN ? node2dId*(numLayers+1) + il + 1 : il*maxGlobalNodes2dId + node2dId + 1;
-        stk::mesh::Entity node3d = bulkData->get_entity(stk::topology::NODE_RANK, node3dId);
+        stk::mesh::Entity node3d = getNode3D(inode, il);
 
         // Find where the mesh layer stands in the field layers
         double meshLayerCoord = levelsNormalizedThickness[il];
@@ -1021,7 +1035,6 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
     for (int icell=0; icell<numCells2d; ++icell)
     {
       const stk::mesh::Entity& cell2d = cells2d[icell];
-      stk::mesh::EntityId cell2dId = bulkData2d.identifier(cell2d) - 1;
 
       // Extracting the 2d data only once
       switch (cell_fields_ranks[ifield])
@@ -1048,20 +1061,10 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
       // Loop on the layers
       for (int il=0; il<numLayers; ++il)
       {
-        // Retrieving the id of the 3d cells
-        stk::mesh::EntityId prismId = Ordering==COLUMN ? numLayers*cell2dId + il : maxGlobalCells2dId*il + cell2dId;
+        // Retrieving the 3d cells
         std::vector<stk::mesh::Entity> cells3d;
-        switch (ElemShape)
-        {
-          case Tetrahedron:
-            cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+1));
-            cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+2));
-            cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+3));
-            break;
-          case Wedge:
-          case Hexahedron:
-            cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+1));
-        }
+        for (int isub=0; isub<numSubelemOnPrism; ++isub)
+          cells3d.push_back (getCell3D(icell, il, isub));
 
         // Since the
         double meshLayerCoord = 0.5*(levelsNormalizedThickness[il] + levelsNormalizedThickness[il+1]);
@@ -1124,8 +1127,7 @@ void Albany::ExtrudedSTKMeshStruct::interpolateBasalLayeredFields (const std::ve
 }
 
 void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::mesh::Entity>& nodes2d,
-                                                        const std::vector<stk::mesh::Entity>& cells2d,
-                                                        GO maxGlobalCells2dId, GO maxGlobalNodes2dId)
+                                                        const std::vector<stk::mesh::Entity>& cells2d)
 {
   Teuchos::Array<std::string> node_fields_names, cell_fields_names;
   Teuchos::Array<int> node_fields_ranks, cell_fields_ranks;
@@ -1160,7 +1162,6 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
   const int numNodes2d = nodes2d.size();
   const int numCells2d = cells2d.size();
 
-  stk::mesh::BulkData& bulkData2d = *basalMeshStruct->bulkData;
   stk::mesh::MetaData& metaData2d = *basalMeshStruct->metaData;
 
   int numNodeFields = node_fields_names.size();
@@ -1168,8 +1169,6 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
   int numScalars;
   double *values2d, *values3d;
 
-  LayeredMeshOrdering COLUMN = LayeredMeshOrdering::COLUMN;
-
   // Extrude node fields
   for (int ifield=0; ifield<numNodeFields; ++ifield)
   {
@@ -1192,13 +1191,11 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int inode=0; inode<numNodes2d; ++inode)
         {
           const stk::mesh::Entity& node2d = nodes2d[inode];
-          stk::mesh::EntityId node2dId = bulkData2d.identifier(node2d) - 1;
           values2d = stk::mesh::field_data(*field2d,node2d);
           for (int il=0; il<=numLayers; ++il)
           {
             // Retrieve 3D node
-            int node3dId = Ordering==COLUMN ? node2dId*(numLayers+1) + il + 1 : il*maxGlobalNodes2dId + node2dId + 1;
-            stk::mesh::Entity node3d = bulkData->get_entity(stk::topology::NODE_RANK, node3dId);
+            stk::mesh::Entity node3d = getNode3D(inode, il);
 
             values3d = stk::mesh::field_data(*field3d,node3d);
             values3d[0] = values2d[0];
@@ -1223,14 +1220,12 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int inode=0; inode<numNodes2d; ++inode)
         {
           const stk::mesh::Entity& node2d = nodes2d[inode];
-          stk::mesh::EntityId node2dId = bulkData2d.identifier(node2d) - 1;
           values2d = stk::mesh::field_data(*field2d,node2d);
           numScalars = stk::mesh::field_scalars_per_entity(*field2d,node2d);
           for (int il=0; il<=numLayers; ++il)
           {
             // Retrieve 3D node
-            int node3dId = Ordering==COLUMN ? node2dId*(numLayers+1)+il+1 : il*maxGlobalNodes2dId+node2dId + 1;
-            stk::mesh::Entity node3d = bulkData->get_entity(stk::topology::NODE_RANK, node3dId);
+            stk::mesh::Entity node3d = getNode3D(inode, il);
 
             values3d = stk::mesh::field_data(*field3d,node3d);
             for (int j=0; j<numScalars; ++j)
@@ -1256,14 +1251,12 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int inode=0; inode<numNodes2d; ++inode)
         {
           const stk::mesh::Entity& node2d = nodes2d[inode];
-          stk::mesh::EntityId node2dId = bulkData2d.identifier(node2d) - 1;
           values2d = stk::mesh::field_data(*field2d,node2d);
           numScalars = stk::mesh::field_scalars_per_entity(*field2d,node2d);
           for (int il=0; il<=numLayers; ++il)
           {
             // Retrieve 3D node
-            int node3dId = Ordering==COLUMN ? node2dId*(numLayers+1)+il+1 : il*maxGlobalNodes2dId+node2dId + 1;
-            stk::mesh::Entity node3d = bulkData->get_entity(stk::topology::NODE_RANK, node3dId);
+            stk::mesh::Entity node3d = getNode3D(inode, il);
 
             values3d = stk::mesh::field_data(*field3d,node3d);
             for (int j=0; j<numScalars; ++j)
@@ -1300,24 +1293,13 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int icell=0; icell<numCells2d; ++icell)
         {
           const stk::mesh::Entity& cell2d = cells2d[icell];
-          stk::mesh::EntityId cell2dId = bulkData2d.identifier(cell2d) - 1;
           values2d = stk::mesh::field_data(*field2d,cell2d);
           for (int il=0; il<numLayers; ++il)
           {
-            // Retrieving the id of the 3d cells
-            stk::mesh::EntityId prismId = Ordering==COLUMN ? numLayers*cell2dId + il : maxGlobalCells2dId*il + cell2dId;
+            // Retrieving the 3d cells
             std::vector<stk::mesh::Entity> cells3d;
-            switch (ElemShape)
-            {
-              case Tetrahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+1));
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+2));
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, 3*prismId+3));
-                break;
-              case Wedge:
-              case Hexahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+1));
-            }
+            for (int isub=0; isub<numSubelemOnPrism; ++isub)
+              cells3d.push_back (getCell3D(icell, il, isub));
 
             // Stuffing the 3d fields
             for (auto& cell3d : cells3d)
@@ -1346,23 +1328,14 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int icell=0; icell<numCells2d; ++icell)
         {
           const stk::mesh::Entity& cell2d = cells2d[icell];
-          stk::mesh::EntityId cell2dId = bulkData2d.identifier(cell2d) - 1;
           numScalars = stk::mesh::field_scalars_per_entity(*field2d,cell2d);
           values2d = stk::mesh::field_data(*field2d,cell2d);
           for (int il=0; il<numLayers; ++il)
           {
-            // Retrieving the id of the 3d cells
-            stk::mesh::EntityId prismId = Ordering==COLUMN ? numLayers*cell2dId + il + 1 : maxGlobalCells2dId*il + cell2dId + 1;
+            // Retrieving the 3d cells
             std::vector<stk::mesh::Entity> cells3d;
-            switch (ElemShape)
-            {
-              case Tetrahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+2));
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+1));
-              case Wedge:
-              case Hexahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId));
-            }
+            for (int isub=0; isub<numSubelemOnPrism; ++isub)
+              cells3d.push_back (getCell3D(icell, il, isub));
 
             // Stuffing the 3d fields
             for (auto& cell3d : cells3d)
@@ -1394,23 +1367,14 @@ void Albany::ExtrudedSTKMeshStruct::extrudeBasalFields (const std::vector<stk::m
         for (int icell=0; icell<numCells2d; ++icell)
         {
           const stk::mesh::Entity& cell2d = cells2d[icell];
-          stk::mesh::EntityId cell2dId = bulkData2d.identifier(cell2d) - 1;
           numScalars = stk::mesh::field_scalars_per_entity(*field2d,cell2d);
           values2d = stk::mesh::field_data(*field2d,cell2d);
           for (int il=0; il<numLayers; ++il)
           {
-            // Retrieving the id of the 3d cells
-            stk::mesh::EntityId prismId = Ordering==COLUMN ? numLayers*cell2dId + il + 1 : maxGlobalCells2dId*il + cell2dId + 1;
+            // Retrieving the 3d cells
             std::vector<stk::mesh::Entity> cells3d;
-            switch (ElemShape)
-            {
-              case Tetrahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+2));
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId+1));
-              case Wedge:
-              case Hexahedron:
-                cells3d.push_back (bulkData->get_entity(stk::topology::ELEMENT_RANK, prismId));
-            }
+            for (int isub=0; isub<numSubelemOnPrism; ++isub)
+              cells3d.push_back (getCell3D(icell, il, isub));
 
             // Stuffing the 3d fields
             for (auto& cell3d : cells3d)
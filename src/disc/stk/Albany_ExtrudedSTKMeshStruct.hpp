@@ -14,6 +14,13 @@
 
 namespace Albany {
 
+  // Mesh obtained by extruding a basal 2D STK mesh in layers. The 3D connectivity
+  // and the extruded fields are generated from the basal connectivity and the
+  // layered numbering of nodes and cells, but the result is still a full 3D STK
+  // mesh: worksets, states and output all go through it, so its memory footprint
+  // is the one of an unstructured 3D mesh.
+  // TODO: a layered AbstractDiscretization that stores only the basal mesh and
+  // the layers, and serves worksets, states and output without a 3D STK mesh.
   class ExtrudedSTKMeshStruct : public GenericSTKMeshStruct {
 
     public:
@@ -55,15 +62,23 @@ namespace Albany {
 
     void interpolateBasalLayeredFields (const std::vector<stk::mesh::Entity>& nodes2d,
                                         const std::vector<stk::mesh::Entity>& cells2d,
-                                        const std::vector<double>& levelsNormalizedThickness,
-                                        GO numGlobalCells2d, GO numGlobalNodes2d);
+                                        const std::vector<double>& levelsNormalizedThickness);
     void extrudeBasalFields (const std::vector<stk::mesh::Entity>& nodes2d,
-                             const std::vector<stk::mesh::Entity>& cells2d,
-                             GO numGlobalCells2d, GO numGlobalNodes2d);
+                             const std::vector<stk::mesh::Entity>& cells2d);
 
     Teuchos::RCP<const Teuchos::ParameterList>
       getValidDiscretizationParameters() const;
 
+    // The 3D entities of a basal node/cell at a given level/layer. Only valid while
+    // the extruded mesh is built: they are found from the layered numbering of the
+    // local basal entities, rather than looked up by id.
+    stk::mesh::Entity getNode3D (const int inode2d, const int il) const {
+      return layeredNodes3D[layered_mesh_numbering->getId(inode2d,il)];
+    }
+    stk::mesh::Entity getCell3D (const int icell2d, const int il, const int isub) const {
+      return layeredCells3D[layeredCellsNumbering->getId(icell2d,il)*numSubelemOnPrism + isub];
+    }
+
     Teuchos::RCP<Albany::AbstractSTKMeshStruct> basalMeshStruct;
 
     Teuchos::RCP<Teuchos::FancyOStream> out;
@@ -74,6 +89,11 @@ namespace Albany {
     LayeredMeshOrdering Ordering;
     int numLayers;
     int NumBaseElemeNodes;
+    int numSubelemOnPrism;
+
+    Teuchos::RCP<LayeredMeshNumbering<LO> > layeredCellsNumbering;
+    std::vector<stk::mesh::Entity> layeredNodes3D;
+    std::vector<stk::mesh::Entity> layeredCells3D;
   }; // Class ExtrudedSTKMeshStruct
 
 
@@ -672,7 +672,19 @@ rebalanceAdaptedMeshT(const Teuchos::RCP<Teuchos::ParameterList>& params_,
     }
 
 
-    imbalance = stk::rebalance::check_balance(*bulkData, NULL, stk::topology::NODE_RANK, &selector);
+    // Optional element weights (e.g., measured evaluation cost). Without them,
+    // Zoltan balances the element count, and the balance is checked on nodes.
+    const AbstractSTKFieldContainer::ScalarFieldType* weight_field = NULL;
+    stk::mesh::EntityRank balance_rank = stk::topology::NODE_RANK;
+    const std::string weight_name = params_->get<std::string>("Rebalance Weight Field", "");
+    if(weight_name != ""){
+      weight_field = metaData->get_field<AbstractSTKFieldContainer::ScalarFieldType>(stk::topology::ELEMENT_RANK, weight_name);
+      TEUCHOS_TEST_FOR_EXCEPTION(weight_field == NULL, std::runtime_error,
+          "Error! Rebalance weight field '" << weight_name << "' is not an element scalar field of the mesh.\n");
+      balance_rank = stk::topology::ELEMENT_RANK;
+    }
+
+    imbalance = stk::rebalance::check_balance(*bulkData, weight_field, balance_rank, &selector);
 
     if(comm->getRank() == 0)
 
@@ -702,10 +714,10 @@ rebalanceAdaptedMeshT(const Teuchos::RCP<Teuchos::ParameterList>& params_,
     const Teuchos::MpiComm<int>* mpiComm = dynamic_cast<const Teuchos::MpiComm<int>* > (comm.get());
 
     stk::rebalance::Zoltan zoltan_partition(*bulkData, *mpiComm->getRawMpiComm(), numDim, graph_options);
-    stk::rebalance::rebalance(*bulkData, owned_selector, coordinates_field, NULL, zoltan_partition);
+    stk::rebalance::rebalance(*bulkData, owned_selector, coordinates_field, weight_field, zoltan_partition);
 
-    imbalance = stk::rebalance::check_balance(*bulkData, NULL,
-      stk::topology::NODE_RANK, &selector);
+    imbalance = stk::rebalance::check_balance(*bulkData, weight_field,
+      balance_rank, &selector);
 
     if(comm->getRank() == 0)
       std::cout << "After rebalance: Imbalance threshold is = " << imbalance << endl;
@@ -1953,6 +1965,7 @@ GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname) const
   validPL->set<bool>("Set All Parts IO", false, "If true, all parts are marked as io parts");
   validPL->set<bool>("Use Serial Mesh", false, "Read in a single mesh on PE 0 and rebalance");
   validPL->set<bool>("Use Composite Tet 10", false, "Flag to use the composite tet 10 basis in Intrepid");
+  validPL->set<bool>("Explicit Dynamics", false, "Flag to build a diagonal Jacobian graph only, for explicit dynamics with a lumped mass");
   validPL->set<bool>("Build Node Sets From Side Sets",false,"Flag to build node sets from side sets");
   validPL->set<bool>("Export 3d coordinates field",false,"If true AND the mesh dimension is not already 3, export a 3d version of the coordinate field.");
 
@@ -34,7 +34,8 @@ public:
 #endif
 
 
-  //! Re-load balance adapted mesh
+  //! Re-load balance adapted mesh. If the "Rebalance Weight Field" parameter names
+  //! an element scalar field, the elements are weighted by its values.
   void rebalanceAdaptedMeshT(const Teuchos::RCP<Teuchos::ParameterList>& params,
                             const Teuchos::RCP<const Teuchos::Comm<int> >& comm);
 
@@ -922,7 +922,12 @@ STKDiscretization::setupMLCoords()
   const int                                   numDim = stkMeshStruct->numDim;
   AbstractSTKFieldContainer::VectorFieldType* coordinates_field =
       stkMeshStruct->getCoordinatesField();
-  coordMV           = Thyra::createMembers(m_node_vs, numDim);
+  // Reuse the coordinates storage if the node map did not change, so the
+  // preconditioner keeps seeing the same object, updated in place.
+  if (coordMV.is_null() || coordMV->domain()->dim() != numDim ||
+      !sameAs(coordMV->range(), m_node_vs)) {
+    coordMV = Thyra::createMembers(m_node_vs, numDim);
+  }
   auto coordMV_data = getNonconstLocalData(coordMV);
 
   auto node_indexer = createGlobalLocalIndexer(m_node_vs);
@@ -1547,6 +1552,52 @@ STKDiscretization::nonzeroesPerRow(const int num_eq) const
   return estNonzeroesPerRow;
 }
 
+void
+STKDiscretization::checkGlobalIdRange() const
+{
+  // Node and element gids, and the dof gids built from them, must fit in GO.
+  // With 32-bit global ordinals, a mesh that is too large would otherwise
+  // silently wrap around in gid().
+  long long local_max[2] = {0, 0};
+  const stk::mesh::EntityRank ranks[2] = {stk::topology::NODE_RANK,
+                                          stk::topology::ELEMENT_RANK};
+  for (int r = 0; r < 2; ++r) {
+    const stk::mesh::BucketVector& buckets = bulkData.get_buckets(
+        ranks[r], metaData.locally_owned_part());
+    for (const stk::mesh::Bucket* b : buckets) {
+      for (const stk::mesh::Entity e : *b) {
+        // STK identifiers are 1-based, while gid() is 0-based
+        const long long id = static_cast<long long>(bulkData.identifier(e)) - 1;
+        local_max[r] = std::max(local_max[r], id);
+      }
+    }
+  }
+  long long global_max[2];
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, 2, local_max, global_max);
+
+  int max_comps = 1;
+  for (const auto& it : nodalDOFsStructContainer.mapOfDOFsStructs) {
+    max_comps = std::max(max_comps, it.first.second);
+  }
+
+#ifdef ALBANY_32BIT_GO
+  const std::string hint =
+      "  Reconfigure Albany with ENABLE_32BIT_GLOBAL_ORDINALS=OFF.\n";
+#else
+  const std::string hint;
+#endif
+  const long long max_go = std::numeric_limits<GO>::max();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      global_max[0] >= max_go / max_comps || global_max[1] >= max_go,
+      std::runtime_error,
+      "Error! The mesh is too large for the global ordinal type ("
+          << 8 * sizeof(GO) << " bit).\n"
+          << "  Largest node id: " << global_max[0] + 1
+          << ", with up to " << max_comps << " dofs per node.\n"
+          << "  Largest element id: " << global_max[1] + 1 << ".\n"
+          << hint);
+}
+
 void
 STKDiscretization::computeNodalVectorSpaces(bool overlapped)
 {
@@ -1744,6 +1795,21 @@ STKDiscretization::computeGraphsUpToFillComplete()
   // Loads member data:  overlap_graph, numOverlapodes, overlap_node_map,
   // coordinates, graphs
 
+  // Explicit dynamics with a lumped mass only ever assembles a diagonal
+  // operator, so skip the element connectivity graph altogether.
+  if (discParams->get<bool>("Explicit Dynamics", false)) {
+    m_overlap_jac_factory = Teuchos::rcp(
+        new ThyraCrsMatrixFactory(m_overlap_vs, m_overlap_vs, 1));
+    const auto ov_indexer = createGlobalLocalIndexer(m_overlap_vs);
+    const LO   num_dofs   = ov_indexer->getNumLocalElements();
+    for (LO lid = 0; lid < num_dofs; ++lid) {
+      const GO row = ov_indexer->getGlobalElement(lid);
+      m_overlap_jac_factory->insertGlobalIndices(
+          row, Teuchos::arrayView(&row, 1));
+    }
+    return;
+  }
+
   m_overlap_jac_factory = Teuchos::rcp(new ThyraCrsMatrixFactory(
       m_overlap_vs, m_overlap_vs, neq * nodes_per_element));
 
@@ -3135,6 +3201,8 @@ STKDiscretization::updateMesh()
         param_state.name, param_state.meshPart, numComps);
   }
 
+  checkGlobalIdRange();
+
   computeNodalVectorSpaces(false);
 
   computeOwnedNodesAndUnknowns();
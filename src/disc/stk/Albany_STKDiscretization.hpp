@@ -569,6 +569,10 @@ class STKDiscretization : public AbstractDiscretization
   double
   monotonicTimeLabel(const double time);
 
+  //! Check that node, element and dof gids fit in GO
+  void
+  checkGlobalIdRange() const;
+
   void
   computeNodalVectorSpaces(bool overlapped);
 
@@ -8,34 +8,127 @@
 #include <stk_util/parallel/CommSparse.hpp>
 #include "Teuchos_TimeMonitor.hpp"
 
+#include <map>
+#include <utility>
+#include <vector>
+
 //----------------------------------------------------------------------
 
 // AGS 03/2015: This is code from STK that was deprecated, so I moved it here
 //              as part of Albany.
+//
+// The original version sent the key of every owned node to every other rank,
+// which is O(P*N) in both traffic and lookups. Sharing is now discovered
+// through a rendezvous directory: the node with id g is registered on rank
+// g % P, which then tells every rank holding g which other ranks own it.
+// Each rank sends and receives O(N/P + boundary) keys.
+
+namespace {
+
+struct NodeHolder {
+  int  rank;
+  bool owned;
+};
+
+typedef std::map<stk::mesh::EntityKey, std::vector<NodeHolder>> NodeDirectory;
+
+int directory_rank (const stk::mesh::EntityKey& key, const int num_procs) {
+  return static_cast<int>(key.id() % num_procs);
+}
+
+} // anonymous namespace
 
 void Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data) {
 
     TEUCHOS_FUNC_TIME_MONITOR("Albany Setup: fix_node_sharing");
 
-    stk::CommSparse comm(bulk_data.parallel());
+    const int num_procs = bulk_data.parallel_size();
+    const int my_rank   = bulk_data.parallel_rank();
+    if (num_procs == 1) return;
+
+    const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
 
+    // Step 1: register every local node, and whether it is owned here, with
+    //         its directory rank. Entries for this rank skip the communication.
+    NodeDirectory directory;
+    {
+        stk::CommSparse comm(bulk_data.parallel());
+        for (int phase=0;phase<2;++phase)
+        {
+            for (size_t j=0;j<buckets.size();++j)
+            {
+                const stk::mesh::Bucket& bucket = *buckets[j];
+                const int owned = bucket.owned() ? 1 : 0;
+                for (size_t k=0;k<bucket.size();++k)
+                {
+                    stk::mesh::EntityKey key = bulk_data.entity_key(bucket[k]);
+                    const int dest = directory_rank(key, num_procs);
+                    if (dest == my_rank)
+                    {
+                        if (phase == 0)
+                            directory[key].push_back(NodeHolder{my_rank, owned==1});
+                    }
+                    else
+                    {
+                        comm.send_buffer(dest).pack<stk::mesh::EntityKey>(key);
+                        comm.send_buffer(dest).pack<int>(owned);
+                    }
+                }
+            }
+
+            if (phase == 0 )
+            {
+                comm.allocate_buffers();
+            }
+            else
+            {
+                comm.communicate();
+            }
+        }
+
+        for (int i=0;i<num_procs;++i)
+        {
+            if ( i != my_rank )
+            {
+                while(comm.recv_buffer(i).remaining())
+                {
+                    stk::mesh::EntityKey key;
+                    int owned;
+                    comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+                    comm.recv_buffer(i).unpack<int>(owned);
+                    directory[key].push_back(NodeHolder{i, owned==1});
+                }
+            }
+        }
+    }
+
+    // Step 2: for every node held by more than one rank, tell each holder
+    //         which other ranks own it. As in the original algorithm, a rank
+    //         shares a node with every other rank that owns it.
+    std::vector<std::pair<stk::mesh::EntityKey, int>> local_sharing;
+    stk::CommSparse comm(bulk_data.parallel());
     for (int phase=0;phase<2;++phase)
     {
-        for (int i=0;i<bulk_data.parallel_size();++i)
+        for (const auto& entry : directory)
         {
-            if ( i != bulk_data.parallel_rank() )
+            const std::vector<NodeHolder>& holders = entry.second;
+            if (holders.size() < 2) continue;
+
+            for (const NodeHolder& holder : holders)
             {
-                const stk::mesh::BucketVector& buckets = bulk_data.buckets(stk::topology::NODE_RANK);
-                for (size_t j=0;j<buckets.size();++j)
+                for (const NodeHolder& owner : holders)
                 {
-                    const stk::mesh::Bucket& bucket = *buckets[j];
-                    if ( bucket.owned() )
+                    if (owner.rank == holder.rank || !owner.owned) continue;
+
+                    if (holder.rank == my_rank)
                     {
-                        for (size_t k=0;k<bucket.size();++k)
-                        {
-                            stk::mesh::EntityKey key = bulk_data.entity_key(bucket[k]);
-                            comm.send_buffer(i).pack<stk::mesh::EntityKey>(key);
-                        }
+                        if (phase == 0)
+                            local_sharing.push_back(std::make_pair(entry.first, owner.rank));
+                    }
+                    else
+                    {
+                        comm.send_buffer(holder.rank).pack<stk::mesh::EntityKey>(entry.first);
+                        comm.send_buffer(holder.rank).pack<int>(owner.rank);
                     }
                 }
             }
@@ -51,21 +144,31 @@ void Albany::fix_node_sharing(stk::mesh::BulkData& bulk_data) {
         }
     }
 
-    for (int i=0;i<bulk_data.parallel_size();++i)
+    for (const auto& sharing : local_sharing)
     {
-        if ( i != bulk_data.parallel_rank() )
+        stk::mesh::Entity node = bulk_data.get_entity(sharing.first);
+        if ( bulk_data.is_valid(node) )
+        {
+            bulk_data.add_node_sharing(node, sharing.second);
+        }
+    }
+
+    for (int i=0;i<num_procs;++i)
+    {
+        if ( i != my_rank )
         {
             while(comm.recv_buffer(i).remaining())
             {
                 stk::mesh::EntityKey key;
+                int proc;
                 comm.recv_buffer(i).unpack<stk::mesh::EntityKey>(key);
+                comm.recv_buffer(i).unpack<int>(proc);
                 stk::mesh::Entity node = bulk_data.get_entity(key);
                 if ( bulk_data.is_valid(node) )
                 {
-                    bulk_data.add_node_sharing(node, i);
+                    bulk_data.add_node_sharing(node, proc);
                 }
             }
         }
     }
 }
-
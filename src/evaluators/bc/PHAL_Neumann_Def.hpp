@@ -1003,6 +1003,12 @@ template<typename Traits>
 void Neumann<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !workset.dist_param_deriv_op.is_null() || !workset.dist_param_deriv_pattern.is_null(),
+      std::logic_error,
+      "Error! Neumann conditions do not support the assembled distributed parameter derivative.\n"
+      "       Set 'Assemble Distributed Parameter Derivative' to false.\n");
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> fpV = workset.fpV;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST>> fpV_nonconst2dView = Albany::getNonconstLocalData(fpV);
@@ -0,0 +1,170 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_DOF_FUSED_INTERPOLATION_HPP
+#define PHAL_DOF_FUSED_INTERPOLATION_HPP
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+
+#include "Albany_Layouts.hpp"
+#include "Albany_SacadoTypes.hpp"
+#include "PHAL_Utilities.hpp"
+
+namespace PHAL {
+/** \brief Fused Finite Element Interpolation Evaluator
+
+    This evaluator interpolates several nodal scalar and vector DOF fields
+    (and, optionally, their gradients) to quad points in a single kernel.
+    The basis functions of each cell are read once per node and qp and
+    applied to all fields, instead of once per field as happens when
+    one DOFInterpolation/DOFVecInterpolation/DOFGradInterpolation/
+    DOFVecGradInterpolation evaluator is registered per field.
+
+    The output field names match the ones of the single-field evaluators
+    ("<name>" and "<name> Gradient"), so the two can be swapped.
+*/
+
+template<typename EvalT, typename Traits, typename ScalarT>
+class DOFFusedInterpolationBase : public PHX::EvaluatorWithBaseImpl<Traits>,
+                                  public PHX::EvaluatorDerived<EvalT, Traits>
+{
+public:
+
+  enum { MaxScalarFields = 8, MaxVectorFields = 4 };
+
+  DOFFusedInterpolationBase (const Teuchos::ParameterList& p,
+                             const Teuchos::RCP<Albany::Layouts>& dl);
+
+  void postRegistrationSetup (typename Traits::SetupData d,
+                              PHX::FieldManager<Traits>& vm);
+
+  void evaluateFields(typename Traits::EvalData d);
+
+protected:
+
+  typedef typename EvalT::MeshScalarT MeshScalarT;
+  typedef typename Albany::StrongestScalarType<ScalarT,MeshScalarT>::type OutputScalarT;
+
+  // Input:
+  //! Values at nodes
+  PHX::MDField<const ScalarT,Cell,Node>        scalar_node[MaxScalarFields];
+  PHX::MDField<const ScalarT,Cell,Node,VecDim> vector_node[MaxVectorFields];
+  //! Basis Functions
+  PHX::MDField<const RealType,Cell,Node,QuadPoint>        BF;
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
+
+  // Output:
+  //! Values (and gradients) at quadrature points
+  PHX::MDField<ScalarT,Cell,QuadPoint>                     scalar_qp[MaxScalarFields];
+  PHX::MDField<OutputScalarT,Cell,QuadPoint,Dim>           scalar_grad_qp[MaxScalarFields];
+  PHX::MDField<ScalarT,Cell,QuadPoint,VecDim>              vector_qp[MaxVectorFields];
+  PHX::MDField<OutputScalarT,Cell,QuadPoint,VecDim,Dim>    vector_grad_qp[MaxVectorFields];
+
+  int numScalarFields;
+  int numVectorFields;
+  bool interpolateGradients;
+
+  int numNodes;
+  int numQPs;
+  int numDims;
+  int vecDim;
+
+  MDFieldMemoizer<Traits> memoizer;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct DOFFusedInterpolation_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, DOFFusedInterpolation_Tag> DOFFusedInterpolation_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFFusedInterpolation_Tag& tag, const int& cell) const;
+};
+
+/** \brief Fast Fused Finite Element Interpolation Evaluator
+
+    It is an optimized version of DOFFusedInterpolationBase that exploits the
+    sparsity pattern of the derivatives in the Jacobian evaluation, like
+    FastSolutionVecInterpolationBase does for a single field.
+    WARNING: it works only when every field to be interpolated is a component
+             (or a few contiguous components) of the solution, or of its time
+             derivatives, with the offsets given in "Scalar Offsets" and
+             "Vector Offsets". It does not work when the mesh coordinates are
+             of type ScalarT
+*/
+template<typename EvalT, typename Traits, typename ScalarT>
+class FastSolutionFusedInterpolationBase
+      : public DOFFusedInterpolationBase<EvalT, Traits, ScalarT> {
+public:
+
+  FastSolutionFusedInterpolationBase(const Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
+    : DOFFusedInterpolationBase<EvalT, Traits, ScalarT>(p, dl) {
+    this->setName("FastSolutionFusedInterpolationBase"+PHX::print<EvalT>());
+  };
+
+  void postRegistrationSetup(typename Traits::SetupData d, PHX::FieldManager<Traits>& vm) {
+    DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::postRegistrationSetup(d, vm);
+  }
+
+  void evaluateFields(typename Traits::EvalData d) {
+    DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::evaluateFields(d);
+  }
+};
+
+//! Specialization for Jacobian evaluation taking advantage of known sparsity
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+template<typename Traits>
+class FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+  : public DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+{
+public:
+  FastSolutionFusedInterpolationBase(const Teuchos::ParameterList& p,
+                                     const Teuchos::RCP<Albany::Layouts>& dl);
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+                             PHX::FieldManager<Traits>& vm) {
+    DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+      ::postRegistrationSetup(d, vm);
+  }
+
+  void evaluateFields(typename Traits::EvalData d);
+
+private:
+
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+
+  int scalar_offset[DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, ScalarT>::MaxScalarFields];
+  int vector_offset[DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, ScalarT>::MaxVectorFields];
+
+  int num_dof;
+  int neq;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct FastSolutionFusedInterpolation_Jacobian_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, FastSolutionFusedInterpolation_Jacobian_Tag> FastSolutionFusedInterpolation_Jacobian_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const FastSolutionFusedInterpolation_Jacobian_Tag& tag, const int& cell) const;
+};
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
+
+// Some shortcut names
+template<typename EvalT, typename Traits>
+using DOFFusedInterpolation = DOFFusedInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
+
+template<typename EvalT, typename Traits>
+using FastSolutionFusedInterpolation = FastSolutionFusedInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
+
+} // Namespace PHAL
+
+#endif // PHAL_DOF_FUSED_INTERPOLATION_HPP
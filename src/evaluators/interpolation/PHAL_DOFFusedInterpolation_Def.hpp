@@ -0,0 +1,283 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+#include "PHAL_Workset.hpp"
+
+namespace PHAL {
+
+//**********************************************************************
+template<typename EvalT, typename Traits, typename ScalarT>
+DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+DOFFusedInterpolationBase(const Teuchos::ParameterList& p,
+                          const Teuchos::RCP<Albany::Layouts>& dl)
+{
+  Teuchos::Array<std::string> scalar_names, vector_names;
+  if (p.isParameter("Scalar Variable Names"))
+    scalar_names = p.get<Teuchos::Array<std::string>>("Scalar Variable Names");
+  if (p.isParameter("Vector Variable Names"))
+    vector_names = p.get<Teuchos::Array<std::string>>("Vector Variable Names");
+
+  numScalarFields = scalar_names.size();
+  numVectorFields = vector_names.size();
+  interpolateGradients = p.isParameter("Interpolate Gradients") ? p.get<bool>("Interpolate Gradients") : false;
+
+  TEUCHOS_TEST_FOR_EXCEPTION (numScalarFields>MaxScalarFields || numVectorFields>MaxVectorFields, std::logic_error,
+                              "Error! DOFFusedInterpolation supports at most " << MaxScalarFields << " scalar and "
+                              << MaxVectorFields << " vector fields.\n");
+  TEUCHOS_TEST_FOR_EXCEPTION (numScalarFields+numVectorFields==0, std::logic_error,
+                              "Error! DOFFusedInterpolation requires at least one field.\n");
+
+  BF = decltype(BF)(p.get<std::string>("BF Name"), dl->node_qp_scalar);
+  this->addDependentField(BF.fieldTag());
+  if (interpolateGradients) {
+    GradBF = decltype(GradBF)(p.get<std::string>("Gradient BF Name"), dl->node_qp_gradient);
+    this->addDependentField(GradBF.fieldTag());
+  }
+
+  for (int i=0; i<numScalarFields; ++i) {
+    scalar_node[i] = PHX::MDField<const ScalarT,Cell,Node>(scalar_names[i], dl->node_scalar);
+    scalar_qp[i]   = PHX::MDField<ScalarT,Cell,QuadPoint>(scalar_names[i], dl->qp_scalar);
+    this->addDependentField(scalar_node[i].fieldTag());
+    this->addEvaluatedField(scalar_qp[i]);
+    if (interpolateGradients) {
+      scalar_grad_qp[i] = PHX::MDField<OutputScalarT,Cell,QuadPoint,Dim>(scalar_names[i]+" Gradient", dl->qp_gradient);
+      this->addEvaluatedField(scalar_grad_qp[i]);
+    }
+  }
+
+  for (int i=0; i<numVectorFields; ++i) {
+    vector_node[i] = PHX::MDField<const ScalarT,Cell,Node,VecDim>(vector_names[i], dl->node_vector);
+    vector_qp[i]   = PHX::MDField<ScalarT,Cell,QuadPoint,VecDim>(vector_names[i], dl->qp_vector);
+    this->addDependentField(vector_node[i].fieldTag());
+    this->addEvaluatedField(vector_qp[i]);
+    if (interpolateGradients) {
+      vector_grad_qp[i] = PHX::MDField<OutputScalarT,Cell,QuadPoint,VecDim,Dim>(vector_names[i]+" Gradient", dl->qp_vecgradient);
+      this->addEvaluatedField(vector_grad_qp[i]);
+    }
+  }
+
+  this->setName("DOFFusedInterpolationBase"+PHX::print<EvalT>());
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  dl->node_qp_gradient->dimensions(dims);
+  numNodes = dims[1];
+  numQPs   = dims[2];
+  numDims  = dims[3];
+
+  dl->node_vector->dimensions(dims);
+  vecDim   = dims[2];
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits, typename ScalarT>
+void DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(BF,fm);
+  if (interpolateGradients) {
+    this->utils.setFieldData(GradBF,fm);
+  }
+  for (int i=0; i<numScalarFields; ++i) {
+    this->utils.setFieldData(scalar_node[i],fm);
+    this->utils.setFieldData(scalar_qp[i],fm);
+    if (interpolateGradients) {
+      this->utils.setFieldData(scalar_grad_qp[i],fm);
+    }
+  }
+  for (int i=0; i<numVectorFields; ++i) {
+    this->utils.setFieldData(vector_node[i],fm);
+    this->utils.setFieldData(vector_qp[i],fm);
+    if (interpolateGradients) {
+      this->utils.setFieldData(vector_grad_qp[i],fm);
+    }
+  }
+
+  d.fill_field_dependencies(this->dependentFields(),this->evaluatedFields());
+  if (d.memoizer_active()) memoizer.enable_memoizer();
+}
+
+// *********************************************************************
+// Kokkos functor
+template<typename EvalT, typename Traits, typename ScalarT>
+KOKKOS_INLINE_FUNCTION
+void DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+operator() (const DOFFusedInterpolation_Tag& /* tag */, const int& cell) const
+{
+  for (int qp=0; qp < numQPs; ++qp) {
+    for (int node=0; node < numNodes; ++node) {
+      // Read the basis once for all fields. For node==0, overwrite. Then += for 1 to numNodes.
+      const RealType bf = BF(cell, node, qp);
+      if (node==0) {
+        for (int i=0; i<numScalarFields; ++i) {
+          scalar_qp[i](cell,qp) = scalar_node[i](cell,0) * bf;
+        }
+        for (int i=0; i<numVectorFields; ++i) {
+          for (int k=0; k<vecDim; ++k) {
+            vector_qp[i](cell,qp,k) = vector_node[i](cell,0,k) * bf;
+          }
+        }
+      } else {
+        for (int i=0; i<numScalarFields; ++i) {
+          scalar_qp[i](cell,qp) += scalar_node[i](cell,node) * bf;
+        }
+        for (int i=0; i<numVectorFields; ++i) {
+          for (int k=0; k<vecDim; ++k) {
+            vector_qp[i](cell,qp,k) += vector_node[i](cell,node,k) * bf;
+          }
+        }
+      }
+
+      if (!interpolateGradients) continue;
+
+      for (int dim=0; dim<numDims; ++dim) {
+        const MeshScalarT gbf = GradBF(cell, node, qp, dim);
+        if (node==0) {
+          for (int i=0; i<numScalarFields; ++i) {
+            scalar_grad_qp[i](cell,qp,dim) = scalar_node[i](cell,0) * gbf;
+          }
+          for (int i=0; i<numVectorFields; ++i) {
+            for (int k=0; k<vecDim; ++k) {
+              vector_grad_qp[i](cell,qp,k,dim) = vector_node[i](cell,0,k) * gbf;
+            }
+          }
+        } else {
+          for (int i=0; i<numScalarFields; ++i) {
+            scalar_grad_qp[i](cell,qp,dim) += scalar_node[i](cell,node) * gbf;
+          }
+          for (int i=0; i<numVectorFields; ++i) {
+            for (int k=0; k<vecDim; ++k) {
+              vector_grad_qp[i](cell,qp,k,dim) += vector_node[i](cell,node,k) * gbf;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits, typename ScalarT>
+void DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  if (memoizer.have_saved_data(workset,this->evaluatedFields())) return;
+
+  // Cells are independent, so the kernel is threaded over cells also for
+  // the host execution spaces.
+  Kokkos::parallel_for(DOFFusedInterpolation_Policy(0,workset.numCells),*this);
+}
+
+// Specialization for Jacobian evaluation taking advantage of known sparsity
+//**********************************************************************
+
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+
+template<typename Traits>
+FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+FastSolutionFusedInterpolationBase(const Teuchos::ParameterList& p,
+                                   const Teuchos::RCP<Albany::Layouts>& dl)
+  : DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>(p, dl)
+{
+  this->setName("FastSolutionFusedInterpolationBase"+PHX::print<PHAL::AlbanyTraits::Jacobian>());
+
+  Teuchos::Array<int> scalar_offsets, vector_offsets;
+  if (p.isParameter("Scalar Offsets"))
+    scalar_offsets = p.get<Teuchos::Array<int>>("Scalar Offsets");
+  if (p.isParameter("Vector Offsets"))
+    vector_offsets = p.get<Teuchos::Array<int>>("Vector Offsets");
+
+  TEUCHOS_TEST_FOR_EXCEPTION (scalar_offsets.size()!=this->numScalarFields || vector_offsets.size()!=this->numVectorFields,
+                              std::logic_error,
+                              "Error! FastSolutionFusedInterpolation requires the offset of every field.\n");
+
+  for (int i=0; i<this->numScalarFields; ++i) {
+    scalar_offset[i] = scalar_offsets[i];
+  }
+  for (int i=0; i<this->numVectorFields; ++i) {
+    vector_offset[i] = vector_offsets[i];
+  }
+}
+
+//**********************************************************************
+template<typename Traits>
+KOKKOS_INLINE_FUNCTION
+void FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+operator() (const FastSolutionFusedInterpolation_Jacobian_Tag& /* tag */, const int& cell) const
+{
+  // Each field only depends on its own dofs: only those derivative entries are touched
+  for (int qp=0; qp < this->numQPs; ++qp) {
+    for (int i=0; i<this->numScalarFields; ++i) {
+      const int off = scalar_offset[i];
+      ScalarT& val = this->scalar_qp[i](cell,qp);
+      val = ScalarT(num_dof, this->scalar_node[i](cell,0).val() * this->BF(cell,0,qp));
+      val.fastAccessDx(off) = this->scalar_node[i](cell,0).fastAccessDx(off) * this->BF(cell,0,qp);
+      for (int node=1; node < this->numNodes; ++node) {
+        val.val() += this->scalar_node[i](cell,node).val() * this->BF(cell,node,qp);
+        val.fastAccessDx(neq*node+off) += this->scalar_node[i](cell,node).fastAccessDx(neq*node+off) * this->BF(cell,node,qp);
+      }
+
+      if (!this->interpolateGradients) continue;
+
+      for (int dim=0; dim<this->numDims; ++dim) {
+        ScalarT& grad = this->scalar_grad_qp[i](cell,qp,dim);
+        grad = ScalarT(num_dof, this->scalar_node[i](cell,0).val() * this->GradBF(cell,0,qp,dim));
+        grad.fastAccessDx(off) = this->scalar_node[i](cell,0).fastAccessDx(off) * this->GradBF(cell,0,qp,dim);
+        for (int node=1; node < this->numNodes; ++node) {
+          grad.val() += this->scalar_node[i](cell,node).val() * this->GradBF(cell,node,qp,dim);
+          grad.fastAccessDx(neq*node+off) += this->scalar_node[i](cell,node).fastAccessDx(neq*node+off) * this->GradBF(cell,node,qp,dim);
+        }
+      }
+    }
+
+    for (int i=0; i<this->numVectorFields; ++i) {
+      for (int k=0; k<this->vecDim; ++k) {
+        const int off = vector_offset[i]+k;
+        ScalarT& val = this->vector_qp[i](cell,qp,k);
+        val = ScalarT(num_dof, this->vector_node[i](cell,0,k).val() * this->BF(cell,0,qp));
+        val.fastAccessDx(off) = this->vector_node[i](cell,0,k).fastAccessDx(off) * this->BF(cell,0,qp);
+        for (int node=1; node < this->numNodes; ++node) {
+          val.val() += this->vector_node[i](cell,node,k).val() * this->BF(cell,node,qp);
+          val.fastAccessDx(neq*node+off) += this->vector_node[i](cell,node,k).fastAccessDx(neq*node+off) * this->BF(cell,node,qp);
+        }
+
+        if (!this->interpolateGradients) continue;
+
+        for (int dim=0; dim<this->numDims; ++dim) {
+          ScalarT& grad = this->vector_grad_qp[i](cell,qp,k,dim);
+          grad = ScalarT(num_dof, this->vector_node[i](cell,0,k).val() * this->GradBF(cell,0,qp,dim));
+          grad.fastAccessDx(off) = this->vector_node[i](cell,0,k).fastAccessDx(off) * this->GradBF(cell,0,qp,dim);
+          for (int node=1; node < this->numNodes; ++node) {
+            grad.val() += this->vector_node[i](cell,node,k).val() * this->GradBF(cell,node,qp,dim);
+            grad.fastAccessDx(neq*node+off) += this->vector_node[i](cell,node,k).fastAccessDx(neq*node+off) * this->GradBF(cell,node,qp,dim);
+          }
+        }
+      }
+    }
+  }
+}
+
+//**********************************************************************
+template<typename Traits>
+void FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  if (this->numScalarFields>0) {
+    num_dof = this->scalar_node[0](0,0).size();
+  } else {
+    num_dof = this->vector_node[0](0,0,0).size();
+  }
+  neq = workset.wsElNodeEqID.extent(2);
+
+  Kokkos::parallel_for(FastSolutionFusedInterpolation_Jacobian_Policy(0,workset.numCells),*this);
+}
+
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
+
+} // Namespace PHAL
@@ -572,6 +572,12 @@ template<typename Traits>
 void MortarContactResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !workset.dist_param_deriv_op.is_null() || !workset.dist_param_deriv_pattern.is_null(),
+      std::logic_error,
+      "Error! Mortar contact does not support the assembled distributed parameter derivative.\n"
+      "       Set 'Assemble Distributed Parameter Derivative' to false.\n");
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Tpetra_MultiVector> fpVT = workset.fpVT;
   bool trans = workset.transpose_dist_param_deriv;
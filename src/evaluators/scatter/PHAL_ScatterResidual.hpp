@@ -249,9 +249,19 @@ public:
                   const Teuchos::RCP<Albany::Layouts>& dl);
   void evaluateFields(typename Traits::EvalData d);
 protected:
+  //! Sum the cell contributions to df/dp into workset.dist_param_deriv_op
+  //! (or record their pattern). paramLIDs[i] is the overlapped parameter dof
+  //! the i-th derivative refers to, negative if there is none.
+  void assembleDistParamDeriv(typename Traits::EvalData d, const int cell,
+                              const Teuchos::ArrayView<const LO>& paramLIDs);
+
   const std::size_t numFields;
 private:
   typedef typename PHAL::AlbanyTraits::DistParamDeriv::ScalarT ScalarT;
+
+  Teuchos::Array<LO>  assembleCols;
+  Teuchos::Array<int> assembleDerivs;
+  Teuchos::Array<ST>  assembleVals;
 };
 
 template<typename Traits>
@@ -705,6 +705,17 @@ template<typename Traits>
 void ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  if (!workset.dist_param_deriv_op.is_null() || !workset.dist_param_deriv_pattern.is_null()) {
+    const Albany::IDArray&  wsElDofs = workset.distParamLib->get(workset.dist_param_deriv_name)->workset_elem_dofs()[workset.wsIndex];
+    Teuchos::Array<LO> paramLIDs(this->numNodes);
+    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      for (std::size_t node = 0; node < this->numNodes; ++node)
+        paramLIDs[node] = wsElDofs((int)cell,(int)node,0);
+      assembleDistParamDeriv(workset, cell, paramLIDs());
+    }
+    return;
+  }
+
   auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> fpV = workset.fpV;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST>> fpV_nonconst2dView = Albany::getNonconstLocalData(fpV);
@@ -768,19 +779,82 @@ evaluateFields(typename Traits::EvalData workset)
   }
 }
 
+// **********************************************************************
+template<typename Traits>
+void ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
+assembleDistParamDeriv(typename Traits::EvalData workset, const int cell,
+                       const Teuchos::ArrayView<const LO>& paramLIDs)
+{
+  auto nodeID = workset.wsElNodeEqID;
+  int numDims= (this->tensorRank==2) ? this->valTensor.extent(2) : 0;
+
+  assembleCols.clear();
+  assembleDerivs.clear();
+  for (int i=0; i<paramLIDs.size(); ++i) {
+    if (paramLIDs[i] >= 0) {
+      assembleCols.push_back(paramLIDs[i]);
+      assembleDerivs.push_back(i);
+    }
+  }
+  if (assembleCols.size() == 0) { return; }
+  assembleVals.resize(assembleCols.size());
+
+  for (std::size_t node = 0; node < this->numNodes; ++node) {
+    for (std::size_t eq = 0; eq < numFields; eq++) {
+      const LO row = nodeID(cell,node,this->offset + eq);
+      if (workset.dist_param_deriv_op.is_null()) {
+        (*workset.dist_param_deriv_pattern)[row].insert(assembleCols.begin(), assembleCols.end());
+        continue;
+      }
+      typename PHAL::Ref<ScalarT const>::type
+                valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
+                          this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+                          this->valTensor(cell,node, eq/numDims, eq%numDims));
+      if (valref.size() == 0) { continue; } //The parameter has not been gathered
+      for (int k=0; k<assembleCols.size(); ++k)
+        assembleVals[k] = valref.dx(assembleDerivs[k]);
+      Albany::addToLocalRowValues(workset.dist_param_deriv_op, row, assembleCols(), assembleVals());
+    }
+  }
+}
+
 // **********************************************************************
 template<typename Traits>
 void ScatterResidualWithExtrudedParams<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  if(workset.local_Vp[0].size() == 0) { return; } //In case the parameter has not been gathered, e.g. parameter is used only in Dirichlet conditions.
-
   auto level_it = extruded_params_levels->find(workset.dist_param_deriv_name);
   if(level_it == extruded_params_levels->end()) //if parameter is not extruded use usual scatter.
     return ScatterResidual<PHAL::AlbanyTraits::DistParamDeriv, Traits>::evaluateFields(workset);
 
-  auto nodeID = workset.wsElNodeEqID;
   int fieldLevel = level_it->second;
+
+  if (!workset.dist_param_deriv_op.is_null() || !workset.dist_param_deriv_pattern.is_null()) {
+    //The derivative w.r.t. the parameter at a node refers to the parameter dof
+    //at level fieldLevel of the node's column.
+    const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
+    auto overlapVS = workset.distParamLib->get(workset.dist_param_deriv_name)->overlap_vector_space();
+    auto node_indexer = Albany::createGlobalLocalIndexer(workset.disc->getOverlapNodeVectorSpace());
+    auto indexer = Albany::createGlobalLocalIndexer(overlapVS);
+    Teuchos::Array<LO> paramLIDs(this->numNodes);
+    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+      const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[cell];
+      for (std::size_t node = 0; node < this->numNodes; ++node) {
+        const LO lnodeId = node_indexer->getLocalElement(elNodeID[node]);
+        LO base_id, ilayer;
+        layeredMeshNumbering.getIndices(lnodeId, base_id, ilayer);
+        const LO inode = layeredMeshNumbering.getId(base_id, fieldLevel);
+        paramLIDs[node] = indexer->getLocalElement(node_indexer->getGlobalElement(inode));
+      }
+      this->assembleDistParamDeriv(workset, cell, paramLIDs());
+    }
+    return;
+  }
+
+  if(workset.local_Vp[0].size() == 0) { return; } //In case the parameter has not been gathered, e.g. parameter is used only in Dirichlet conditions.
+
+  auto nodeID = workset.wsElNodeEqID;
   Teuchos::RCP<Thyra_MultiVector> fpV = workset.fpV;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<ST>> fpV_nonconst2dView = Albany::getNonconstLocalData(fpV);
 
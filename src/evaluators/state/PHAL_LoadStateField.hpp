@@ -38,6 +38,7 @@ private:
   PHX::MDField<ScalarType> data;
   std::string fieldName;
   std::string stateName;
+  int stateHandle;
 
   MDFieldMemoizer<Traits> memoizer;
 };
@@ -62,6 +63,7 @@ private:
   PHX::MDField<ParamScalarT> data;
   std::string fieldName;
   std::string stateName;
+  int stateHandle;
 
   MDFieldMemoizer<Traits> memoizer;
 };
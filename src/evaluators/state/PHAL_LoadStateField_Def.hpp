@@ -21,6 +21,7 @@ LoadStateFieldBase(const Teuchos::ParameterList& p)
 {
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateHandle = p.isParameter("State Handle") ? p.get<int>("State Handle") : -1;
 
   PHX::MDField<ScalarType> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout") );
   data = f;
@@ -49,10 +50,11 @@ void LoadStateFieldBase<EvalT, Traits, ScalarType>::evaluateFields(typename Trai
   //cout << "LoadStateFieldBase importing state " << stateName << " to field "
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray* stateToLoad = workset.findStateArray(stateHandle,stateName);
+  const int stateSize = stateToLoad == nullptr ? 0 : stateToLoad->size();
   PHAL::MDFieldIterator<ScalarType> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
+  for (int i = 0; ! d.done() && i < stateSize; ++d, ++i)
+    *d = (*stateToLoad)[i];
   for ( ; ! d.done(); ++d) *d = 0.;
 }
 
@@ -62,6 +64,7 @@ LoadStateField(const Teuchos::ParameterList& p)
 {
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateHandle = p.isParameter("State Handle") ? p.get<int>("State Handle") : -1;
 
   PHX::MDField<ParamScalarT> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout") );
   data = f;
@@ -90,10 +93,11 @@ void LoadStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData wor
   //cout << "LoadStateField importing state " << stateName << " to field " 
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
+  const Albany::MDArray* stateToLoad = workset.findStateArray(stateHandle,stateName);
+  const int stateSize = stateToLoad == nullptr ? 0 : stateToLoad->size();
   PHAL::MDFieldIterator<ParamScalarT> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
+  for (int i = 0; ! d.done() && i < stateSize; ++d, ++i)
+    *d = (*stateToLoad)[i];
   for ( ; ! d.done(); ++d) *d = 0.;
 }
 
@@ -49,6 +49,7 @@ SaveCellStateField(const Teuchos::ParameterList& p) :
 
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateHandle = p.isParameter("State Handle") ? p.get<int>("State Handle") : -1;
   field = decltype(field)(fieldName, p.get<Teuchos::RCP<PHX::DataLayout> >("Field Layout") );
 
   savestate_operation = Teuchos::rcp(new PHX::Tag<ScalarT>
@@ -77,13 +78,12 @@ evaluateFields(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-    Albany::StateArray::const_iterator it;
-    it = workset.stateArrayPtr->find(stateName);
+    const Albany::MDArray* stateToSave = workset.findStateArray(stateHandle,stateName);
 
-    TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+    TEUCHOS_TEST_FOR_EXCEPTION((stateToSave == nullptr), std::logic_error,
            std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveCellStateField_Def" << std::endl);
 
-    Albany::MDArray sta = it->second;
+    Albany::MDArray sta = *stateToSave;
 
     std::vector<int> dims;
     field.dimensions(dims);
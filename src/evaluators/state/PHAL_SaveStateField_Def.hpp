@@ -48,6 +48,7 @@ SaveStateField(const Teuchos::ParameterList& p)
 {
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateHandle = p.isParameter("State Handle") ? p.get<int>("State Handle") : -1;
 
   Teuchos::RCP<PHX::DataLayout> layout = p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout");
   field = decltype(field)(fieldName, layout );
@@ -109,13 +110,12 @@ saveElemState(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  const Albany::MDArray* stateToSave = workset.findStateArray(stateHandle,stateName);
 
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+  TEUCHOS_TEST_FOR_EXCEPTION((stateToSave == nullptr), std::logic_error,
          std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray sta = it->second;
+  Albany::MDArray sta = *stateToSave;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -163,13 +163,12 @@ saveWorksetState(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  const Albany::MDArray* stateToSave = workset.findStateArray(stateHandle,stateName);
 
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+  TEUCHOS_TEST_FOR_EXCEPTION((stateToSave == nullptr), std::logic_error,
          std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray sta = it->second;
+  Albany::MDArray sta = *stateToSave;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -153,6 +153,10 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->set<bool>("Solve Adjoint", false, "");
   validPL->set<bool>("Overwrite Nominal Values With Final Point",false,
                      "Whether 'reportFinalPoint' should be allowed to overwrite nominal values");
+  validPL->set<bool>("Assemble Distributed Parameter Derivative",false,
+                     "Whether df/dp for distributed parameters is assembled and reused, rather than applied on the fly");
+  validPL->set<bool>("Hessian-Vector Products",false,
+                     "Whether the model evaluator provides finite-difference approximations of the f_xx and g_xx Hessian-vector products, from the assembled first derivatives");
   validPL->set<int>("Number Of Time Derivatives", 1, "Number of time derivatives in use in the problem");
 
   validPL->set<bool>("Use MDField Memoization", false, "Use memoization to avoid recomputing MDFields");
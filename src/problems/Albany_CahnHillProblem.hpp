@@ -186,17 +186,17 @@ Albany::CahnHillProblem::constructEvaluators(
   fm0.template registerEvaluator<EvalT>
     (evalUtils.constructComputeBasisFunctionsEvaluator(cellType, intrepidBasis, cellCubature));
 
-  for (unsigned int i=0; i<neq; i++) {
+  // Rho and W (values and gradients) and their time derivatives (values only)
+  // are interpolated by two fused evaluators, which read the basis once.
+  Teuchos::ArrayRCP<int> dof_offsets(neq);
+  for (unsigned int i=0; i<neq; i++)
+    dof_offsets[i] = i;
 
-    fm0.template registerEvaluator<EvalT>
-      (evalUtils.constructDOFInterpolationEvaluator(dof_names[i],i));
-
-    fm0.template registerEvaluator<EvalT>
-      (evalUtils.constructDOFInterpolationEvaluator(dof_names_dot[i],i));
+  fm0.template registerEvaluator<EvalT>
+    (evalUtils.constructDOFFusedInterpolationEvaluator(dof_names, Teuchos::ArrayRCP<string>(), true, dof_offsets));
 
-    fm0.template registerEvaluator<EvalT>
-      (evalUtils.constructDOFGradInterpolationEvaluator(dof_names[i],i));
-  }
+  fm0.template registerEvaluator<EvalT>
+    (evalUtils.constructDOFFusedInterpolationEvaluator(dof_names_dot, Teuchos::ArrayRCP<string>(), false, dof_offsets));
 
 
   { // Form the Chemical Energy term in Eq. 2.2
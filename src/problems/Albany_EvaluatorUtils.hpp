@@ -228,6 +228,17 @@ namespace Albany {
     virtual constructDOFVecGradInterpolationEvaluator(
        const std::string& dof_names, int offsetToFirstDOF=-1) const = 0;
 
+    //! Fused interpolation of several scalar and vector quantities (and optionally
+    //! their gradients) in a single evaluator. If the offsets of all the fields are
+    //! given, the fields must be (components of) the solution or its time derivatives.
+    Teuchos::RCP< PHX::Evaluator<Traits> >
+    virtual constructDOFFusedInterpolationEvaluator(
+       const Teuchos::ArrayRCP<std::string>& scalar_dof_names,
+       const Teuchos::ArrayRCP<std::string>& vector_dof_names,
+       bool interpolateGradients = false,
+       const Teuchos::ArrayRCP<int>& scalar_offsets = Teuchos::ArrayRCP<int>(),
+       const Teuchos::ArrayRCP<int>& vector_offsets = Teuchos::ArrayRCP<int>()) const = 0;
+
     //! Interpolation functions for Tensor quantities
     Teuchos::RCP< PHX::Evaluator<Traits> >
     virtual constructDOFTensorInterpolationEvaluator(
@@ -556,6 +567,17 @@ namespace Albany {
     constructDOFVecGradInterpolationEvaluator(
        const std::string& dof_names, int offsetToFirstDOF=-1) const;
 
+    //! Fused interpolation of several scalar and vector quantities (and optionally
+    //! their gradients) in a single evaluator. If the offsets of all the fields are
+    //! given, the fields must be (components of) the solution or its time derivatives.
+    Teuchos::RCP< PHX::Evaluator<Traits> >
+    constructDOFFusedInterpolationEvaluator(
+       const Teuchos::ArrayRCP<std::string>& scalar_dof_names,
+       const Teuchos::ArrayRCP<std::string>& vector_dof_names,
+       bool interpolateGradients = false,
+       const Teuchos::ArrayRCP<int>& scalar_offsets = Teuchos::ArrayRCP<int>(),
+       const Teuchos::ArrayRCP<int>& vector_offsets = Teuchos::ArrayRCP<int>()) const;
+
     //! Interpolation functions for Tensor quantities
     Teuchos::RCP< PHX::Evaluator<Traits> >
     constructDOFTensorInterpolationEvaluator(
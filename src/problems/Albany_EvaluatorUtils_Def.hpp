@@ -15,6 +15,7 @@
 #include "PHAL_ComputeBasisFunctionsSide.hpp"
 #include "PHAL_DOFCellToSide.hpp"
 #include "PHAL_DOFCellToSideQP.hpp"
+#include "PHAL_DOFFusedInterpolation.hpp"
 #include "PHAL_DOFGradInterpolation.hpp"
 #include "PHAL_DOFGradInterpolationSide.hpp"
 #include "PHAL_DOFInterpolation.hpp"
@@ -750,6 +751,41 @@ Albany::EvaluatorUtilsImpl<EvalT,Traits,ScalarType>::constructDOFInterpolationSi
     return rcp(new PHAL::DOFInterpolationSideBase<EvalT,Traits,ScalarType>(*p,dl->side_layouts.at(sideSetName)));
 }
 
+template<typename EvalT, typename Traits, typename ScalarType>
+Teuchos::RCP< PHX::Evaluator<Traits> >
+Albany::EvaluatorUtilsImpl<EvalT,Traits,ScalarType>::constructDOFFusedInterpolationEvaluator(
+       const Teuchos::ArrayRCP<std::string>& scalar_dof_names,
+       const Teuchos::ArrayRCP<std::string>& vector_dof_names,
+       bool interpolateGradients,
+       const Teuchos::ArrayRCP<int>& scalar_offsets,
+       const Teuchos::ArrayRCP<int>& vector_offsets) const
+{
+    using Teuchos::RCP;
+    using Teuchos::rcp;
+    using Teuchos::ParameterList;
+
+    RCP<ParameterList> p = rcp(new ParameterList("DOF Fused Interpolation"));
+    // Input
+    p->set<Teuchos::Array<std::string>>("Scalar Variable Names", Teuchos::Array<std::string>(scalar_dof_names.begin(),scalar_dof_names.end()));
+    p->set<Teuchos::Array<std::string>>("Vector Variable Names", Teuchos::Array<std::string>(vector_dof_names.begin(),vector_dof_names.end()));
+    p->set<std::string>("BF Name", "BF");
+    p->set<std::string>("Gradient BF Name", "Grad BF");
+    p->set<bool>("Interpolate Gradients", interpolateGradients);
+
+    // Output (assumes same Name as input, and "<name> Gradient" for the gradients)
+
+    const bool fast = scalar_offsets.size()==scalar_dof_names.size() &&
+                      vector_offsets.size()==vector_dof_names.size() &&
+                      scalar_offsets.size()+vector_offsets.size()>0;
+    if(!fast)
+      return rcp(new PHAL::DOFFusedInterpolationBase<EvalT,Traits,ScalarType>(*p,dl));
+
+    //works only for solution or a set of solution components
+    p->set<Teuchos::Array<int>>("Scalar Offsets", Teuchos::Array<int>(scalar_offsets.begin(),scalar_offsets.end()));
+    p->set<Teuchos::Array<int>>("Vector Offsets", Teuchos::Array<int>(vector_offsets.begin(),vector_offsets.end()));
+    return rcp(new PHAL::FastSolutionFusedInterpolationBase<EvalT,Traits,ScalarType>(*p,dl));
+}
+
 template<typename EvalT, typename Traits, typename ScalarType>
 Teuchos::RCP< PHX::Evaluator<Traits> >
 Albany::EvaluatorUtilsImpl<EvalT,Traits,ScalarType>::constructDOFTensorInterpolationEvaluator(
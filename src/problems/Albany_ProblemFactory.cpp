@@ -179,7 +179,7 @@ Albany::ProblemFactory::create()
 #endif
   }
   else if (getName(method) == "Mechanics") {
-    strategy = rcp(new Albany::MechanicsProblem(problemParams, paramLib, getNumDim(method), rc_mgr, commT));
+    strategy = rcp(new Albany::MechanicsProblem(problemParams, discretizationParams, paramLib, getNumDim(method), rc_mgr, commT));
   }
   else if (getName(method) == "Elasticity") {
     strategy = rcp(new Albany::ElasticityProblem(problemParams, paramLib, getNumDim(method), rc_mgr));
@@ -0,0 +1,259 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include <cmath>
+#include <vector>
+
+#include <Intrepid2_HGRAD_HEX_C1_FEM.hpp>
+#include <Intrepid2_HGRAD_QUAD_C1_FEM.hpp>
+#include <Intrepid2_HGRAD_QUAD_C2_FEM.hpp>
+#include <Intrepid2_HGRAD_TET_C1_FEM.hpp>
+#include <Intrepid2_HGRAD_TRI_C1_FEM.hpp>
+#include <Kokkos_DynRankView_Fad.hpp>
+#include <Phalanx_KokkosDeviceTypes.hpp>
+#include <Shards_CellTopology.hpp>
+
+#include "ATO_Integrator.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+typedef Kokkos::DynRankView<RealType, PHX::Device>              View;
+typedef Intrepid2::Basis<PHX::Device, RealType, RealType>       Basis;
+
+// Level set a.x, which the linear bases interpolate exactly
+double const slope[] = {1.0, 2.0, 4.0};
+
+//
+// Measure of {a.x < c} in the unit box [0,1]^n, for a > 0.
+//
+double
+boxMeasureBelow(int const n, double const c)
+{
+  double sum = 0.0, denom = 1.0;
+  for (int d = 0; d < n; ++d) denom *= (d + 1) * slope[d];
+  for (int s = 0; s < (1 << n); ++s) {
+    double value = c;
+    int    parity = 1;
+    for (int d = 0; d < n; ++d) {
+      if (s & (1 << d)) {
+        value -= slope[d];
+        parity = -parity;
+      }
+    }
+    if (value > 0.0) sum += parity * std::pow(value, n);
+  }
+  return sum / denom;
+}
+
+//
+// Measure of {a.x < c} in the unit simplex, whose vertex values a.x_i are
+// distinct.
+//
+double
+simplexMeasureBelow(int const n, double const c)
+{
+  std::vector<double> f(1, 0.0);
+  double              volume = 1.0;
+  for (int d = 0; d < n; ++d) {
+    f.push_back(slope[d]);
+    volume /= d + 1;
+  }
+  double sum = 0.0;
+  for (int i = 0; i <= n; ++i) {
+    if (c <= f[i]) continue;
+    double denom = 1.0;
+    for (int j = 0; j <= n; ++j)
+      if (j != i) denom *= f[j] - f[i];
+    sum += std::pow(c - f[i], n) / denom;
+  }
+  return volume * sum;
+}
+
+struct Cell
+{
+  RCP<shards::CellTopology> topology;
+  RCP<Basis>                basis;
+  bool                      isBox;
+  View                      coords;
+  double                    volume;
+};
+
+//
+// Unit box or unit simplex, with the nodes of the basis.
+//
+template <typename Topology, typename BasisType>
+Cell
+unitCell(bool const isBox)
+{
+  Cell cell;
+  cell.topology = rcp(new shards::CellTopology(
+      shards::getCellTopologyData<Topology>()));
+  cell.basis = rcp(new BasisType());
+  cell.isBox = isBox;
+
+  int const nodes = cell.basis->getCardinality();
+  int const dims  = cell.topology->getDimension();
+  cell.coords     = View("coords", nodes, dims);
+  cell.basis->getDofCoords(cell.coords);
+  cell.volume = 1.0;
+  for (int d = 0; d < dims; ++d) {
+    if (!isBox) cell.volume /= d + 1;
+    if (!isBox) continue;
+    for (int I = 0; I < nodes; ++I)
+      cell.coords(I, d) = 0.5 * (cell.coords(I, d) + 1.0);
+  }
+  return cell;
+}
+
+View
+levelSet(Cell const& cell)
+{
+  int const nodes = cell.coords.extent(0);
+  int const dims  = cell.coords.extent(1);
+  View      vals("topoVals", nodes);
+  for (int I = 0; I < nodes; ++I) {
+    vals(I) = 0.0;
+    for (int d = 0; d < dims; ++d) vals(I) += slope[d] * cell.coords(I, d);
+  }
+  return vals;
+}
+
+//
+// The conformal measure of {a.x >= c} and {a.x <= c} must be the exact cut
+// measure, and dMdtopo must match central differences of the measure.  The
+// cut values avoid the level set values at the subsimplex vertices, where
+// the measure is not differentiable.
+//
+void
+checkCutMeasure(
+    Teuchos::FancyOStream& out,
+    bool&                  success,
+    Cell const&            cell,
+    std::vector<double> const& cuts)
+{
+  ATO::SubIntegrator integrator(cell.topology, cell.basis, 1, 1.0e-5);
+
+  int const dims  = cell.coords.extent(1);
+  int const nodes = cell.coords.extent(0);
+  View      topoVals = levelSet(cell);
+  View      dMdtopo("dMdtopo", nodes);
+
+  for (double const c : cuts) {
+    double const below = cell.isBox ? boxMeasureBelow(dims, c)
+                                    : simplexMeasureBelow(dims, c);
+    for (ATO::Sense const sense : {ATO::Positive, ATO::Negative}) {
+      double const exact =
+          sense == ATO::Positive ? cell.volume - below : below;
+
+      double measure = 0.0;
+      integrator.getMeasure(measure, topoVals, cell.coords, c, sense, 0);
+      TEST_FLOATING_EQUALITY(measure, exact, 1.0e-12);
+
+      double measure_fad = 0.0;
+      integrator.getMeasure(
+          measure_fad, dMdtopo, topoVals, cell.coords, c, sense, 0);
+      TEST_FLOATING_EQUALITY(measure_fad, exact, 1.0e-12);
+
+      double const h = 1.0e-6;
+      for (int I = 0; I < nodes; ++I) {
+        double const val = topoVals(I);
+        double       plus = 0.0, minus = 0.0;
+        topoVals(I) = val + h;
+        integrator.getMeasure(plus, topoVals, cell.coords, c, sense, 0);
+        topoVals(I) = val - h;
+        integrator.getMeasure(minus, topoVals, cell.coords, c, sense, 0);
+        topoVals(I) = val;
+        TEST_COMPARE(
+            std::abs(dMdtopo(I) - (plus - minus) / (2.0 * h)), <, 1.0e-7);
+      }
+    }
+  }
+}
+
+//
+// Uncut cells return the cell measure or zero, with no sensitivity, and the
+// cached geometry must follow the coordinates once the cache is cleared.
+//
+void
+checkUncutAndCache(
+    Teuchos::FancyOStream& out,
+    bool&                  success,
+    Cell const&            cell)
+{
+  ATO::SubIntegrator integrator(cell.topology, cell.basis, 1, 1.0e-5);
+
+  int const dims  = cell.coords.extent(1);
+  int const nodes = cell.coords.extent(0);
+  View      topoVals = levelSet(cell);
+  View      dMdtopo("dMdtopo", nodes);
+
+  double measure = 0.0;
+  integrator.getMeasure(
+      measure, dMdtopo, topoVals, cell.coords, -1.0, ATO::Positive, 0);
+  TEST_FLOATING_EQUALITY(measure, cell.volume, 1.0e-12);
+  for (int I = 0; I < nodes; ++I) TEST_EQUALITY(dMdtopo(I), 0.0);
+
+  integrator.getMeasure(
+      measure, dMdtopo, topoVals, cell.coords, -1.0, ATO::Negative, 0);
+  TEST_EQUALITY(measure, 0.0);
+  for (int I = 0; I < nodes; ++I) TEST_EQUALITY(dMdtopo(I), 0.0);
+
+  View scaled("scaled", nodes, dims);
+  for (int I = 0; I < nodes; ++I)
+    for (int d = 0; d < dims; ++d) scaled(I, d) = 2.0 * cell.coords(I, d);
+
+  integrator.clearCache();
+  integrator.getMeasure(measure, topoVals, scaled, -1.0, ATO::Positive, 0);
+  TEST_FLOATING_EQUALITY(measure, std::pow(2.0, dims) * cell.volume, 1.0e-12);
+}
+
+TEUCHOS_UNIT_TEST(ConformalIntegrator, Triangle)
+{
+  Cell const cell = unitCell<
+      shards::Triangle<3>,
+      Intrepid2::Basis_HGRAD_TRI_C1_FEM<PHX::Device, RealType, RealType>>(
+      false);
+  checkCutMeasure(out, success, cell, {0.6, 1.7});
+  checkUncutAndCache(out, success, cell);
+}
+
+TEUCHOS_UNIT_TEST(ConformalIntegrator, Quadrilateral)
+{
+  Cell const cell = unitCell<
+      shards::Quadrilateral<4>,
+      Intrepid2::Basis_HGRAD_QUAD_C1_FEM<PHX::Device, RealType, RealType>>(
+      true);
+  checkCutMeasure(out, success, cell, {0.4, 1.2, 2.6});
+  checkUncutAndCache(out, success, cell);
+}
+
+TEUCHOS_UNIT_TEST(ConformalIntegrator, Tetrahedron)
+{
+  Cell const cell = unitCell<
+      shards::Tetrahedron<4>,
+      Intrepid2::Basis_HGRAD_TET_C1_FEM<PHX::Device, RealType, RealType>>(
+      false);
+  checkCutMeasure(out, success, cell, {0.6, 1.7, 3.1});
+  checkUncutAndCache(out, success, cell);
+}
+
+TEUCHOS_UNIT_TEST(ConformalIntegrator, Hexahedron)
+{
+  Cell const cell = unitCell<
+      shards::Hexahedron<8>,
+      Intrepid2::Basis_HGRAD_HEX_C1_FEM<PHX::Device, RealType, RealType>>(
+      true);
+  checkCutMeasure(out, success, cell, {0.7, 2.2, 3.3, 5.1});
+  checkUncutAndCache(out, success, cell);
+}
+
+}  // namespace
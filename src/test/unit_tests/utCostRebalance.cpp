@@ -0,0 +1,287 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "AAdapt_CostRebalance.hpp"
+#include "Albany_Application.hpp"
+#include "Albany_CommUtils.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+std::string const cost_name = "evaluation_cost";
+
+double const threshold = 1.2;
+
+// Elements left of x = 1/2 are ten times as expensive as the others
+double const heavy_cost = 10.0;
+
+//
+// Steady 2D heat equation on a square, with the "Cost Rebalance" adapter.
+//
+RCP<Teuchos::ParameterList>
+heatWithCostRebalance()
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set<std::string>("Name", "Heat 2D");
+  problem.set<std::string>("Solution Method", "Steady");
+
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set<double>("DBC on NS NodeSet0 for DOF T", 1.0);
+  dbcs.set<double>("DBC on NS NodeSet1 for DOF T", 0.0);
+
+  Teuchos::ParameterList& adapt = problem.sublist("Adaptation");
+  adapt.set<std::string>("Method", "Cost Rebalance");
+  adapt.set<std::string>("Cost Field Name", cost_name);
+  adapt.set<double>("Imbalance Threshold", threshold);
+  adapt.set<Teuchos::Array<int>>(
+      "Remesh Step Number", Teuchos::Array<int>(1, 3));
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "STK2D");
+  disc.set<int>("1D Elements", 24);
+  disc.set<int>("2D Elements", 24);
+  // Several worksets per rank
+  disc.set<int>("Workset Size", 50);
+  // The adapter renames the output file of every new partition
+  disc.set<std::string>("Exodus Output File Name", "cost_rebalance.exo");
+
+  return params;
+}
+
+RCP<AAdapt::CostRebalance>
+costRebalance(
+    RCP<Teuchos::ParameterList> const& params,
+    RCP<Albany::Application> const&    app,
+    RCP<Teuchos_Comm const> const&     comm)
+{
+  RCP<Teuchos::ParameterList> adapt_params =
+      Teuchos::sublist(Teuchos::sublist(params, "Problem"), "Adaptation");
+  return rcp(new AAdapt::CostRebalance(
+      adapt_params, app->getParamLib(), app->getStateMgr(), comm));
+}
+
+Albany::MDArray&
+costArray(RCP<Albany::Application> const& app, int const ws)
+{
+  Albany::StateArray& states =
+      app->getStateMgr().getStateArray(Albany::StateManager::ELEM, ws);
+  auto it = states.find(cost_name);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      it == states.end(), std::logic_error,
+      "Error! The cost state is not registered.\n");
+  return it->second;
+}
+
+int
+numCells(RCP<Albany::Application> const& app, int const ws)
+{
+  return app->getDiscretization()->getWsElNodeID()[ws].size();
+}
+
+int
+numWorksets(RCP<Albany::Application> const& app)
+{
+  return app->getDiscretization()->getWsElNodeID().size();
+}
+
+double
+cellCost(RCP<Albany::Application> const& app, int const ws, int const cell)
+{
+  auto const  disc   = app->getDiscretization();
+  auto const& coords = disc->getCoords()[ws][cell];
+  int const   nodes  = disc->getWsElNodeID()[ws][cell].size();
+  double      x      = 0.0;
+  for (int node = 0; node < nodes; ++node) x += coords[node][0];
+  return x / nodes < 0.5 ? heavy_cost : 1.0;
+}
+
+double
+localCost(RCP<Albany::Application> const& app)
+{
+  double cost = 0.0;
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    for (int cell = 0; cell < numCells(app, ws); ++cell) {
+      cost += costArray(app, ws)(cell);
+    }
+  }
+  return cost;
+}
+
+int
+localCells(RCP<Albany::Application> const& app)
+{
+  int cells = 0;
+  for (int ws = 0; ws < numWorksets(app); ++ws) cells += numCells(app, ws);
+  return cells;
+}
+
+//
+// Max over ranks of a local value, divided by the mean.
+//
+double
+imbalance(RCP<Teuchos_Comm const> const& comm, double const local)
+{
+  double max = 0.0, sum = 0.0;
+  Teuchos::reduceAll(
+      *comm, Teuchos::REDUCE_MAX, local, Teuchos::ptrFromRef(max));
+  Teuchos::reduceAll(
+      *comm, Teuchos::REDUCE_SUM, local, Teuchos::ptrFromRef(sum));
+  return max * comm->getSize() / sum;
+}
+
+//
+// Each residual evaluation adds its measured time to the cost state, split
+// evenly among the cells of every workset.
+//
+TEUCHOS_UNIT_TEST(CostRebalance, RecordsEvaluationCost)
+{
+  RCP<Teuchos_Comm const>     comm   = Albany::getDefaultComm();
+  RCP<Teuchos::ParameterList> params = heatWithCostRebalance();
+  RCP<Albany::Application>    app =
+      rcp(new Albany::Application(comm, params));
+
+  RCP<Thyra_Vector> x = Thyra::createMember(app->getVectorSpace());
+  RCP<Thyra_Vector> f = Thyra::createMember(app->getVectorSpace());
+  x->assign(0.0);
+  Teuchos::Array<ParamVec> const p;
+
+  TEST_EQUALITY(localCost(app), 0.0);
+
+  app->computeGlobalResidual(
+      0.0, x, Teuchos::null, Teuchos::null, p, f);
+  std::vector<double> first;
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    Albany::MDArray const& cost = costArray(app, ws);
+    TEST_COMPARE(cost(0), >, 0.0);
+    for (int cell = 1; cell < numCells(app, ws); ++cell) {
+      TEST_EQUALITY(cost(cell), cost(0));
+    }
+    first.push_back(cost(0));
+  }
+
+  // The cost accumulates over the evaluations
+  app->computeGlobalResidual(
+      0.0, x, Teuchos::null, Teuchos::null, p, f);
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    TEST_COMPARE(costArray(app, ws)(0), >, first[ws]);
+  }
+}
+
+//
+// The adapter must measure the imbalance of the cost state, and rebalance
+// when it exceeds the threshold, or at the listed steps. A single rank is
+// never rebalanced.
+//
+TEUCHOS_UNIT_TEST(CostRebalance, ThresholdDecision)
+{
+  RCP<Teuchos_Comm const>     comm   = Albany::getDefaultComm();
+  RCP<Teuchos::ParameterList> params = heatWithCostRebalance();
+  RCP<Albany::Application>    app =
+      rcp(new Albany::Application(comm, params));
+  RCP<AAdapt::CostRebalance>  adapter = costRebalance(params, app, comm);
+  bool const                  parallel = comm->getSize() > 1;
+
+  // Nothing measured yet
+  TEST_EQUALITY(adapter->measureImbalance(), 1.0);
+  TEST_EQUALITY(adapter->queryAdaptationCriteria(1), false);
+
+  // Rank 0 is ten times as expensive as the others
+  double const rank_cost = comm->getRank() == 0 ? heavy_cost : 1.0;
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    for (int cell = 0; cell < numCells(app, ws); ++cell) {
+      costArray(app, ws)(cell) = rank_cost;
+    }
+  }
+  double const skewed = imbalance(comm, localCost(app));
+  if (parallel) TEST_COMPARE(skewed, >, threshold);
+  TEST_FLOATING_EQUALITY(adapter->measureImbalance(), skewed, 1.0e-12);
+  TEST_EQUALITY(adapter->queryAdaptationCriteria(1), parallel);
+
+  // The same cost on every rank
+  double const per_cell = 1.0 / localCells(app);
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    for (int cell = 0; cell < numCells(app, ws); ++cell) {
+      costArray(app, ws)(cell) = per_cell;
+    }
+  }
+  TEST_FLOATING_EQUALITY(adapter->measureImbalance(), 1.0, 1.0e-12);
+  TEST_EQUALITY(adapter->queryAdaptationCriteria(1), false);
+  TEST_EQUALITY(adapter->queryAdaptationCriteria(3), parallel);
+}
+
+//
+// After the rebalance weighted with the cost state, the ranks must carry the
+// same cost, so the ranks owning the expensive elements must own fewer
+// elements. The cost is reset for the new partition.
+//
+TEUCHOS_UNIT_TEST(CostRebalance, WeightedRebalance)
+{
+  RCP<Teuchos_Comm const>     comm   = Albany::getDefaultComm();
+  RCP<Teuchos::ParameterList> params = heatWithCostRebalance();
+  RCP<Albany::Application>    app =
+      rcp(new Albany::Application(comm, params));
+  RCP<AAdapt::CostRebalance>  adapter = costRebalance(params, app, comm);
+  int const                   num_procs = comm->getSize();
+
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    for (int cell = 0; cell < numCells(app, ws); ++cell) {
+      costArray(app, ws)(cell) = cellCost(app, ws, cell);
+    }
+  }
+
+  TEST_ASSERT(adapter->adaptMesh());
+  app->getStateMgr().updateStateArrayHandles();
+
+  TEST_EQUALITY(localCost(app), 0.0);
+  TEST_EQUALITY(adapter->measureImbalance(), 1.0);
+
+  if (num_procs == 1) return;
+
+  // The new partition, with the cost of its elements
+  double cost = 0.0;
+  for (int ws = 0; ws < numWorksets(app); ++ws) {
+    for (int cell = 0; cell < numCells(app, ws); ++cell) {
+      cost += cellCost(app, ws, cell);
+    }
+  }
+  double const cells = localCells(app);
+
+  // Zoltan balances the weights within its default tolerance of 10%, up to
+  // the granularity of the elements
+  TEST_COMPARE(imbalance(comm, cost), <=, 1.25);
+
+  // Half the elements carry 10/11 of the cost: counting elements, the
+  // partition must be far from balanced
+  TEST_COMPARE(imbalance(comm, cells), >=, 1.3);
+
+  // The rank owning the most elements owns the cheapest ones
+  std::vector<double> all_cells(num_procs), all_costs(num_procs);
+  Teuchos::gatherAll(*comm, 1, &cells, num_procs, all_cells.data());
+  Teuchos::gatherAll(*comm, 1, &cost, num_procs, all_costs.data());
+  int const most = std::max_element(all_cells.begin(), all_cells.end()) -
+                   all_cells.begin();
+  int const fewest = std::min_element(all_cells.begin(), all_cells.end()) -
+                     all_cells.begin();
+  TEST_COMPARE(
+      all_costs[most] / all_cells[most], <,
+      all_costs[fewest] / all_cells[fewest]);
+}
+
+}  // namespace
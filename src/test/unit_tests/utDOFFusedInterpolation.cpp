@@ -0,0 +1,433 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Albany_Layouts.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_DOFFusedInterpolation.hpp"
+#include "PHAL_DOFGradInterpolation.hpp"
+#include "PHAL_DOFInterpolation.hpp"
+#include "PHAL_DOFVecGradInterpolation.hpp"
+#include "PHAL_DOFVecInterpolation.hpp"
+#include "PHAL_Workset.hpp"
+
+namespace {
+
+typedef PHAL::AlbanyTraits           Traits;
+typedef PHAL::AlbanyTraits::Residual Residual;
+typedef PHAL::AlbanyTraits::Jacobian Jacobian;
+using Teuchos::Array;
+using Teuchos::ArrayRCP;
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+//
+// Sets the values of a field, as a gather evaluator would: for the
+// Jacobian, the nodal values of a dof field only depend on their own
+// dof, i.e., on the derivative entry neq*node+offset+component.
+//
+template <typename EvalT, typename DataT>
+class SetField : public PHX::EvaluatorWithBaseImpl<Traits>,
+                 public PHX::EvaluatorDerived<EvalT, Traits>
+{
+ public:
+  SetField(
+      std::string const&          name,
+      RCP<PHX::DataLayout> const& layout,
+      ArrayRCP<DataT> const&      values)
+      : field(name, layout), values(values)
+  {
+    layout->dimensions(dims);
+    this->addEvaluatedField(field);
+    this->setName("SetField " + name);
+  }
+
+  void
+  postRegistrationSetup(Traits::SetupData /* d */, PHX::FieldManager<Traits>& fm)
+  {
+    this->utils.setFieldData(field, fm);
+  }
+
+  void
+  evaluateFields(Traits::EvalData /* d */)
+  {
+    int const d1 = dims[1];
+    int const d2 = dims.size() > 2 ? dims[2] : 1;
+    int const d3 = dims.size() > 3 ? dims[3] : 1;
+    for (int i = 0; i < static_cast<int>(dims[0]); ++i)
+      for (int j = 0; j < d1; ++j)
+        for (int k = 0; k < d2; ++k)
+          for (int l = 0; l < d3; ++l) {
+            DataT const& v = values[((i * d1 + j) * d2 + k) * d3 + l];
+            switch (dims.size()) {
+              case 2: field(i, j) = v; break;
+              case 3: field(i, j, k) = v; break;
+              case 4: field(i, j, k, l) = v; break;
+            }
+          }
+  }
+
+ private:
+  PHX::MDField<DataT>                     field;
+  std::vector<PHX::DataLayout::size_type> dims;
+  ArrayRCP<DataT>                         values;
+};
+
+//
+// Deterministic pseudo-random values so that both field managers see
+// exactly the same input data.
+//
+double
+pseudoRandom(unsigned int& state)
+{
+  state = 1103515245u * state + 12345u;
+  return static_cast<double>((state >> 8) % 10000) / 5000.0 - 1.0;
+}
+
+void
+seed(RealType& v, double const val, int const /* num_dof */, int const /* dof */)
+{
+  v = val;
+}
+
+void
+seed(FadType& v, double const val, int const num_dof, int const dof)
+{
+  v                   = FadType(num_dof, val);
+  v.fastAccessDx(dof) = 1.0;
+}
+
+//
+// Values of a field with layout (Cell, Node[, Component]): the derivative
+// of each entry is seeded at neq*node+offset+component.
+//
+template <typename DataT>
+ArrayRCP<DataT>
+dofValues(
+    RCP<PHX::DataLayout> const& layout,
+    int const                   offset,
+    int const                   neq,
+    int const                   seedIndex)
+{
+  std::vector<PHX::DataLayout::size_type> dims;
+  layout->dimensions(dims);
+  int const numNodes = dims[1];
+  int const numComps = dims.size() > 2 ? dims[2] : 1;
+  int const num_dof  = neq * numNodes;
+
+  ArrayRCP<DataT> values(layout->size());
+  unsigned int    state = 12345u + 7919u * seedIndex;
+  for (int i = 0; i < values.size(); ++i) {
+    int const node = (i / numComps) % numNodes;
+    int const comp = i % numComps;
+    seed(values[i], pseudoRandom(state), num_dof, neq * node + offset + comp);
+  }
+  return values;
+}
+
+ArrayRCP<RealType>
+basisValues(RCP<PHX::DataLayout> const& layout, int const seedIndex)
+{
+  ArrayRCP<RealType> values(layout->size());
+  unsigned int       state = 12345u + 7919u * seedIndex;
+  for (int i = 0; i < values.size(); ++i) values[i] = pseudoRandom(state);
+  return values;
+}
+
+template <typename EvalT>
+void
+registerInputs(
+    PHX::FieldManager<Traits>&  fm,
+    RCP<Albany::Layouts> const& dl,
+    Array<std::string> const&   scalarNames,
+    Array<std::string> const&   vectorNames,
+    int const                   neq)
+{
+  typedef typename EvalT::ScalarT ScalarT;
+  fm.registerEvaluator<EvalT>(rcp(new SetField<EvalT, RealType>(
+      "BF", dl->node_qp_scalar, basisValues(dl->node_qp_scalar, 0))));
+  fm.registerEvaluator<EvalT>(rcp(new SetField<EvalT, RealType>(
+      "Grad BF", dl->node_qp_gradient, basisValues(dl->node_qp_gradient, 1))));
+  // Scalar fields come first in the solution, followed by the vector ones
+  for (int i = 0; i < scalarNames.size(); ++i)
+    fm.registerEvaluator<EvalT>(rcp(new SetField<EvalT, ScalarT>(
+        scalarNames[i],
+        dl->node_scalar,
+        dofValues<ScalarT>(dl->node_scalar, i, neq, 10 + i))));
+  int const vecDim = dl->node_vector->extent(2);
+  for (int i = 0; i < vectorNames.size(); ++i)
+    fm.registerEvaluator<EvalT>(rcp(new SetField<EvalT, ScalarT>(
+        vectorNames[i],
+        dl->node_vector,
+        dofValues<ScalarT>(
+            dl->node_vector, scalarNames.size() + i * vecDim, neq, 20 + i))));
+}
+
+template <typename EvalT>
+void
+requireAll(PHX::FieldManager<Traits>& fm, RCP<PHX::Evaluator<Traits>> const& ev)
+{
+  for (auto const& tag : ev->evaluatedFields()) fm.requireField<EvalT>(*tag);
+}
+
+template <typename EvalT>
+double
+timeEvaluation(
+    PHX::FieldManager<Traits>& fm,
+    PHAL::Workset&             workset,
+    int const                  numRepetitions)
+{
+  auto const start = std::chrono::high_resolution_clock::now();
+  for (int r = 0; r < numRepetitions; ++r) {
+    fm.preEvaluate<EvalT>(workset);
+    fm.evaluateFields<EvalT>(workset);
+    fm.postEvaluate<EvalT>(workset);
+  }
+  Kokkos::fence();
+  auto const stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+bool
+near(RealType const a, RealType const b, double const tolerance)
+{
+  return std::abs(a - b) <= tolerance;
+}
+
+bool
+near(FadType const& a, FadType const& b, double const tolerance)
+{
+  if (a.size() != b.size() || std::abs(a.val() - b.val()) > tolerance)
+    return false;
+  for (int k = 0; k < a.size(); ++k)
+    if (std::abs(a.fastAccessDx(k) - b.fastAccessDx(k)) > tolerance)
+      return false;
+  return true;
+}
+
+//
+// Interpolate a set of scalar and vector fields (and their gradients)
+// with both the per-field evaluators and the fused one, check that the
+// values (and, for the Jacobian, the derivatives) agree, and report the
+// time spent by each. With useOffsets, the fused evaluator is given the
+// solution offsets of the fields, and exploits the derivative sparsity.
+//
+template <typename EvalT>
+void
+compareFusedInterpolation(
+    Teuchos::FancyOStream& out,
+    bool&                  success,
+    std::string const&     elementName,
+    int const              numNodes,
+    int const              numQPts,
+    int const              numDim,
+    bool const             useOffsets)
+{
+  typedef typename EvalT::ScalarT ScalarT;
+
+  double const tolerance      = 1.0e-12;
+  int const    worksetSize    = 200;
+  int const    numRepetitions = 10;
+
+  RCP<Albany::Layouts> const dl = rcp(
+      new Albany::Layouts(worksetSize, numNodes, numNodes, numQPts, numDim));
+
+  Array<std::string> scalarNames;
+  scalarNames.push_back("Temperature");
+  scalarNames.push_back("Pressure");
+  scalarNames.push_back("Concentration");
+  Array<std::string> vectorNames;
+  vectorNames.push_back("Displacement");
+
+  int const neq     = scalarNames.size() + numDim * vectorNames.size();
+  int const num_dof = neq * numNodes;
+
+  // Per-field evaluators
+  PHX::FieldManager<Traits> separateFM;
+  registerInputs<EvalT>(separateFM, dl, scalarNames, vectorNames, neq);
+  for (auto const& name : scalarNames) {
+    Teuchos::ParameterList p;
+    p.set<std::string>("Variable Name", name);
+    p.set<std::string>("BF Name", "BF");
+    RCP<PHX::Evaluator<Traits>> ev =
+        rcp(new PHAL::DOFInterpolation<EvalT, Traits>(p, dl));
+    separateFM.registerEvaluator<EvalT>(ev);
+    requireAll<EvalT>(separateFM, ev);
+
+    Teuchos::ParameterList pg;
+    pg.set<std::string>("Variable Name", name);
+    pg.set<std::string>("Gradient BF Name", "Grad BF");
+    pg.set<std::string>("Gradient Variable Name", name + " Gradient");
+    ev = rcp(new PHAL::DOFGradInterpolation<EvalT, Traits>(pg, dl));
+    separateFM.registerEvaluator<EvalT>(ev);
+    requireAll<EvalT>(separateFM, ev);
+  }
+  for (auto const& name : vectorNames) {
+    Teuchos::ParameterList p;
+    p.set<std::string>("Variable Name", name);
+    p.set<std::string>("BF Name", "BF");
+    RCP<PHX::Evaluator<Traits>> ev =
+        rcp(new PHAL::DOFVecInterpolation<EvalT, Traits>(p, dl));
+    separateFM.registerEvaluator<EvalT>(ev);
+    requireAll<EvalT>(separateFM, ev);
+
+    Teuchos::ParameterList pg;
+    pg.set<std::string>("Variable Name", name);
+    pg.set<std::string>("Gradient BF Name", "Grad BF");
+    pg.set<std::string>("Gradient Variable Name", name + " Gradient");
+    ev = rcp(new PHAL::DOFVecGradInterpolation<EvalT, Traits>(pg, dl));
+    separateFM.registerEvaluator<EvalT>(ev);
+    requireAll<EvalT>(separateFM, ev);
+  }
+
+  // Fused evaluator
+  PHX::FieldManager<Traits> fusedFM;
+  registerInputs<EvalT>(fusedFM, dl, scalarNames, vectorNames, neq);
+  {
+    Teuchos::ParameterList p;
+    p.set<Array<std::string>>("Scalar Variable Names", scalarNames);
+    p.set<Array<std::string>>("Vector Variable Names", vectorNames);
+    p.set<std::string>("BF Name", "BF");
+    p.set<std::string>("Gradient BF Name", "Grad BF");
+    p.set<bool>("Interpolate Gradients", true);
+    RCP<PHX::Evaluator<Traits>> ev;
+    if (useOffsets) {
+      Array<int> scalarOffsets, vectorOffsets;
+      for (int i = 0; i < scalarNames.size(); ++i) scalarOffsets.push_back(i);
+      for (int i = 0; i < vectorNames.size(); ++i)
+        vectorOffsets.push_back(scalarNames.size() + i * numDim);
+      p.set<Array<int>>("Scalar Offsets", scalarOffsets);
+      p.set<Array<int>>("Vector Offsets", vectorOffsets);
+      ev = rcp(new PHAL::FastSolutionFusedInterpolation<EvalT, Traits>(p, dl));
+    } else {
+      ev = rcp(new PHAL::DOFFusedInterpolation<EvalT, Traits>(p, dl));
+    }
+    fusedFM.registerEvaluator<EvalT>(ev);
+    requireAll<EvalT>(fusedFM, ev);
+  }
+
+  std::vector<PHX::index_size_type> derivative_dimensions;
+  derivative_dimensions.push_back(num_dof);
+  separateFM.setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+  fusedFM.setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+
+  PHAL::Setup setupData;
+  separateFM.postRegistrationSetup(setupData);
+  fusedFM.postRegistrationSetup(setupData);
+
+  // The fast Jacobian kernels read the number of equations from here
+  PHAL::Workset workset;
+  workset.numCells     = worksetSize;
+  workset.wsElNodeEqID = Albany::WorksetConn(
+      "wsElNodeEqID", worksetSize, numNodes, neq);
+
+  double const separateTime =
+      timeEvaluation<EvalT>(separateFM, workset, numRepetitions);
+  double const fusedTime =
+      timeEvaluation<EvalT>(fusedFM, workset, numRepetitions);
+
+  // Compare the outputs
+  for (auto const& name : scalarNames) {
+    PHX::MDField<ScalarT, Cell, QuadPoint> a(name, dl->qp_scalar);
+    PHX::MDField<ScalarT, Cell, QuadPoint> b(name, dl->qp_scalar);
+    separateFM.getFieldData<EvalT>(a);
+    fusedFM.getFieldData<EvalT>(b);
+    PHX::MDField<ScalarT, Cell, QuadPoint, Dim> ga(
+        name + " Gradient", dl->qp_gradient);
+    PHX::MDField<ScalarT, Cell, QuadPoint, Dim> gb(
+        name + " Gradient", dl->qp_gradient);
+    separateFM.getFieldData<EvalT>(ga);
+    fusedFM.getFieldData<EvalT>(gb);
+    for (int cell = 0; cell < worksetSize; ++cell) {
+      for (int qp = 0; qp < numQPts; ++qp) {
+        TEST_ASSERT(near(a(cell, qp), b(cell, qp), tolerance));
+        for (int dim = 0; dim < numDim; ++dim) {
+          TEST_ASSERT(near(ga(cell, qp, dim), gb(cell, qp, dim), tolerance));
+        }
+      }
+    }
+  }
+  for (auto const& name : vectorNames) {
+    PHX::MDField<ScalarT, Cell, QuadPoint, VecDim> a(name, dl->qp_vector);
+    PHX::MDField<ScalarT, Cell, QuadPoint, VecDim> b(name, dl->qp_vector);
+    separateFM.getFieldData<EvalT>(a);
+    fusedFM.getFieldData<EvalT>(b);
+    PHX::MDField<ScalarT, Cell, QuadPoint, VecDim, Dim> ga(
+        name + " Gradient", dl->qp_vecgradient);
+    PHX::MDField<ScalarT, Cell, QuadPoint, VecDim, Dim> gb(
+        name + " Gradient", dl->qp_vecgradient);
+    separateFM.getFieldData<EvalT>(ga);
+    fusedFM.getFieldData<EvalT>(gb);
+    for (int cell = 0; cell < worksetSize; ++cell) {
+      for (int qp = 0; qp < numQPts; ++qp) {
+        for (int i = 0; i < numDim; ++i) {
+          TEST_ASSERT(near(a(cell, qp, i), b(cell, qp, i), tolerance));
+          for (int dim = 0; dim < numDim; ++dim) {
+            TEST_ASSERT(
+                near(ga(cell, qp, i, dim), gb(cell, qp, i, dim), tolerance));
+          }
+        }
+      }
+    }
+  }
+
+  double const numElements =
+      static_cast<double>(worksetSize) * numRepetitions;
+  out << elementName << " (" << PHX::print<EvalT>() << "): per-field "
+      << separateTime << " s (" << numElements / separateTime
+      << " elem/s), fused " << fusedTime << " s ("
+      << numElements / fusedTime << " elem/s), speedup "
+      << separateTime / fusedTime << "\n";
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, ResidualTri3)
+{
+  compareFusedInterpolation<Residual>(out, success, "Tri3", 3, 3, 2, false);
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, ResidualQuad4)
+{
+  compareFusedInterpolation<Residual>(out, success, "Quad4", 4, 4, 2, false);
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, ResidualTet4)
+{
+  compareFusedInterpolation<Residual>(out, success, "Tet4", 4, 4, 3, false);
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, ResidualHex8)
+{
+  compareFusedInterpolation<Residual>(out, success, "Hex8", 8, 8, 3, false);
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, JacobianQuad4)
+{
+  compareFusedInterpolation<Jacobian>(out, success, "Quad4", 4, 4, 2, false);
+}
+
+TEUCHOS_UNIT_TEST(DOFFusedInterpolation, JacobianHex8)
+{
+  compareFusedInterpolation<Jacobian>(out, success, "Hex8", 8, 8, 3, false);
+}
+
+TEUCHOS_UNIT_TEST(FastSolutionFusedInterpolation, JacobianQuad4)
+{
+  compareFusedInterpolation<Jacobian>(out, success, "Quad4", 4, 4, 2, true);
+}
+
+TEUCHOS_UNIT_TEST(FastSolutionFusedInterpolation, JacobianHex8)
+{
+  compareFusedInterpolation<Jacobian>(out, success, "Hex8", 8, 8, 3, true);
+}
+
+}  // namespace
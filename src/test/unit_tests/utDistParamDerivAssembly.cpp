@@ -0,0 +1,198 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <string>
+
+#include "Albany_Application.hpp"
+#include "Albany_CommUtils.hpp"
+#include "Albany_DistributedParameterDerivativeOp.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Thyra_MultiVectorStdOps.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+//
+// Steady 2D heat equation on a square, with the thermal conductivity
+// as distributed parameter.
+//
+RCP<Teuchos::ParameterList>
+heatWithDistributedConductivity()
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set<std::string>("Name", "Heat 2D");
+  problem.set<std::string>("Solution Method", "Steady");
+
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set<double>("DBC on NS NodeSet0 for DOF T", 1.0);
+  dbcs.set<double>("DBC on NS NodeSet1 for DOF T", 0.0);
+
+  Teuchos::ParameterList& dist = problem.sublist("Distributed Parameters");
+  dist.set<int>("Number of Parameter Vectors", 1);
+  dist.sublist("Distributed Parameter 0")
+      .set<std::string>("Name", "thermal_conductivity");
+
+  Teuchos::ParameterList& resp = problem.sublist("Response Functions");
+  resp.set<int>("Number", 1);
+  resp.set<std::string>("Response 0", "Solution Average");
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "STK2D");
+  disc.set<int>("1D Elements", 12);
+  disc.set<int>("2D Elements", 12);
+  // Several worksets per rank
+  disc.set<int>("Workset Size", 25);
+
+  return params;
+}
+
+double
+maxRelativeDifference(Thyra_MultiVector const& a, Thyra_MultiVector const& b)
+{
+  double diff = 0.0;
+  for (int col = 0; col < a.domain()->dim(); ++col) {
+    RCP<Thyra_Vector> d = a.col(col)->clone_v();
+    Thyra::Vp_StV(d.ptr(), -1.0, *b.col(col));
+    double const scale = std::max(1.0, Thyra::norm_inf(*b.col(col)));
+    diff = std::max(diff, Thyra::norm_inf(*d) / scale);
+  }
+  return diff;
+}
+
+//
+// Exposes the assembled df/dp.
+//
+class AssembledDerivativeOp : public Albany::DistributedParameterDerivativeOp
+{
+ public:
+  AssembledDerivativeOp(
+      RCP<Albany::Application> const& app,
+      std::string const&              name)
+      : Albany::DistributedParameterDerivativeOp(app, name, true)
+  {
+  }
+
+  RCP<Thyra_LinearOp>
+  assembledOp() const
+  {
+    return dfdp;
+  }
+};
+
+//
+// The assembled df/dp must give the same products (and transposed
+// products) as the matrix-free evaluation, applied twice to go through the
+// reuse as well.
+//
+void
+checkProducts(
+    Teuchos::FancyOStream&                          out,
+    bool&                                           success,
+    RCP<Albany::Application> const&                 app,
+    std::string const&                              param_name,
+    Albany::DistributedParameterDerivativeOp const& matrix_free,
+    Albany::DistributedParameterDerivativeOp const& assembled)
+{
+  double const tolerance = 1.0e-12;
+  int const    num_cols  = 3;
+
+  auto param = app->getDistributedParameterLibrary()->get(param_name);
+
+  RCP<Thyra_MultiVector> V =
+      Thyra::createMembers(param->vector_space(), num_cols);
+  RCP<Thyra_MultiVector> W =
+      Thyra::createMembers(app->getVectorSpace(), num_cols);
+  Thyra::randomize(-1.0, 1.0, V.ptr());
+  Thyra::randomize(-1.0, 1.0, W.ptr());
+
+  for (int rep = 0; rep < 2; ++rep) {
+    RCP<Thyra_MultiVector> fpV_mf =
+        Thyra::createMembers(app->getVectorSpace(), num_cols);
+    RCP<Thyra_MultiVector> fpV_as =
+        Thyra::createMembers(app->getVectorSpace(), num_cols);
+    matrix_free.apply(Thyra::NOTRANS, *V, fpV_mf.ptr(), 1.0, 0.0);
+    assembled.apply(Thyra::NOTRANS, *V, fpV_as.ptr(), 1.0, 0.0);
+    TEST_ASSERT(Thyra::norm_inf(*fpV_mf->col(0)) > 0.0);
+    TEST_COMPARE(maxRelativeDifference(*fpV_as, *fpV_mf), <=, tolerance);
+
+    RCP<Thyra_MultiVector> fpW_mf =
+        Thyra::createMembers(param->vector_space(), num_cols);
+    RCP<Thyra_MultiVector> fpW_as =
+        Thyra::createMembers(param->vector_space(), num_cols);
+    matrix_free.apply(Thyra::TRANS, *W, fpW_mf.ptr(), 1.0, 0.0);
+    assembled.apply(Thyra::TRANS, *W, fpW_as.ptr(), 1.0, 0.0);
+    TEST_ASSERT(Thyra::norm_inf(*fpW_mf->col(0)) > 0.0);
+    TEST_COMPARE(maxRelativeDifference(*fpW_as, *fpW_mf), <=, tolerance);
+  }
+}
+
+//
+// The assembled df/dp must match the matrix-free one, also after the
+// linearization point moves and after a mesh update, which must rebuild the
+// assembled operator on the new discretization.
+//
+TEUCHOS_UNIT_TEST(DistParamDerivAssembly, MatchesMatrixFree)
+{
+  std::string const param_name = "thermal_conductivity";
+
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+
+  RCP<Albany::Application> app = rcp(
+      new Albany::Application(comm, heatWithDistributedConductivity()));
+
+  auto param =
+      app->getDistributedParameterLibrary()->get(param_name);
+  Thyra::randomize(1.0, 2.0, param->vector().ptr());
+  param->scatter();
+
+  RCP<Thyra_Vector> x = Thyra::createMember(app->getVectorSpace());
+  Thyra::randomize(-1.0, 1.0, x.ptr());
+
+  RCP<Teuchos::Array<ParamVec>> scalar_params =
+      rcp(new Teuchos::Array<ParamVec>());
+
+  Albany::DistributedParameterDerivativeOp matrix_free(app, param_name, false);
+  AssembledDerivativeOp                    assembled(app, param_name);
+
+  for (int point = 0; point < 2; ++point) {
+    matrix_free.set(0.0, x, Teuchos::null, Teuchos::null, scalar_params);
+    assembled.set(0.0, x, Teuchos::null, Teuchos::null, scalar_params);
+    checkProducts(out, success, app, param_name, matrix_free, assembled);
+
+    // Move the linearization point: the assembled df/dp must be refreshed
+    Thyra::randomize(-1.0, 1.0, x.ptr());
+  }
+
+  RCP<Thyra_LinearOp> const old_dfdp = assembled.assembledOp();
+  TEST_ASSERT(old_dfdp.get() != nullptr);
+
+  // Rebuild the discretization data, as the mesh adapters do
+  auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(
+      app->getDiscretization(), true);
+  stk_disc->updateMesh();
+  app->getStateMgr().updateStateArrayHandles();
+
+  x = Thyra::createMember(app->getVectorSpace());
+  Thyra::randomize(-1.0, 1.0, x.ptr());
+  matrix_free.set(0.0, x, Teuchos::null, Teuchos::null, scalar_params);
+  assembled.set(0.0, x, Teuchos::null, Teuchos::null, scalar_params);
+  checkProducts(out, success, app, param_name, matrix_free, assembled);
+
+  TEST_ASSERT(assembled.assembledOp().get() != nullptr);
+  TEST_INEQUALITY(assembled.assembledOp().get(), old_dfdp.get());
+}
+
+}  // namespace
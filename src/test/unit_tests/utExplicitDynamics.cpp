@@ -0,0 +1,162 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include <cmath>
+#include <string>
+
+#include "Albany_Application.hpp"
+#include "Albany_CommUtils.hpp"
+#include "Albany_StateManager.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+double const density         = 2.0;
+double const elastic_modulus = 1000.0;
+double const poissons_ratio  = 0.25;
+int const    num_elems       = 2;
+
+//
+// Material database for the single block of the STK box, with the
+// analytic mass (lumped or not) and the stable time step.
+//
+std::string
+writeMaterials(bool const lump_mass)
+{
+  std::string const filename = lump_mass ? "utExplicitDynamicsLumped.xml"
+                                         : "utExplicitDynamicsConsistent.xml";
+
+  Teuchos::ParameterList materials("Materials Database");
+
+  Teuchos::ParameterList& block =
+      materials.sublist("ElementBlocks").sublist("Block0");
+  block.set<std::string>("material", "Elastic Solid");
+  block.set<bool>("Use Analytic Mass", true);
+  block.set<bool>("Lump Analytic Mass", lump_mass);
+  block.set<bool>("Compute Stable Time Step", true);
+
+  Teuchos::ParameterList& solid =
+      materials.sublist("Materials").sublist("Elastic Solid");
+  solid.set<double>("Density", density);
+  solid.sublist("Material Model").set<std::string>("Model Name", "Neohookean");
+  Teuchos::ParameterList& E = solid.sublist("Elastic Modulus");
+  E.set<std::string>("Elastic Modulus Type", "Constant");
+  E.set<double>("Value", elastic_modulus);
+  Teuchos::ParameterList& nu = solid.sublist("Poissons Ratio");
+  nu.set<std::string>("Poissons Ratio Type", "Constant");
+  nu.set<double>("Value", poissons_ratio);
+
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+  if (comm->getRank() == 0) {
+    Teuchos::writeParameterListToXmlFile(materials, filename);
+  }
+  comm->barrier();
+
+  return filename;
+}
+
+//
+// Mechanics on the unit cube, set up for explicit dynamics.
+//
+RCP<Teuchos::ParameterList>
+explicitMechanics(bool const lump_mass)
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set<std::string>("Name", "Mechanics 3D");
+  problem.set<std::string>("Solution Method", "Steady");
+  problem.set<std::string>("MaterialDB Filename", writeMaterials(lump_mass));
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "STK3D");
+  disc.set<int>("1D Elements", num_elems);
+  disc.set<int>("2D Elements", num_elems);
+  disc.set<int>("3D Elements", num_elems);
+  disc.set<int>("Number Of Time Derivatives", 2);
+  disc.set<bool>("Explicit Dynamics", true);
+
+  return params;
+}
+
+TEUCHOS_UNIT_TEST(ExplicitDynamics, RequiresLumpedMass)
+{
+  TEST_THROW(
+      Albany::Application(Albany::getDefaultComm(), explicitMechanics(false)),
+      std::logic_error);
+}
+
+//
+// With alpha = beta = 0 and omega = 1 the Jacobian is the mass matrix,
+// which must be diagonal and add up to rho * V per displacement
+// component. The stable time step of the cubes is h / c, with c the
+// dilatational wave speed.
+//
+TEUCHOS_UNIT_TEST(ExplicitDynamics, LumpedMassAndStableTimeStep)
+{
+  double const tolerance = 1.0e-12;
+  int const    num_dims  = 3;
+
+  RCP<Albany::Application> app = rcp(
+      new Albany::Application(Albany::getDefaultComm(), explicitMechanics(true)));
+
+  auto const x_space = app->getVectorSpace();
+
+  RCP<Thyra_Vector> x = Thyra::createMember(x_space);
+  x->assign(0.0);
+  RCP<Thyra_Vector> xdot = Thyra::createMember(x_space);
+  xdot->assign(0.0);
+  RCP<Thyra_Vector> xdotdot = Thyra::createMember(x_space);
+  xdotdot->assign(0.0);
+  Teuchos::Array<ParamVec> p;
+
+  RCP<Thyra_Vector>   f   = Thyra::createMember(x_space);
+  RCP<Thyra_LinearOp> jac = app->createJacobianOp();
+  app->computeGlobalJacobian(0.0, 0.0, 1.0, 0.0, x, xdot, xdotdot, p, f, jac);
+
+  RCP<Thyra_Vector> diag = Thyra::createMember(x_space);
+  Albany::getDiagonalCopy(jac, diag);
+  TEST_FLOATING_EQUALITY(
+      Thyra::sum(*diag), num_dims * density * 1.0, tolerance);
+  TEST_COMPARE(Thyra::min(*diag), >, 0.0);
+
+  // No off-diagonal entries: the row sums are the diagonal
+  RCP<Thyra_Vector> ones = Thyra::createMember(x_space);
+  ones->assign(1.0);
+  RCP<Thyra_Vector> row_sums = Thyra::createMember(x_space);
+  jac->apply(Thyra::NOTRANS, *ones, row_sums.ptr(), 1.0, 0.0);
+  Thyra::Vp_StV(row_sums.ptr(), -1.0, *diag);
+  TEST_COMPARE(Thyra::norm_inf(*row_sums), <=, tolerance * Thyra::max(*diag));
+
+  // The stable time step is saved by the residual evaluation
+  app->computeGlobalResidual(0.0, x, xdot, xdotdot, p, f);
+
+  double const h  = 1.0 / num_elems;
+  double const nu = poissons_ratio;
+  double const M =
+      elastic_modulus * (1.0 - nu) / ((1.0 + nu) * (1.0 - 2.0 * nu));
+  double const expected_dt = h / std::sqrt(M / density);
+
+  Albany::StateArrayVec& esa = app->getStateMgr().getStateArrays().elemStateArrays;
+  for (std::size_t ws = 0; ws < esa.size(); ++ws) {
+    Albany::MDArray const& stable_dt = esa[ws]["Stable Time Step"];
+    for (int i = 0; i < stable_dt.size(); ++i) {
+      TEST_FLOATING_EQUALITY(stable_dt[i], expected_dt, tolerance);
+    }
+  }
+}
+
+}  // namespace
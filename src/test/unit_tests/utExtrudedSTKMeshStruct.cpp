@@ -0,0 +1,190 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/GetEntities.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include "Albany_AbstractSTKMeshStruct.hpp"
+#include "Albany_CommUtils.hpp"
+#include "Albany_DiscretizationFactory.hpp"
+#include "Albany_StateInfoStruct.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const    num_elems_1d = 4;
+int const    num_layers   = 3;
+int const    vec_dim      = 2;
+double const friction[]   = {1.5, -2.5};
+
+std::string const field_name = "friction_vector";
+
+void
+addNodeScalar(Teuchos::ParameterList& fields, int const i,
+              std::string const& name, double const value)
+{
+  Teuchos::ParameterList& field = fields.sublist("Field " + std::to_string(i));
+  field.set<std::string>("Field Name", name);
+  field.set<std::string>("Field Type", "Node Scalar");
+  field.set<std::string>("Field Origin", "File");
+  field.set<double>("Field Value", value);
+}
+
+//
+// Unit square of triangles, extruded in a slab of unit thickness, with a
+// constant basal vector cell field to extrude.
+//
+RCP<Teuchos::ParameterList>
+extrudedSquare(std::string const& shape, bool const columnwise)
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "Extruded");
+  disc.set<std::string>("Element Shape", shape);
+  disc.set<int>("NumLayers", num_layers);
+  disc.set<bool>("Columnwise Ordering", columnwise);
+  disc.set<Teuchos::Array<std::string>>(
+      "Extrude Basal Elem Fields", Teuchos::Array<std::string>(1, field_name));
+  disc.set<Teuchos::Array<int>>(
+      "Basal Elem Fields Ranks", Teuchos::Array<int>(1, 2));
+
+  Teuchos::ParameterList& ssd = disc.sublist("Side Set Discretizations");
+  ssd.set<Teuchos::Array<std::string>>(
+      "Side Sets", Teuchos::Array<std::string>(1, "basalside"));
+  Teuchos::ParameterList& basal = ssd.sublist("basalside");
+  basal.set<std::string>("Method", "STK2D");
+  basal.set<std::string>("Cell Topology", "Triangle");
+  basal.set<int>("1D Elements", num_elems_1d);
+  basal.set<int>("2D Elements", num_elems_1d);
+
+  Teuchos::ParameterList& fields = basal.sublist("Required Fields Info");
+  fields.set<int>("Number Of Fields", 3);
+  addNodeScalar(fields, 0, "thickness", 1.0);
+  addNodeScalar(fields, 1, "surface_height", 1.0);
+  Teuchos::ParameterList& vec = fields.sublist("Field 2");
+  vec.set<std::string>("Field Name", field_name);
+  vec.set<std::string>("Field Type", "Elem Vector");
+  vec.set<std::string>("Field Origin", "File");
+  vec.set<Teuchos::Array<double>>(
+      "Field Value", Teuchos::Array<double>(friction, friction + vec_dim));
+
+  return params;
+}
+
+RCP<Albany::StateInfoStruct>
+vectorCellState()
+{
+  RCP<Albany::StateInfoStruct> sis = rcp(new Albany::StateInfoStruct());
+  sis->createNodalDataBase();
+
+  Albany::StateStruct::FieldDims dims(2);
+  dims[0] = 1;
+  dims[1] = vec_dim;
+  sis->push_back(rcp(new Albany::StateStruct(
+      field_name, Albany::StateStruct::ElemData, dims, "scalar")));
+  return sis;
+}
+
+//
+// Every 3D element must get the values of its basal cell. The tetrahedra
+// used to be looked up by id from the id of their prism, which only holds
+// for the first layer: the other tetrahedra kept a zero field.
+//
+void
+checkExtrusion(
+    Teuchos::FancyOStream& out,
+    bool&                  success,
+    std::string const&     shape,
+    bool const             columnwise)
+{
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+
+  Albany::DiscretizationFactory factory(
+      extrudedSquare(shape, columnwise), comm);
+  factory.createMeshSpecs();
+
+  RCP<Albany::StateInfoStruct> basal_sis = vectorCellState();
+  Albany::StateStruct::FieldDims node_dims(2);
+  node_dims[0] = 1;
+  node_dims[1] = 3;
+  for (std::string const& name : {"thickness", "surface_height"}) {
+    basal_sis->push_back(rcp(new Albany::StateStruct(
+        name, Albany::StateStruct::NodalDataToElemNode, node_dims, "scalar")));
+  }
+  std::map<std::string, RCP<Albany::StateInfoStruct>> side_set_sis;
+  side_set_sis["basalside"] = basal_sis;
+
+  Albany::AbstractFieldContainer::FieldContainerRequirements req;
+  std::map<std::string,
+           Albany::AbstractFieldContainer::FieldContainerRequirements>
+      side_set_req;
+  factory.setupInternalMeshStruct(
+      1, vectorCellState(), side_set_sis, req, side_set_req);
+
+  RCP<Albany::AbstractSTKMeshStruct> mesh =
+      Teuchos::rcp_dynamic_cast<Albany::AbstractSTKMeshStruct>(
+          factory.getMeshStruct(), true);
+
+  typedef Albany::AbstractSTKFieldContainer::VectorFieldType VFT;
+  VFT const* field = mesh->metaData->get_field<VFT>(
+      stk::topology::ELEMENT_RANK, field_name);
+  TEST_ASSERT(field != nullptr);
+  if (field == nullptr) return;
+
+  std::vector<stk::mesh::Entity> elems;
+  stk::mesh::get_selected_entities(
+      stk::mesh::Selector(mesh->metaData->locally_owned_part()),
+      mesh->bulkData->buckets(stk::topology::ELEMENT_RANK),
+      elems);
+
+  int num_wrong = 0;
+  for (stk::mesh::Entity const elem : elems) {
+    double const* values = stk::mesh::field_data(*field, elem);
+    for (int j = 0; j < vec_dim; ++j) {
+      if (values[j] != friction[j]) ++num_wrong;
+    }
+  }
+  TEST_EQUALITY(num_wrong, 0);
+
+  int const num_local = elems.size();
+  int       num_global = 0;
+  Teuchos::reduceAll(
+      *comm, Teuchos::REDUCE_SUM, num_local, Teuchos::outArg(num_global));
+  int const num_sub = shape == "Tetrahedron" ? 3 : 1;
+  TEST_EQUALITY(
+      num_global, num_sub * num_layers * 2 * num_elems_1d * num_elems_1d);
+}
+
+TEUCHOS_UNIT_TEST(ExtrudedSTKMeshStruct, TetrahedraLayerOrdering)
+{
+  checkExtrusion(out, success, "Tetrahedron", false);
+}
+
+TEUCHOS_UNIT_TEST(ExtrudedSTKMeshStruct, TetrahedraColumnOrdering)
+{
+  checkExtrusion(out, success, "Tetrahedron", true);
+}
+
+TEUCHOS_UNIT_TEST(ExtrudedSTKMeshStruct, Wedges)
+{
+  checkExtrusion(out, success, "Wedge", false);
+}
+
+}  // namespace
@@ -0,0 +1,149 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <string>
+
+#include "AAdapt_AdaptiveSolutionManager.hpp"
+#include "Albany_Application.hpp"
+#include "Albany_CommUtils.hpp"
+#include "Albany_ModelEvaluator.hpp"
+#include "Thyra_MultiVectorStdOps.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+//
+// Steady 2D heat equation on a square, whose residual is linear in the
+// solution, with the two norm of the solution as response.
+//
+RCP<Teuchos::ParameterList>
+heatWithTwoNorm(bool const hess_vec_prods)
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set<std::string>("Name", "Heat 2D");
+  problem.set<std::string>("Solution Method", "Steady");
+  problem.set<bool>("Hessian-Vector Products", hess_vec_prods);
+
+  Teuchos::ParameterList& dbcs = problem.sublist("Dirichlet BCs");
+  dbcs.set<double>("DBC on NS NodeSet0 for DOF T", 1.0);
+  dbcs.set<double>("DBC on NS NodeSet1 for DOF T", 0.0);
+
+  Teuchos::ParameterList& resp = problem.sublist("Response Functions");
+  resp.set<int>("Number", 1);
+  resp.set<std::string>("Response 0", "Solution Two Norm");
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "STK2D");
+  disc.set<int>("1D Elements", 8);
+  disc.set<int>("2D Elements", 8);
+
+  return params;
+}
+
+TEUCHOS_UNIT_TEST(HessianVecProducts, NotAdvertisedByDefault)
+{
+  RCP<Teuchos::ParameterList> params = heatWithTwoNorm(false);
+  RCP<Albany::Application>    app =
+      rcp(new Albany::Application(Albany::getDefaultComm(), params));
+  Albany::ModelEvaluator model(app, params);
+
+  Thyra_OutArgs const outArgs = model.createOutArgs();
+  TEST_ASSERT(
+      !outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_f_xx));
+  TEST_ASSERT(
+      !outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_g_xx, 0));
+}
+
+//
+// For g(x) = |x|, the Hessian is (I - u u^T) / |x|, with u = x / |x|;
+// the residual is linear, so its Hessian is zero. The products are
+// differences of first derivatives, hence the tolerance.
+//
+TEUCHOS_UNIT_TEST(HessianVecProducts, MatchAnalyticHessian)
+{
+  double const tolerance = 1.0e-5;
+  int const    num_dirs  = 3;
+  double const g_mult    = 2.0;
+
+  RCP<Teuchos::ParameterList> params = heatWithTwoNorm(true);
+  RCP<Albany::Application>    app =
+      rcp(new Albany::Application(Albany::getDefaultComm(), params));
+  RCP<Albany::ModelEvaluator> model =
+      rcp(new Albany::ModelEvaluator(app, params));
+
+  Thyra_OutArgs outArgs = model->createOutArgs();
+  TEST_ASSERT(
+      outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_f_xx));
+  TEST_ASSERT(
+      outArgs.supports(Thyra_ModelEvaluator::OUT_ARG_hess_vec_prod_g_xx, 0));
+
+  auto const x_space = model->get_x_space();
+
+  RCP<Thyra_Vector> x = Thyra::createMember(x_space);
+  Thyra::randomize(1.0, 2.0, x.ptr());
+  RCP<Thyra_MultiVector> V = Thyra::createMembers(x_space, num_dirs);
+  Thyra::randomize(-1.0, 1.0, V.ptr());
+  RCP<Thyra_MultiVector> z = Thyra::createMembers(x_space, 1);
+  Thyra::randomize(-1.0, 1.0, z.ptr());
+  RCP<Thyra_MultiVector> w = Thyra::createMembers(model->get_g_space(0), 1);
+  w->assign(g_mult);
+
+  // Residual at x, to know the state the application should be left in
+  {
+    Thyra_InArgs inArgs = model->createInArgs();
+    inArgs.set_x(x);
+    Thyra_OutArgs resArgs = model->createOutArgs();
+    resArgs.set_f(Thyra::createMember(model->get_f_space()));
+    model->evalModel(inArgs, resArgs);
+  }
+  RCP<Thyra_Vector> const overlapped_x =
+      app->getAdaptSolMgr()->getOverlappedSolution()->col(0)->clone_v();
+
+  RCP<Thyra_MultiVector> Hf = Thyra::createMembers(x_space, num_dirs);
+  RCP<Thyra_MultiVector> Hg = Thyra::createMembers(x_space, num_dirs);
+  Thyra_InArgs inArgs = model->createInArgs();
+  inArgs.set_x(x);
+  inArgs.set_x_direction(V);
+  inArgs.set_f_multiplier(z);
+  inArgs.set_g_multiplier(0, w);
+  outArgs.set_hess_vec_prod_f_xx(Hf);
+  outArgs.set_hess_vec_prod_g_xx(0, Hg);
+  model->evalModel(inArgs, outArgs);
+
+  double const x_norm = Thyra::norm_2(*x);
+  for (int k = 0; k < num_dirs; ++k) {
+    TEST_COMPARE(Thyra::norm_inf(*Hf->col(k)), <=, tolerance);
+
+    // g_mult (v - u (u.v)) / |x|
+    RCP<Thyra_Vector> expected = V->col(k)->clone_v();
+    double const      x_dot_v  = Thyra::dot(*x, *V->col(k));
+    Thyra::Vp_StV(expected.ptr(), -x_dot_v / (x_norm * x_norm), *x);
+    Thyra::Vt_S(expected.ptr(), g_mult / x_norm);
+
+    RCP<Thyra_Vector> diff = Hg->col(k)->clone_v();
+    Thyra::Vp_StV(diff.ptr(), -1.0, *expected);
+    TEST_COMPARE(
+        Thyra::norm_inf(*diff), <=, tolerance * Thyra::norm_inf(*expected));
+  }
+
+  // The application is back at x, not at a perturbed point
+  RCP<Thyra_Vector> diff_x =
+      app->getAdaptSolMgr()->getOverlappedSolution()->col(0)->clone_v();
+  Thyra::Vp_StV(diff_x.ptr(), -1.0, *overlapped_x);
+  TEST_EQUALITY(Thyra::norm_inf(*diff_x), 0.0);
+}
+
+}  // namespace
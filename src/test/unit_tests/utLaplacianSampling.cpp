@@ -0,0 +1,163 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_SolverFactory.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "LandIce_BatchedLaplacianSampler.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const num_samples = 5;
+
+//
+// Laplacian prior on a square, with a Dirichlet condition on one side,
+// sampled in blocks with a tight Krylov solve.
+//
+RCP<Teuchos::ParameterList>
+batchedSampling(int const block_size)
+{
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+
+  Teuchos::ParameterList& problem = params->sublist("Problem");
+  problem.set<std::string>("Name", "LandIce Laplacian Sampling");
+  problem.set<std::string>("Solution Method", "Steady");
+  problem.sublist("Dirichlet BCs")
+      .set<double>("DBC on NS NodeSet0 for DOF prior_sample", 0.5);
+  Teuchos::ParameterList& reg =
+      problem.sublist("LandIce Laplacian Regularization");
+  reg.set<double>("Mass Coefficient", 1.0);
+  reg.set<double>("Laplacian Coefficient", 0.1);
+
+  Teuchos::ParameterList& sampling = problem.sublist("Batched Sampling");
+  sampling.set<int>("Number Of Samples", num_samples);
+  sampling.set<int>("Block Size", block_size);
+  sampling.set<int>("Random Seed", 17);
+  sampling.set<bool>("Write Samples", false);
+  sampling.set<bool>("Keep Samples", true);
+
+  Teuchos::ParameterList& disc = params->sublist("Discretization");
+  disc.set<std::string>("Method", "STK2D");
+  disc.set<int>("1D Elements", 10);
+  disc.set<int>("2D Elements", 10);
+
+  Teuchos::ParameterList& strat = params->sublist("Piro")
+                                      .sublist("NOX")
+                                      .sublist("Direction")
+                                      .sublist("Newton")
+                                      .sublist("Stratimikos Linear Solver")
+                                      .sublist("Stratimikos");
+  strat.set<std::string>("Linear Solver Type", "Belos");
+  strat.set<std::string>("Preconditioner Type", "Ifpack2");
+  Teuchos::ParameterList& belos =
+      strat.sublist("Linear Solver Types").sublist("Belos");
+  belos.set<std::string>("Solver Type", "Block GMRES");
+  Teuchos::ParameterList& gmres =
+      belos.sublist("Solver Types").sublist("Block GMRES");
+  gmres.set<double>("Convergence Tolerance", 1.0e-13);
+  gmres.set<int>("Maximum Iterations", 500);
+  gmres.set<int>("Num Blocks", 500);
+
+  return params;
+}
+
+RCP<Thyra_MultiVector const>
+drawSamples(RCP<Teuchos_Comm const> const& comm, int const block_size)
+{
+  Albany::SolverFactory           factory(batchedSampling(block_size), comm);
+  RCP<Albany::Application>        app;
+  RCP<Thyra_ModelEvaluator> const solver =
+      factory.createAndGetAlbanyApp(app, comm, comm);
+
+  LandIce::BatchedLaplacianSampler& sampler =
+      dynamic_cast<LandIce::BatchedLaplacianSampler&>(*solver);
+  sampler.evalModel(sampler.createInArgs(), sampler.createOutArgs());
+  return sampler.getSamples();
+}
+
+//
+// Functionals of a sample that do not depend on how the dofs are
+// distributed: the norm, the sum, and the product with a field of the
+// global dof ids.
+//
+std::vector<double>
+invariants(Thyra_Vector const& x)
+{
+  RCP<Thyra_Vector> g = Thyra::createMember(x.space());
+  {
+    Teuchos::Array<GO> const gids = Albany::getGlobalElements(x.space());
+    auto                     g_data = Albany::getNonconstLocalData(g);
+    for (int lid = 0; lid < gids.size(); ++lid) {
+      g_data[lid] = std::cos(static_cast<double>(gids[lid]));
+    }
+  }
+  return {Thyra::norm_2(x), Thyra::sum(x), Thyra::dot(x, *g)};
+}
+
+//
+// The block of samples must be the solutions of one sample at a time,
+// with the last block shorter than the others.
+//
+TEUCHOS_UNIT_TEST(LaplacianSampling, BlockSolveMatchesSingleSolves)
+{
+  double const tolerance = 1.0e-9;
+
+  RCP<Teuchos_Comm const>            comm    = Albany::getDefaultComm();
+  RCP<Thyra_MultiVector const> const single  = drawSamples(comm, 1);
+  RCP<Thyra_MultiVector const> const blocked = drawSamples(comm, 3);
+
+  TEST_EQUALITY(single->domain()->dim(), num_samples);
+  TEST_EQUALITY(blocked->domain()->dim(), num_samples);
+  for (int k = 0; k < num_samples; ++k) {
+    RCP<Thyra_Vector> diff = blocked->col(k)->clone_v();
+    Thyra::Vp_StV(diff.ptr(), -1.0, *single->col(k));
+    double const scale = Thyra::norm_inf(*single->col(k));
+    TEST_COMPARE(Thyra::norm_inf(*diff), <=, tolerance * scale);
+  }
+
+  // Different samples see different noise
+  RCP<Thyra_Vector> diff = single->col(1)->clone_v();
+  Thyra::Vp_StV(diff.ptr(), -1.0, *single->col(0));
+  TEST_COMPARE(Thyra::norm_inf(*diff), >, 0.0);
+}
+
+//
+// Each rank also draws the samples alone: they must be the same as the
+// ones drawn on all the ranks.
+//
+TEUCHOS_UNIT_TEST(LaplacianSampling, IndependentOfRankCount)
+{
+  double const tolerance = 1.0e-9;
+
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+  RCP<Teuchos_Comm const> self = comm->split(comm->getRank(), 0);
+
+  RCP<Thyra_MultiVector const> const distributed = drawSamples(comm, 2);
+  RCP<Thyra_MultiVector const> const serial      = drawSamples(self, 2);
+
+  for (int k = 0; k < num_samples; ++k) {
+    std::vector<double> const expected = invariants(*serial->col(k));
+    std::vector<double> const actual   = invariants(*distributed->col(k));
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      TEST_FLOATING_EQUALITY(actual[i], expected[i], tolerance);
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,235 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ATO_OptInterface.hpp"
+#include "ATO_Optimizer.hpp"
+#include "Albany_CommUtils.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const    num_dofs       = 40;
+double const target         = 0.4;
+double const conv_tolerance = 1.0e-4;
+
+//
+// Measure sum_i w_i p_i, with element volumes w_i and compliance
+// sensitivities -c_i that vary over the dofs.
+//
+class VolumeInterface : public ATO::OptInterface
+{
+ public:
+  VolumeInterface(RCP<Teuchos_Comm const> const& comm_) : comm(comm_)
+  {
+    for (int i = 0; i < num_dofs; ++i) {
+      double const gid = comm->getRank() * num_dofs + i;
+      w.push_back(1.0 + 0.5 * std::sin(1.3 * gid));
+      c.push_back(1.0 + 0.9 * std::pow(std::cos(0.7 * gid), 2));
+    }
+  }
+
+  void
+  Compute(const double* p, double& g, double* dgdp, double& c_, double*)
+  {
+    g  = 0.0;
+    c_ = 0.0;
+    for (int i = 0; i < num_dofs; ++i) {
+      g += c[i] * (1.0 - p[i]);
+      if (dgdp != nullptr) dgdp[i] = -c[i];
+    }
+  }
+
+  void
+  ComputeMeasure(const std::string&, double& measure)
+  {
+    measure = sum(w.data(), nullptr);
+  }
+
+  void
+  ComputeMeasure(
+      const std::string&,
+      const double* p,
+      double&       measure,
+      double*       dmdp,
+      const std::string&)
+  {
+    measure = sum(w.data(), p);
+    if (dmdp != nullptr) std::copy(w.begin(), w.end(), dmdp);
+  }
+
+  void
+  ComputeMeasures(
+      const std::string&,
+      const std::vector<const double*>& ps,
+      std::vector<double>&              measures,
+      const std::string&)
+  {
+    measures.resize(ps.size());
+    for (std::size_t k = 0; k < ps.size(); ++k) {
+      measures[k] = sum(w.data(), ps[k]);
+    }
+  }
+
+  void
+  InitializeOptDofs(double* p)
+  {
+    std::fill_n(p, num_dofs, 0.5);
+  }
+  void
+  getOptDofsLowerBound(Teuchos::Array<double>& b) const
+  {
+    b.assign(num_dofs, 0.0);
+  }
+  void
+  getOptDofsUpperBound(Teuchos::Array<double>& b) const
+  {
+    b.assign(num_dofs, 1.0);
+  }
+  int
+  GetNumOptDofs() const
+  {
+    return num_dofs;
+  }
+
+  void
+  Compute(double* p, double& g, double* dgdp, double& c_, double* dcdp)
+  {
+    Compute(const_cast<const double*>(p), g, dgdp, c_, dcdp);
+  }
+  void
+  ComputeConstraint(double*, double& c_, double*)
+  {
+    c_ = 0.0;
+  }
+  void
+  ComputeObjective(double* p, double& g, double* dgdp)
+  {
+    double c_;
+    Compute(const_cast<const double*>(p), g, dgdp, c_, nullptr);
+  }
+  void
+  ComputeObjective(const double* p, double& g, double* dgdp)
+  {
+    double c_;
+    Compute(p, g, dgdp, c_, nullptr);
+  }
+  void
+  ComputeVolume(double*, const double*, double& v, double, double)
+  {
+    v = 0.0;
+  }
+
+ private:
+  double
+  sum(const double* a, const double* b) const
+  {
+    double local = 0.0;
+    for (int i = 0; i < num_dofs; ++i) local += a[i] * (b ? b[i] : 1.0);
+    double global = 0.0;
+    Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &local, &global);
+    return global;
+  }
+
+  RCP<Teuchos_Comm const> comm;
+  std::vector<double>     w, c;
+};
+
+//
+// Runs the first topology update, which enforces the measure constraint.
+//
+class MeasureSearch : public ATO::Optimizer_OC
+{
+ public:
+  MeasureSearch(
+      Teuchos::ParameterList const&  params,
+      VolumeInterface&               iface,
+      RCP<Teuchos_Comm const> const& comm_)
+      : ATO::Optimizer_OC(params)
+  {
+    solverInterface = &iface;
+    comm            = comm_;
+    Initialize();
+  }
+
+  double
+  multiplier() const
+  {
+    return _multiplier;
+  }
+  int
+  measurePasses() const
+  {
+    return _measurePasses;
+  }
+  double
+  volumeFraction(VolumeInterface& iface)
+  {
+    double measure = 0.0;
+    iface.ComputeMeasure(_measureType, p, measure, nullptr, _measureIntMethod);
+    return measure / _optMeasure;
+  }
+};
+
+Teuchos::ParameterList
+ocParams(int const candidates)
+{
+  Teuchos::ParameterList params("Optimizer");
+  params.set<std::string>("Package", "OC");
+  params.set<double>("Move Limiter", 0.2);
+  params.set<double>("Stabilization Parameter", 0.5);
+  params.sublist("Convergence Tests").set<int>("Maximum Iterations", 10);
+
+  Teuchos::ParameterList& measure = params.sublist("Measure Enforcement");
+  measure.set<std::string>("Measure", "Volume");
+  measure.set<double>("Target", target);
+  measure.set<double>("Convergence Tolerance", conv_tolerance);
+  measure.set<int>("Maximum Iterations", 100);
+  measure.set<int>("Candidates Per Pass", candidates);
+  return params;
+}
+
+//
+// The batched search must find the multiplier and volume fraction of the
+// one-candidate bisection/Newton search, within the measure tolerance,
+// in about three passes.
+//
+TEUCHOS_UNIT_TEST(OCMeasureSearch, BatchedMatchesSequential)
+{
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+
+  VolumeInterface sequential_iface(comm);
+  MeasureSearch   sequential(ocParams(1), sequential_iface, comm);
+  VolumeInterface batched_iface(comm);
+  MeasureSearch   batched(ocParams(16), batched_iface, comm);
+
+  // The volume fraction varies like the multiplier to the power -1/2
+  double const lambda_tolerance = 10.0 * conv_tolerance / target;
+  TEST_FLOATING_EQUALITY(
+      batched.multiplier(), sequential.multiplier(), lambda_tolerance);
+  TEST_COMPARE(
+      std::abs(sequential.volumeFraction(sequential_iface) - target), <=,
+      conv_tolerance);
+  TEST_COMPARE(
+      std::abs(batched.volumeFraction(batched_iface) - target), <=,
+      conv_tolerance);
+
+  TEST_COMPARE(batched.measurePasses(), <=, 3);
+  TEST_COMPARE(batched.measurePasses(), <, sequential.measurePasses());
+}
+
+}  // namespace
@@ -0,0 +1,161 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <PCU.h>
+#include <apf.h>
+#include <apfBox.h>
+#include <apfMDS.h>
+#include <apfMesh2.h>
+
+#include "PathSizeField.hpp"
+
+namespace {
+
+typedef std::map<apf::MeshEntity*, double> VertexValues;
+
+//
+// A unit cube of tets, with a size field that differs at every vertex.
+//
+apf::Mesh2*
+makeCube(apf::Field*& size_field)
+{
+  if (!PCU_Comm_Initialized()) PCU_Comm_Init();
+  apf::Mesh2* mesh = apf::makeMdsBox(4, 4, 4, 1.0, 1.0, 1.0, true);
+  size_field       = apf::createFieldOn(mesh, "size", apf::SCALAR);
+  apf::MeshIterator* it = mesh->begin(0);
+  apf::MeshEntity*   v;
+  while ((v = mesh->iterate(it))) {
+    apf::Vector3 p;
+    mesh->getPoint(v, 0, p);
+    apf::setScalar(size_field, v, 0, 1.0 + p[0] + 10.0 * p[1] + 100.0 * p[2]);
+  }
+  mesh->end(it);
+  return mesh;
+}
+
+void
+destroyCube(apf::Mesh2* mesh)
+{
+  mesh->destroyNative();
+  apf::destroyMesh(mesh);
+}
+
+VertexValues
+getValues(apf::Mesh* mesh, apf::Field* size_field)
+{
+  VertexValues       values;
+  apf::MeshIterator* it = mesh->begin(0);
+  apf::MeshEntity*   v;
+  while ((v = mesh->iterate(it))) values[v] = apf::getScalar(size_field, v, 0);
+  mesh->end(it);
+  return values;
+}
+
+double
+segmentDistance(
+    apf::Vector3 const& a,
+    apf::Vector3 const& b,
+    apf::Vector3 const& p)
+{
+  apf::Vector3 const ab      = b - a;
+  double const       length2 = ab * ab;
+  double             t       = 0.0;
+  if (length2 > 0.0) t = std::max(0.0, std::min(1.0, ((p - a) * ab) / length2));
+  return (a + ab * t - p).getLength();
+}
+
+//
+// The size update, visiting every vertex of the mesh.
+//
+void
+referenceUpdate(
+    apf::Mesh*          mesh,
+    VertexValues&       values,
+    apf::Vector3 const& old_point,
+    apf::Vector3 const& new_point,
+    double const        radius)
+{
+  apf::MeshEntity* closest          = 0;
+  double           closest_distance = 0.0;
+  for (auto const& entry : values) {
+    apf::Vector3 p;
+    mesh->getPoint(entry.first, 0, p);
+    double const distance = (p - old_point).getLength();
+    if (closest == 0 || distance < closest_distance) {
+      closest          = entry.first;
+      closest_distance = distance;
+    }
+  }
+  double const value = values[closest];
+  for (auto& entry : values) {
+    apf::Vector3 p;
+    mesh->getPoint(entry.first, 0, p);
+    if (segmentDistance(old_point, new_point, p) < radius) entry.second = value;
+  }
+}
+
+void
+checkSteps(
+    Teuchos::FancyOStream&           out,
+    bool&                            success,
+    std::vector<apf::Vector3> const& path,
+    double const                     radius)
+{
+  apf::Field* size_field;
+  apf::Mesh2* mesh     = makeCube(size_field);
+  VertexValues reference = getValues(mesh, size_field);
+
+  Albany::PathSizeParameters parameters;
+  parameters.beam_radius = radius;
+  Albany::PathVertexIndex index(mesh, radius);
+
+  for (std::size_t step = 1; step < path.size(); ++step) {
+    // As after an adaptation
+    if (step == 2) index.rebuild();
+    Albany::addPredictedLaserSizeField(
+        mesh, size_field, index, path[step - 1], path[step], parameters);
+    referenceUpdate(mesh, reference, path[step - 1], path[step], radius);
+
+    VertexValues const values = getValues(mesh, size_field);
+    for (auto const& entry : reference) {
+      TEST_EQUALITY(values.at(entry.first), entry.second);
+    }
+  }
+
+  destroyCube(mesh);
+}
+
+TEUCHOS_UNIT_TEST(PathSizeField, PathInsideTheMesh)
+{
+  std::vector<apf::Vector3> path;
+  path.push_back(apf::Vector3(0.31, 0.42, 0.53));
+  path.push_back(apf::Vector3(0.72, 0.61, 0.47));
+  path.push_back(apf::Vector3(0.72, 0.61, 0.47));  // zero-length step
+  path.push_back(apf::Vector3(0.14, 0.83, 0.22));
+  checkSteps(out, success, path, 0.3);
+}
+
+TEUCHOS_UNIT_TEST(PathSizeField, NoVertexWithinBeamRadius)
+{
+  // The beam is narrower than the mesh spacing, and starts away from any
+  // vertex, and then outside of the mesh: the closest vertex is farther
+  // than a beam radius
+  std::vector<apf::Vector3> path;
+  path.push_back(apf::Vector3(0.13, 0.2, 0.31));
+  path.push_back(apf::Vector3(0.51, 0.49, 0.52));
+  path.push_back(apf::Vector3(3.1, 2.7, -1.9));
+  path.push_back(apf::Vector3(0.96, 0.97, 0.02));
+  checkSteps(out, success, path, 0.05);
+}
+
+}  // namespace
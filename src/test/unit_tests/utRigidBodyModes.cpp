@@ -0,0 +1,139 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <cmath>
+#include <string>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_NullSpaceUtils.hpp"
+#include "Albany_ThyraUtils.hpp"
+#include "Albany_TpetraThyraUtils.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const num_nodes = 8;
+int const num_dims  = 3;
+
+// 3D elasticity: three translations and three rotations
+int const num_rbm = 6;
+
+RCP<Thyra_VectorSpace const>
+nodeSpace(RCP<Teuchos_Comm const> const& comm, int const dofs_per_node)
+{
+  Teuchos::Array<GO> gids;
+  for (int i = 0; i < num_nodes; ++i) {
+    for (int k = 0; k < dofs_per_node; ++k) {
+      gids.push_back(
+          (comm->getRank() * num_nodes + i) * dofs_per_node + k);
+    }
+  }
+  return Albany::createVectorSpace(comm, gids());
+}
+
+void
+fillCoordinates(RCP<Thyra_MultiVector> const& coords, double const shift)
+{
+  auto data = Albany::getNonconstLocalData(coords);
+  for (int i = 0; i < num_nodes; ++i) {
+    data[0][i] = std::cos(i) + shift;
+    data[1][i] = std::sin(2.0 * i);
+    data[2][i] = 0.1 * i * i - shift;
+  }
+}
+
+RCP<Teuchos::ParameterList>
+mueLuPiroParams()
+{
+  RCP<Teuchos::ParameterList> piro = rcp(new Teuchos::ParameterList("Piro"));
+  Teuchos::ParameterList&     strat = piro->sublist("NOX")
+                                      .sublist("Direction")
+                                      .sublist("Newton")
+                                      .sublist("Stratimikos Linear Solver")
+                                      .sublist("Stratimikos");
+  strat.set<std::string>("Preconditioner Type", "MueLu");
+  strat.sublist("Preconditioner Types").sublist("MueLu");
+  return piro;
+}
+
+RCP<Tpetra_MultiVector>
+nullSpace(RCP<Teuchos::ParameterList> const& piro)
+{
+  return piro->sublist("NOX")
+      .sublist("Direction")
+      .sublist("Newton")
+      .sublist("Stratimikos Linear Solver")
+      .sublist("Stratimikos")
+      .sublist("Preconditioner Types")
+      .sublist("MueLu")
+      .get<RCP<Tpetra_MultiVector>>("Nullspace");
+}
+
+//
+// The rotation about x, (0, -z, y), in the centered coordinates.
+//
+void
+checkRotation(
+    Teuchos::FancyOStream&        out,
+    bool&                         success,
+    RCP<Tpetra_MultiVector> const& rbm,
+    RCP<Thyra_MultiVector> const&  coords)
+{
+  auto x        = Albany::getLocalData(coords.getConst());
+  auto rotation = rbm->getData(3);
+  for (int i = 0; i < num_nodes; ++i) {
+    TEST_EQUALITY(rotation[num_dims * i], 0.0);
+    TEST_EQUALITY(rotation[num_dims * i + 1], -x[2][i]);
+    TEST_EQUALITY(rotation[num_dims * i + 2], x[1][i]);
+  }
+}
+
+//
+// Setting the preconditioner up again for the same discretization must hand
+// MueLu the same null space multivector, refilled from the new coordinates.
+// A new solution space, i.e. a rebuilt discretization, gets a new one.
+//
+TEUCHOS_UNIT_TEST(RigidBodyModes, MueLuNullSpaceReuse)
+{
+  RCP<Teuchos_Comm const>      comm    = Albany::getDefaultComm();
+  RCP<Thyra_VectorSpace const> node_vs = nodeSpace(comm, 1);
+  RCP<Thyra_VectorSpace const> soln_vs = nodeSpace(comm, num_dims);
+  RCP<Thyra_MultiVector>       coords  = Thyra::createMembers(node_vs, 3);
+  RCP<Teuchos::ParameterList>  piro    = mueLuPiroParams();
+
+  Albany::RigidBodyModes rbm(num_dims);
+  rbm.setPiroPL(piro);
+  rbm.setParameters(num_dims, num_dims, 0, num_rbm);
+  TEST_ASSERT(rbm.isMueLuUsed());
+
+  fillCoordinates(coords, 0.0);
+  rbm.setCoordinatesAndNullspace(coords, soln_vs);
+  RCP<Tpetra_MultiVector> const first = nullSpace(piro);
+  TEST_ASSERT(first.get() != nullptr);
+  TEST_EQUALITY(first->getNumVectors(), std::size_t(num_rbm));
+  checkRotation(out, success, first, coords);
+
+  fillCoordinates(coords, 2.0);
+  rbm.setCoordinatesAndNullspace(coords, soln_vs);
+  RCP<Tpetra_MultiVector> const second = nullSpace(piro);
+  TEST_EQUALITY(second.get(), first.get());
+  checkRotation(out, success, second, coords);
+
+  RCP<Thyra_VectorSpace const> new_soln_vs = nodeSpace(comm, num_dims);
+  fillCoordinates(coords, 0.0);
+  rbm.setCoordinatesAndNullspace(coords, new_soln_vs);
+  RCP<Tpetra_MultiVector> const third = nullSpace(piro);
+  TEST_INEQUALITY(third.get(), first.get());
+  checkRotation(out, success, third, coords);
+}
+
+}  // namespace
@@ -0,0 +1,178 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/GetEntities.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/Selector.hpp>
+#include <stk_topology/topology.hpp>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_STKNodeSharing.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const nx = 7;
+int const ny = 5;
+
+//
+// Elements are dealt to the ranks round-robin, so that nodes are shared by
+// up to four ranks, and a rank's elements are not contiguous.
+//
+int
+elementRank(int const i, int const j, int const num_procs)
+{
+  return (i + nx * j) % num_procs;
+}
+
+stk::mesh::EntityId
+nodeId(int const i, int const j)
+{
+  return 1 + i + (nx + 1) * j;
+}
+
+//
+// The ranks of the elements around node (i, j).
+//
+std::set<int>
+nodeRanks(int const i, int const j, int const num_procs)
+{
+  std::set<int> ranks;
+  for (int ei = i - 1; ei <= i; ++ei) {
+    for (int ej = j - 1; ej <= j; ++ej) {
+      if (ei < 0 || ei >= nx || ej < 0 || ej >= ny) continue;
+      ranks.insert(elementRank(ei, ej, num_procs));
+    }
+  }
+  return ranks;
+}
+
+struct Mesh
+{
+  RCP<stk::mesh::MetaData> meta;
+  RCP<stk::mesh::BulkData> bulk;
+};
+
+//
+// A grid of quads, with the node sharing declared from the grid, or left
+// to fix_node_sharing.
+//
+Mesh
+buildGrid(RCP<Teuchos_Comm const> const& comm, bool const declare_sharing)
+{
+  auto const mpi_comm =
+      Teuchos::rcp_dynamic_cast<Teuchos::MpiComm<int> const>(comm, true);
+  int const num_procs = comm->getSize();
+  int const my_rank   = comm->getRank();
+
+  Mesh mesh;
+  mesh.meta = rcp(new stk::mesh::MetaData(2));
+  stk::mesh::Part& block = mesh.meta->declare_part_with_topology(
+      "block", stk::topology::QUAD_4_2D);
+  stk::mesh::Part& nodes =
+      mesh.meta->declare_part("nodes", stk::topology::NODE_RANK);
+  mesh.meta->commit();
+  mesh.bulk = rcp(new stk::mesh::BulkData(
+      *mesh.meta, *mpi_comm->getRawMpiComm()));
+
+  mesh.bulk->modification_begin();
+  stk::mesh::PartVector const elem_parts(1, &block);
+  stk::mesh::PartVector const node_parts(1, &nodes);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      if (elementRank(i, j, num_procs) != my_rank) continue;
+      stk::mesh::Entity const elem = mesh.bulk->declare_entity(
+          stk::topology::ELEM_RANK, 1 + i + nx * j, elem_parts);
+      int const corners[4][2] = {
+          {i, j}, {i + 1, j}, {i + 1, j + 1}, {i, j + 1}};
+      for (int n = 0; n < 4; ++n) {
+        int const ni = corners[n][0], nj = corners[n][1];
+        stk::mesh::Entity node =
+            mesh.bulk->get_entity(stk::topology::NODE_RANK, nodeId(ni, nj));
+        if (!mesh.bulk->is_valid(node)) {
+          node = mesh.bulk->declare_entity(
+              stk::topology::NODE_RANK, nodeId(ni, nj), node_parts);
+          if (declare_sharing) {
+            for (int const rank : nodeRanks(ni, nj, num_procs)) {
+              if (rank != my_rank) mesh.bulk->add_node_sharing(node, rank);
+            }
+          }
+        }
+        mesh.bulk->declare_relation(elem, node, n);
+      }
+    }
+  }
+  if (!declare_sharing) Albany::fix_node_sharing(*mesh.bulk);
+  mesh.bulk->modification_end();
+  return mesh;
+}
+
+std::vector<int>
+sharingProcs(stk::mesh::BulkData const& bulk, stk::mesh::EntityId const id)
+{
+  std::vector<int> procs;
+  bulk.comm_shared_procs(
+      stk::mesh::EntityKey(stk::topology::NODE_RANK, id), procs);
+  std::sort(procs.begin(), procs.end());
+  return procs;
+}
+
+//
+// The sharing found by fix_node_sharing must be the one of the grid: the
+// same nodes, shared with the same ranks, as in the mesh where the sharing
+// was declared by the code that built it.
+//
+TEUCHOS_UNIT_TEST(STKNodeSharing, MatchesDeclaredSharing)
+{
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+  int const               num_procs = comm->getSize();
+  int const               my_rank   = comm->getRank();
+
+  Mesh const declared = buildGrid(comm, true);
+  Mesh const fixed    = buildGrid(comm, false);
+
+  for (int j = 0; j <= ny; ++j) {
+    for (int i = 0; i <= nx; ++i) {
+      std::set<int> const ranks = nodeRanks(i, j, num_procs);
+      if (ranks.count(my_rank) == 0) continue;
+
+      std::vector<int> expected;
+      for (int const rank : ranks) {
+        if (rank != my_rank) expected.push_back(rank);
+      }
+      std::vector<int> const from_declared =
+          sharingProcs(*declared.bulk, nodeId(i, j));
+      std::vector<int> const from_fixed =
+          sharingProcs(*fixed.bulk, nodeId(i, j));
+      TEST_COMPARE_ARRAYS(from_declared, expected);
+      TEST_COMPARE_ARRAYS(from_fixed, expected);
+    }
+  }
+
+  // And the meshes agree on the locally owned nodes
+  stk::mesh::Selector const owned_declared =
+      declared.meta->locally_owned_part();
+  stk::mesh::Selector const owned_fixed = fixed.meta->locally_owned_part();
+  TEST_EQUALITY(
+      stk::mesh::count_selected_entities(
+          owned_declared,
+          declared.bulk->buckets(stk::topology::NODE_RANK)),
+      stk::mesh::count_selected_entities(
+          owned_fixed, fixed.bulk->buckets(stk::topology::NODE_RANK)));
+}
+
+}  // namespace
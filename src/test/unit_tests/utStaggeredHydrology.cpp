@@ -0,0 +1,342 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_config.h"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include <string>
+#include <vector>
+
+#include "Albany_CommUtils.hpp"
+#include "Albany_Utils.hpp"
+#include "LandIce_StaggeredHydrologySolver.hpp"
+
+namespace {
+
+using Teuchos::RCP;
+using Teuchos::rcp;
+
+int const num_elems = 4;
+
+void
+writeParams(Teuchos::ParameterList const& params, std::string const& filename)
+{
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+  if (comm->getRank() == 0) {
+    Teuchos::writeParameterListToXmlFile(params, filename);
+  }
+  comm->barrier();
+}
+
+//
+// An entry of 'Required Fields Info'. Inputs are computed by the mesh.
+//
+void
+setField(
+    Teuchos::ParameterList& info,
+    int const               index,
+    std::string const&      name,
+    std::string const&      type,
+    std::string const&      usage)
+{
+  Teuchos::ParameterList& field = info.sublist(Albany::strint("Field", index));
+  field.set<std::string>("Field Name", name);
+  field.set<std::string>("Field Type", type);
+  field.set<std::string>("Field Usage", usage);
+  if (usage != "Output") field.set<std::string>("Field Origin", "File");
+}
+
+void
+setLinearSolver(Teuchos::ParameterList& strat)
+{
+  strat.set<std::string>("Linear Solver Type", "Belos");
+  strat.set<std::string>("Preconditioner Type", "Ifpack2");
+  Teuchos::ParameterList& belos =
+      strat.sublist("Linear Solver Types").sublist("Belos");
+  belos.set<std::string>("Solver Type", "Block GMRES");
+  Teuchos::ParameterList& gmres =
+      belos.sublist("Solver Types").sublist("Block GMRES");
+  gmres.set<double>("Convergence Tolerance", 1.0e-10);
+  gmres.set<int>("Maximum Iterations", 200);
+  gmres.set<int>("Num Blocks", 200);
+}
+
+void
+setNewtonSolver(Teuchos::ParameterList& nox)
+{
+  nox.sublist("Direction").set<std::string>("Method", "Newton");
+  setLinearSolver(nox.sublist("Direction")
+                      .sublist("Newton")
+                      .sublist("Stratimikos Linear Solver")
+                      .sublist("Stratimikos"));
+  nox.sublist("Line Search").set<std::string>("Method", "Backtrack");
+  nox.set<std::string>("Nonlinear Solver", "Line Search Based");
+
+  Teuchos::ParameterList& tests = nox.sublist("Status Tests");
+  tests.set<std::string>("Test Type", "Combo");
+  tests.set<std::string>("Combo Type", "OR");
+  tests.set<int>("Number of Tests", 2);
+  tests.sublist("Test 0").set<std::string>("Test Type", "NormF");
+  tests.sublist("Test 0").set<double>("Tolerance", 1.0e-8);
+  tests.sublist("Test 1").set<std::string>("Test Type", "MaxIters");
+  tests.sublist("Test 1").set<int>("Maximum Iterations", 30);
+}
+
+//
+// FO velocity on a sloped slab, with a power law friction that depends
+// on the effective pressure computed by the hydrology.
+//
+std::string
+writeVelocityInput(std::string const& filename)
+{
+  Teuchos::ParameterList params("Albany Parameters");
+
+  Teuchos::ParameterList& problem = params.sublist("Problem");
+  problem.set<std::string>("Name", "LandIce Stokes First Order 3D");
+  problem.set<std::string>("Solution Method", "Steady");
+  problem.set<std::string>("Basal Side Name", "basalside");
+  problem.sublist("Body Force").set<std::string>("Type", "FO INTERP SURF GRAD");
+  problem.sublist("LandIce Viscosity").set<std::string>("Type", "Glen's Law");
+  problem.sublist("LandIce Viscosity").set<double>("Glen's Law A", 1.0e-4);
+  problem.sublist("LandIce Viscosity").set<double>("Glen's Law n", 3.0);
+  Teuchos::ParameterList& phys = problem.sublist("LandIce Physical Parameters");
+  phys.set<double>("Ice Density", 910.0);
+  phys.set<double>("Water Density", 1028.0);
+  phys.set<double>("Gravity Acceleration", 9.8);
+
+  Teuchos::ParameterList& bcs = problem.sublist("LandIce BCs");
+  bcs.set<int>("Number", 1);
+  Teuchos::ParameterList& basal = bcs.sublist("BC 0");
+  basal.set<std::string>("Type", "Basal Friction");
+  basal.set<std::string>("Side Set Name", "basalside");
+  Teuchos::ParameterList& beta = basal.sublist("Basal Friction Coefficient");
+  beta.set<std::string>("Type", "Power Law");
+  beta.set<double>("Power Law Coefficient", 1.0e-4);
+  beta.set<double>("Power Exponent", 1.0);
+
+  Teuchos::ParameterList& disc = params.sublist("Discretization");
+  disc.set<std::string>("Method", "Extruded");
+  disc.set<int>("NumLayers", 2);
+  disc.set<std::string>("Element Shape", "Wedge");
+  disc.set<std::string>("Thickness Field Name", "ice_thickness");
+  disc.set<std::string>("Surface Height Field Name", "surface_height");
+  disc.set("Extrude Basal Node Fields",
+           Teuchos::tuple<std::string>("ice_thickness", "surface_height"));
+  disc.set("Basal Node Fields Ranks", Teuchos::tuple<int>(1, 1));
+  Teuchos::ParameterList& info = disc.sublist("Required Fields Info");
+  info.set<int>("Number Of Fields", 2);
+  setField(info, 0, "ice_thickness", "Node Scalar", "Input");
+  info.sublist("Field 0").set<std::string>("Field Origin", "Mesh");
+  setField(info, 1, "surface_height", "Node Scalar", "Input");
+  info.sublist("Field 1").set<std::string>("Field Origin", "Mesh");
+
+  Teuchos::ParameterList& ss_discs = disc.sublist("Side Set Discretizations");
+  ss_discs.set("Side Sets", Teuchos::tuple<std::string>("basalside"));
+  Teuchos::ParameterList& basal_disc = ss_discs.sublist("basalside");
+  basal_disc.set<std::string>("Method", "STK2D");
+  basal_disc.set<std::string>("Cell Topology", "Triangle");
+  basal_disc.set<int>("1D Elements", num_elems);
+  basal_disc.set<int>("2D Elements", num_elems);
+  basal_disc.set<double>("1D Scale", 10.0);
+  basal_disc.set<double>("2D Scale", 10.0);
+  Teuchos::ParameterList& basal_info =
+      basal_disc.sublist("Required Fields Info");
+  basal_info.set<int>("Number Of Fields", 4);
+  setField(basal_info, 0, "ice_thickness", "Node Scalar", "Input");
+  basal_info.sublist("Field 0").set<double>("Field Value", 1.0);
+  setField(basal_info, 1, "surface_height", "Node Scalar", "Input");
+  basal_info.sublist("Field 1").set(
+      "Field Expression", Teuchos::tuple<std::string>("1.0-0.01*x"));
+  setField(basal_info, 2, "effective_pressure", "Node Scalar", "Input");
+  basal_info.sublist("Field 2").set<double>("Field Value", 1.0e6);
+  setField(basal_info, 3, "Velocity", "Node Vector", "Output");
+  basal_info.sublist("Field 3").set<std::string>("State Name", "ice_velocity");
+
+  setNewtonSolver(params.sublist("Piro").sublist("NOX"));
+
+  writeParams(params, filename);
+  return filename;
+}
+
+//
+// Hydrology on the same triangulation as the basal side of the velocity
+// mesh, with a uniform surface water input draining through NodeSet0.
+//
+std::string
+writeHydrologyInput(std::string const& filename, bool const transient)
+{
+  Teuchos::ParameterList params("Albany Parameters");
+
+  Teuchos::ParameterList& problem = params.sublist("Problem");
+  problem.set<std::string>("Name", "LandIce Hydrology 2D");
+  problem.set<std::string>(
+      "Solution Method", transient ? "Transient Tempus" : "Steady");
+  problem.sublist("Dirichlet BCs")
+      .set<double>("DBC on NS NodeSet0 for DOF water_pressure", 0.0);
+
+  Teuchos::ParameterList& hydro = problem.sublist("LandIce Hydrology");
+  hydro.set<double>("Darcy Law Transmissivity", 1.0e-3);
+  hydro.set<double>("Darcy Law Water Thickness Exponent", 1.0);
+  hydro.set<double>("Darcy Law Potential Gradient Norm Exponent", 2.0);
+  hydro.set<double>("Bed Bumps Height", 0.1);
+  hydro.set<double>("Bed Bumps Length", 2.0);
+  hydro.set<bool>("Use Melting In Conservation Of Mass", false);
+  hydro.set<std::string>("Ice Softness Type", "Uniform");
+  hydro.sublist("Surface Water Input").set<std::string>("Type", "Given Value");
+  hydro.sublist("Surface Water Input").set<double>("Given Value", 1.0);
+
+  Teuchos::ParameterList& phys = problem.sublist("LandIce Physical Parameters");
+  phys.set<double>("Ice Latent Heat", 3.34e5);
+  phys.set<double>("Ice Density", 910.0);
+  phys.set<double>("Water Density", 1028.0);
+  phys.set<double>("Gravity Acceleration", 9.8);
+  phys.set<double>("Ice Softness", 3.1689e-24);
+
+  problem.sublist("LandIce Viscosity").set<double>("Glen's Law n", 3.0);
+  problem.sublist("LandIce Basal Friction Coefficient")
+      .set<std::string>("Type", "Given Constant");
+  problem.sublist("LandIce Basal Friction Coefficient")
+      .set<double>("Constant Given Beta Value", 1.0);
+
+  Teuchos::ParameterList& disc = params.sublist("Discretization");
+  disc.set<std::string>("Method", "STK2D");
+  disc.set<std::string>("Cell Topology", "Triangle");
+  disc.set<int>("1D Elements", num_elems);
+  disc.set<int>("2D Elements", num_elems);
+  disc.set<double>("1D Scale", 10.0);
+  disc.set<double>("2D Scale", 10.0);
+  disc.set<int>("Number Of Time Derivatives", transient ? 1 : 0);
+  Teuchos::ParameterList& info = disc.sublist("Required Fields Info");
+  info.set<int>("Number Of Fields", 5);
+  setField(info, 0, "ice_thickness", "Node Scalar", "Input");
+  info.sublist("Field 0").set<double>("Field Value", 1000.0);
+  setField(info, 1, "surface_height", "Node Scalar", "Input");
+  info.sublist("Field 1").set<double>("Field Value", 1000.0);
+  setField(info, 2, "geothermal_flux", "Node Scalar", "Input");
+  info.sublist("Field 2").set<double>("Field Value", 0.06);
+  setField(info, 3, "basal_velocity", "Node Vector", "Input");
+  info.sublist("Field 3").set("Field Value", Teuchos::tuple<double>(0.0, 0.0));
+  setField(info, 4, "effective_pressure", "Node Scalar", "Output");
+
+  Teuchos::ParameterList& piro = params.sublist("Piro");
+  if (transient) {
+    Teuchos::ParameterList& tempus = piro.sublist("Tempus");
+    tempus.set<std::string>("Integrator Name", "Tempus Integrator");
+    Teuchos::ParameterList& integrator = tempus.sublist("Tempus Integrator");
+    integrator.set<std::string>("Integrator Type", "Integrator Basic");
+    integrator.set<std::string>("Stepper Name", "Tempus Stepper");
+    integrator.sublist("Solution History")
+        .set<std::string>("Storage Type", "Unlimited");
+    Teuchos::ParameterList& control = integrator.sublist("Time Step Control");
+    control.set<double>("Initial Time", 0.0);
+    control.set<double>("Final Time", 1.0);
+    control.set<double>("Initial Time Step", 1.0);
+    control.set<std::string>("Integrator Step Type", "Constant");
+    Teuchos::ParameterList& stepper = tempus.sublist("Tempus Stepper");
+    stepper.set<std::string>("Stepper Type", "Backward Euler");
+    stepper.set<std::string>("Solver Name", "Demo Solver");
+    setNewtonSolver(stepper.sublist("Demo Solver").sublist("NOX"));
+    setLinearSolver(tempus.sublist("Stratimikos"));
+  } else {
+    setNewtonSolver(piro.sublist("NOX"));
+  }
+
+  writeParams(params, filename);
+  return filename;
+}
+
+RCP<Teuchos::ParameterList>
+staggeredParams(
+    std::string const& scheme,
+    bool const         transient,
+    int const          substeps)
+{
+  std::string const suffix = transient ? "Transient" : "Steady";
+
+  RCP<Teuchos::ParameterList> params =
+      rcp(new Teuchos::ParameterList("Albany Parameters"));
+  params->sublist("Problem").set<std::string>(
+      "Solution Method", "LandIce Staggered Hydrology");
+
+  Teuchos::ParameterList& coupling = params->sublist("Staggered Coupling");
+  coupling.set<std::string>(
+      "Velocity Input File", writeVelocityInput("utStaggeredVelocity.xml"));
+  coupling.set<std::string>(
+      "Hydrology Input File",
+      writeHydrologyInput("utStaggeredHydrology" + suffix + ".xml", transient));
+  coupling.set<std::string>("Coupling Scheme", scheme);
+  coupling.set<int>("Maximum Iterations", 30);
+  coupling.set<double>("Relative Tolerance", 1.0e-6);
+  coupling.set<int>("Hydrology Sub-steps", substeps);
+  if (transient) coupling.set<double>("Coupling Time Step", 0.5);
+
+  return params;
+}
+
+//
+// Runs the coupling, and checks that it converged with a history that
+// contracts after the first iterations.
+//
+int
+checkConvergence(
+    Teuchos::FancyOStream&      out,
+    bool&                       success,
+    RCP<Teuchos::ParameterList> params)
+{
+  LandIce::StaggeredHydrologySolver solver(params, Albany::getDefaultComm());
+  solver.evalModel(solver.createInArgs(), solver.createOutArgs());
+
+  TEST_ASSERT(solver.hasConverged());
+
+  std::vector<ST> const& history = solver.getConvergenceHistory();
+  TEST_EQUALITY(static_cast<int>(history.size()), solver.getNumIterations());
+  TEST_COMPARE(history.back(), <=, 1.0e-6);
+  for (std::size_t iter = 2; iter < history.size(); ++iter) {
+    TEST_COMPARE(history[iter], <, history[iter - 1]);
+  }
+
+  return solver.getNumIterations();
+}
+
+TEUCHOS_UNIT_TEST(StaggeredHydrology, GaussSeidelAndJacobiConverge)
+{
+  int const gs_iters =
+      checkConvergence(out, success, staggeredParams("Gauss-Seidel", false, 1));
+  int const jacobi_iters =
+      checkConvergence(out, success, staggeredParams("Jacobi", false, 1));
+
+  // The lagged velocity cannot make the coupling converge faster
+  TEST_COMPARE(jacobi_iters, >=, gs_iters);
+}
+
+#ifdef ALBANY_TEMPUS
+TEUCHOS_UNIT_TEST(StaggeredHydrology, SubCycledTransientHydrology)
+{
+  checkConvergence(out, success, staggeredParams("Gauss-Seidel", true, 4));
+}
+#endif
+
+TEUCHOS_UNIT_TEST(StaggeredHydrology, InvalidSettings)
+{
+  RCP<Teuchos_Comm const> comm = Albany::getDefaultComm();
+
+  // Sub-steps require a transient hydrology
+  TEST_THROW(
+      LandIce::StaggeredHydrologySolver(
+          staggeredParams("Gauss-Seidel", false, 2), comm),
+      std::logic_error);
+
+  // Reusing the hierarchy requires MueLu
+  RCP<Teuchos::ParameterList> params =
+      staggeredParams("Gauss-Seidel", false, 1);
+  params->sublist("Staggered Coupling")
+      .set<std::string>("Velocity Preconditioner Reuse", "Full");
+  TEST_THROW(LandIce::StaggeredHydrologySolver(params, comm), std::logic_error);
+}
+
+}  // namespace
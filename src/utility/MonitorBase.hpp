@@ -50,6 +50,10 @@ public:
 
   void summarize (std::ostream &out = std::cout);
 
+  const monitor_map& items () const {
+    return itemMap_;
+  }
+
 protected:
   
   virtual string getStringValue (const monitored_type& val) = 0;
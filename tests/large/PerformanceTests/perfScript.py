@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+##*****************************************************************//
+##    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+##    This Software is released under the BSD license detailed     //
+##    in the file "license.txt" in the top-level Albany directory  //
+##*****************************************************************//
+
+"""Performance regression check for one Albany run.
+
+Runs the command after '--' a few times with '--timers <file>' appended, so
+that Albany writes its TimeMonitor and PerformanceContext timers as JSON.
+The median of each timer is compared against the baseline for this test in
+<baseline-dir>/<machine-class>.json. A timer fails when it exceeds
+
+    mean + max(sigma * stddev, rel-tol * mean, abs-tol)
+
+where mean and stddev were recorded with --update on the same machine class.
+A baseline timer may instead give a "budget" in seconds, which is then the
+limit; --update replaces it with the recorded mean and stddev.
+The exit status is nonzero on a regression or if Albany itself fails, so the
+check fails CTest like a correctness test does.
+
+Example:
+    perfScript.py --name SteadyHeat2D --machine-class skybridge \\
+        --baseline-dir baselines -- mpiexec -np 4 Albany inputT.yaml
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--name", required=True, help="test name in the baseline file")
+    parser.add_argument("--machine-class", required=True,
+                        help="selects the baseline file <machine-class>.json")
+    parser.add_argument("--baseline-dir", required=True)
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="number of runs; the median of each timer is compared")
+    parser.add_argument("--timers", nargs="*", default=None,
+                        help="timers to record with --update (default: all timers "
+                             "taking at least --min-time)")
+    parser.add_argument("--min-time", type=float, default=0.05,
+                        help="shortest timer recorded by default, in seconds")
+    parser.add_argument("--statistic", default="MaxOverProcs",
+                        help="statistic compared for TimeMonitor timers")
+    parser.add_argument("--sigma", type=float, default=3.0)
+    parser.add_argument("--rel-tol", type=float, default=0.10)
+    parser.add_argument("--abs-tol", type=float, default=0.05)
+    parser.add_argument("--update", action="store_true",
+                        help="record the baseline for this test instead of checking it")
+    parser.add_argument("--results", default=None,
+                        help="machine-readable results (default: perf_<name>.json)")
+    parser.add_argument("command", nargs=argparse.REMAINDER)
+    args = parser.parse_args()
+    if args.command and args.command[0] == "--":
+        args.command = args.command[1:]
+    if not args.command:
+        parser.error("missing the Albany command after '--'")
+    if args.repeat < 1:
+        parser.error("--repeat must be positive")
+    return args
+
+
+def timer_value(stats, statistic):
+    # PerformanceContext timers are only available on rank 0
+    if statistic in stats:
+        return stats[statistic]
+    return stats.get("Rank0")
+
+
+def run_albany(args):
+    """Returns {timer: [seconds per run]} and the wall time per run."""
+    samples = {}
+    wall_times = []
+    for run in range(args.repeat):
+        timers_file = "perf_%s_timers_%d.json" % (args.name, run)
+        if os.path.exists(timers_file):
+            os.remove(timers_file)
+        start = time.time()
+        status = subprocess.call(args.command + ["--timers", timers_file])
+        wall_times.append(time.time() - start)
+        if status != 0:
+            sys.exit("Albany failed with status %d on run %d" % (status, run))
+        with open(timers_file) as f:
+            timers = json.load(f)["timers"]
+        for name, stats in timers.items():
+            value = timer_value(stats, args.statistic)
+            if value is not None:
+                samples.setdefault(name, []).append(value)
+    return samples, wall_times
+
+
+def baseline_path(args):
+    return os.path.join(args.baseline_dir, args.machine_class + ".json")
+
+
+def load_baselines(path):
+    if not os.path.exists(path):
+        return {"tests": {}}
+    with open(path) as f:
+        return json.load(f)
+
+
+def update_baseline(args, samples):
+    if args.repeat < 2:
+        sys.exit("--update needs --repeat of at least 2 to estimate the spread")
+    names = args.timers
+    if names is None:
+        names = [n for n, s in samples.items() if statistics.median(s) >= args.min_time]
+    missing = [n for n in names if n not in samples]
+    if missing:
+        sys.exit("Timers not reported by Albany: " + ", ".join(missing))
+
+    entry = {}
+    for name in sorted(names):
+        values = samples[name]
+        entry[name] = {"mean": statistics.mean(values),
+                       "stddev": statistics.stdev(values),
+                       "samples": len(values)}
+
+    path = baseline_path(args)
+    if not os.path.isdir(args.baseline_dir):
+        os.makedirs(args.baseline_dir)
+    baselines = load_baselines(path)
+    baselines["machine_class"] = args.machine_class
+    baselines["tests"][args.name] = {"statistic": args.statistic, "timers": entry}
+    with open(path, "w") as f:
+        json.dump(baselines, f, indent=2, sort_keys=True)
+        f.write("\n")
+    print("Recorded %d timers for %s in %s" % (len(entry), args.name, path))
+    return 0
+
+
+def find_baseline(args):
+    path = baseline_path(args)
+    test = load_baselines(path)["tests"].get(args.name)
+    if test is None:
+        sys.exit("No baseline for %s in %s; record one with --update" % (args.name, path))
+    return test
+
+
+def check_baseline(args, test, samples):
+    results = {}
+    failed = False
+    print("%-50s %12s %12s %12s  %s" % ("Timer", "baseline", "measured", "limit", "status"))
+    for name, ref in sorted(test["timers"].items()):
+        budget = ref.get("budget")
+        if budget is not None:
+            ref = {"mean": budget, "stddev": 0.0}
+        if name not in samples:
+            print("%-50s %12.4f %12s %12s  MISSING" % (name, ref["mean"], "-", "-"))
+            results[name] = {"baseline": ref["mean"], "status": "missing"}
+            failed = True
+            continue
+        measured = statistics.median(samples[name])
+        if budget is not None:
+            limit = budget
+        else:
+            limit = ref["mean"] + max(args.sigma * ref["stddev"],
+                                      args.rel_tol * ref["mean"], args.abs_tol)
+        if measured > limit:
+            status = "SLOWER"
+            failed = True
+        elif budget is None and measured < 2 * ref["mean"] - limit:
+            # Not a failure, but the baseline should be updated to keep
+            # catching regressions of the new speed.
+            status = "faster"
+        else:
+            status = "ok"
+        print("%-50s %12.4f %12.4f %12.4f  %s" % (name, ref["mean"], measured, limit, status))
+        results[name] = {"baseline": ref["mean"], "stddev": ref["stddev"],
+                         "measured": measured, "limit": limit, "status": status.lower()}
+    return failed, results
+
+
+def main():
+    args = parse_args()
+    if args.update:
+        samples, _ = run_albany(args)
+        return update_baseline(args, samples)
+
+    test = find_baseline(args)
+    samples, wall_times = run_albany(args)
+    failed, results = check_baseline(args, test, samples)
+    results_file = args.results or "perf_%s.json" % args.name
+    with open(results_file, "w") as f:
+        json.dump({"name": args.name, "machine_class": args.machine_class,
+                   "statistic": args.statistic, "wall_times": wall_times,
+                   "passed": not failed, "timers": results},
+                  f, indent=2, sort_keys=True)
+        f.write("\n")
+
+    print("Wall time per run: " + ", ".join("%.2f s" % t for t in wall_times))
+    if failed:
+        print("Performance regression in %s (details in %s)" % (args.name, results_file))
+        return 1
+    print("Performance test %s passed" % args.name)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())